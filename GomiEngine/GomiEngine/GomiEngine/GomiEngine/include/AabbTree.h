@@ -0,0 +1,140 @@
+#pragma once
+#include "Prerequisites.h"
+#include <algorithm>
+
+/**
+ * @class AabbTree
+ * @brief Broadphase de árbol dinámico de cajas envolventes (AABB).
+ *
+ * Cada proxy es una hoja con su caja agrandada por un margen. Mover un proxy no toca el árbol
+ * mientras la caja nueva quepa en la agrandada; si se sale, la hoja se quita y se vuelve a
+ * insertar bajando por el hijo que menos crece el perímetro. `findPairs` consulta el árbol con
+ * la caja exacta de cada proxy y prueba los candidatos con las cajas exactas.
+ */
+class AabbTree {
+public:
+    /// Identificador inválido de proxy o nodo.
+    static constexpr unsigned int INVALID_PROXY = 0xFFFFFFFFu;
+
+    /**
+     * @struct ProxyPair
+     * @brief Par de proxies traslapados (el identificador menor primero).
+     */
+    struct ProxyPair {
+        unsigned int proxyA;
+        unsigned int proxyB;
+    };
+
+    /**
+     * @brief Crea un árbol vacío.
+     * @param margin Distancia que se agranda cada caja en cada lado al insertarla.
+     */
+    explicit AabbTree(float margin = 4.0f) : m_margin(margin) {}
+    ~AabbTree() = default; ///< Destructor por defecto.
+
+    /**
+     * @brief Inserta una caja envolvente en el árbol.
+     * @param bounds Caja envolvente en coordenadas de mundo.
+     * @param userData Dato opaco asociado al proxy (por ejemplo, el actor).
+     * @return Identificador del proxy creado.
+     */
+    unsigned int createProxy(const sf::FloatRect& bounds, void* userData);
+
+    /**
+     * @brief Quita la hoja del proxy y libera su identificador.
+     */
+    void destroyProxy(unsigned int proxyId);
+
+    /**
+     * @brief Actualiza la caja de un proxy; solo reinserta la hoja si sale de su caja agrandada.
+     */
+    void moveProxy(unsigned int proxyId, const sf::FloatRect& bounds);
+
+    /**
+     * @brief Calcula todos los pares traslapados (cajas que solo se tocan no cuentan).
+     * @param pairs Se vacía y se llena con los pares, sin duplicados.
+     */
+    void findPairs(std::vector<ProxyPair>& pairs);
+
+    /**
+     * @brief Obtiene el dato de usuario asociado a un proxy.
+     */
+    void* getUserData(unsigned int proxyId) const;
+
+    /**
+     * @brief Cantidad de proxies activos.
+     */
+    size_t getProxyCount() const { return m_proxyCount; }
+
+    /**
+     * @brief Hojas reinsertadas desde el último `resetStats`.
+     */
+    size_t getReinsertCount() const { return m_reinsertCount; }
+
+    /**
+     * @brief Reinicia los contadores de estadísticas.
+     */
+    void resetStats() { m_reinsertCount = 0; }
+
+private:
+    /**
+     * @struct Box
+     * @brief Caja como extremos mínimos y máximos (más barata de unir que `sf::FloatRect`).
+     */
+    struct Box {
+        float minX, minY, maxX, maxY;
+    };
+
+    /**
+     * @struct Node
+     * @brief Nodo del árbol: una hoja guarda un proxy, un nodo interno siempre tiene dos hijos.
+     */
+    struct Node {
+        Box box = {};
+        unsigned int parent = INVALID_PROXY;  ///< En los nodos libres, siguiente nodo libre.
+        unsigned int children[2] = { INVALID_PROXY, INVALID_PROXY };
+        unsigned int proxyId = INVALID_PROXY; ///< Solo en las hojas.
+
+        bool isLeaf() const { return children[0] == INVALID_PROXY; }
+    };
+
+    /**
+     * @struct Proxy
+     * @brief Estado interno de una caja registrada.
+     */
+    struct Proxy {
+        Box bounds = {};
+        unsigned int leaf = INVALID_PROXY;
+        void* userData = nullptr;
+        unsigned int nextFree = INVALID_PROXY;
+        bool active = false;
+    };
+
+    static Box toBox(const sf::FloatRect& r) { return { r.left, r.top, r.left + r.width, r.top + r.height }; }
+    static Box merge(const Box& a, const Box& b) {
+        return { std::min(a.minX, b.minX), std::min(a.minY, b.minY), std::max(a.maxX, b.maxX), std::max(a.maxY, b.maxY) };
+    }
+    static float perimeter(const Box& b) { return 2.0f * ((b.maxX - b.minX) + (b.maxY - b.minY)); }
+    static bool contains(const Box& outer, const Box& inner) {
+        return outer.minX <= inner.minX && outer.minY <= inner.minY && inner.maxX <= outer.maxX && inner.maxY <= outer.maxY;
+    }
+    static bool overlaps(const Box& a, const Box& b) {
+        return a.minX < b.maxX && b.minX < a.maxX && a.minY < b.maxY && b.minY < a.maxY;
+    }
+
+    unsigned int allocateNode();
+    void freeNode(unsigned int node);
+    void insertLeaf(unsigned int leaf);
+    void removeLeaf(unsigned int leaf);
+    Box fatten(const Box& box) const;
+
+    float m_margin;                          ///< Margen de las cajas agrandadas.
+    std::vector<Node> m_nodes;               ///< Nodos del árbol (y libres).
+    unsigned int m_root = INVALID_PROXY;     ///< Raíz del árbol.
+    unsigned int m_freeNode = INVALID_PROXY; ///< Primer nodo libre.
+    std::vector<Proxy> m_proxies;            ///< Proxies indexados por identificador.
+    unsigned int m_freeList = INVALID_PROXY; ///< Primer identificador libre para reutilizar.
+    size_t m_proxyCount = 0;                 ///< Proxies activos.
+    std::vector<unsigned int> m_stack;       ///< Pila de recorrido de `findPairs` (se reutiliza).
+    size_t m_reinsertCount = 0;              ///< Hojas reinsertadas (estadística).
+};
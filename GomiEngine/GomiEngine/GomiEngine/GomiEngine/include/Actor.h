@@ -57,8 +57,50 @@ public:
     template <typename T>
     EngineUtilities::TSharedPointer<T> findComponent();
 
+    /**
+     * @brief Marca el actor como estático: su geometría se hornea en la capa estática
+     * y deja de enviarse a los lotes dinámicos de cada fotograma.
+     * @param isStatic `true` si el actor no se mueve.
+     */
+    void setStatic(bool isStatic) {
+        if (m_isStatic != isStatic) {
+            m_isStatic = isStatic;
+            ++m_version;
+        }
+    }
+
+    /**
+     * @brief Indica si el actor está marcado como estático.
+     */
+    bool isStatic() const { return m_isStatic; }
+
+    /**
+     * @brief Asigna la capa de dibujo; las capas menores se dibujan primero.
+     * @param layer Capa de dibujo.
+     */
+    void setRenderLayer(uint8_t layer) {
+        if (m_renderLayer != layer) {
+            m_renderLayer = layer;
+            ++m_version;
+        }
+    }
+
+    /**
+     * @brief Obtiene la capa de dibujo del actor.
+     */
+    uint8_t getRenderLayer() const { return m_renderLayer; }
+
+    /**
+     * @brief Contador que aumenta cada vez que cambia cómo se dibuja el actor
+     * (capa o marca de estático). Los cambios de la forma se cuentan en `ShapeFactory::getVersion`.
+     */
+    uint32_t getVersion() const { return m_version; }
+
 private:
     std::string m_actorName = "Unnamed Actor"; ///< Nombre del actor.
+    bool m_isStatic = false; ///< La geometría se dibuja desde la capa estática.
+    uint8_t m_renderLayer = 0; ///< Capa usada en la clave de la cola de dibujo.
+    uint32_t m_version = 0; ///< Cambios de dibujo del actor.
 };
 
 /**
@@ -0,0 +1,110 @@
+#pragma once
+#include "MappedFile.h"
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct AssetSpan
+ * @brief Bytes de un recurso dentro del archivo proyectado (no se copian).
+ */
+struct AssetSpan {
+    const void* data = nullptr;  ///< Inicio de los datos (nulo si no existe).
+    size_t size = 0;             ///< Tamaño en bytes.
+
+    explicit operator bool() const { return data != nullptr; }
+};
+
+/**
+ * @class AssetArchive
+ * @brief Paquete de recursos (`.gpak`): un solo archivo con índice ordenado por hash y datos
+ * alineados, leído mediante proyección en memoria.
+ *
+ * Formato (little-endian):
+ * - Encabezado de 32 bytes: firma "GPAK", versión, cantidad de entradas, alineación, posición
+ *   del índice y posición de la tabla de nombres.
+ * - Índice: una entrada de 32 bytes por recurso (hash FNV-1a del nombre, nombre, posición y
+ *   tamaño), ordenado por hash y después por nombre.
+ * - Tabla de nombres y, a continuación, los datos de cada recurso alineados a `DATA_ALIGNMENT`.
+ *
+ * Abrir el paquete solo valida el encabezado y el índice; `find` hace una búsqueda binaria por
+ * hash y devuelve un `AssetSpan` que apunta directo al archivo, listo para `loadFromMemory`.
+ * Los nombres usan '/' como separador (p. ej. "Characters/tile000.png").
+ */
+class AssetArchive {
+public:
+    static constexpr uint32_t MAGIC = 0x4B415047;    ///< "GPAK" en little-endian.
+    static constexpr uint32_t VERSION = 1;           ///< Versión del formato.
+    static constexpr uint32_t DATA_ALIGNMENT = 16;   ///< Alineación de los datos de cada recurso.
+
+    AssetArchive() = default; ///< Constructor por defecto (sin paquete).
+
+    // Deshabilitar copia y asignación
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    /**
+     * @brief Proyecta un paquete y valida su índice.
+     * @param path Ruta del paquete.
+     * @return true si el paquete es válido.
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Busca un recurso por nombre.
+     * @param name Nombre del recurso ('\\' se trata igual que '/').
+     * @return Bytes del recurso, o un span vacío si no existe.
+     */
+    AssetSpan find(const std::string& name) const;
+
+    /**
+     * @brief Indica si el paquete contiene un recurso.
+     */
+    bool contains(const std::string& name) const { return static_cast<bool>(find(name)); }
+
+    size_t getEntryCount() const { return m_entryCount; } ///< Recursos en el paquete.
+    const std::string& getPath() const { return m_path; }  ///< Ruta del paquete abierto.
+
+    /**
+     * @brief Herramienta offline: escribe un paquete con los archivos indicados.
+     * @param outputPath Ruta del paquete a crear.
+     * @param files Pares (nombre dentro del paquete, ruta en disco).
+     * @param error Descripción del problema si falla.
+     * @return true si el paquete se escribió.
+     */
+    static bool build(const std::string& outputPath,
+                      const std::vector<std::pair<std::string, std::string>>& files,
+                      std::string& error);
+
+    /**
+     * @brief Herramienta offline: empaqueta todos los archivos de un directorio (recursivo),
+     * nombrados por su ruta relativa.
+     */
+    static bool buildFromDirectory(const std::string& outputPath, const std::string& directory,
+                                   std::string& error);
+
+private:
+    /**
+     * @struct Entry
+     * @brief Entrada del índice tal como está en el archivo.
+     */
+    struct Entry {
+        uint64_t nameHash;
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        uint64_t dataOffset;
+        uint64_t dataSize;
+    };
+
+    /**
+     * @brief Hash del nombre con los separadores normalizados a '/'.
+     */
+    static uint64_t hashName(const char* name, size_t length);
+
+    MappedFile m_file;               ///< Paquete proyectado.
+    std::string m_path;              ///< Ruta del paquete.
+    const Entry* m_entries = nullptr;///< Índice dentro de la proyección.
+    const char* m_names = nullptr;   ///< Tabla de nombres dentro de la proyección.
+    size_t m_entryCount = 0;         ///< Cantidad de entradas.
+};
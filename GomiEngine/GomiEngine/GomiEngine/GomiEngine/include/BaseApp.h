@@ -6,75 +6,219 @@
 #include "GUI.h"
 #include "Services/NotificationSystem.h"
 #include "Services/ResourceManager.h"
+#include "TriggerSystem.h"
+#include "BatchRenderer.h"
+#include "StaticRenderLayer.h"
+#include "RenderQueue.h"
+#include "RenderThread.h"
+#include "SoftwareRenderer3D.h"
+#include "StartupTimeline.h"
+#include "LogSink.h"
+#include "LogConsole.h"
 
 /**
- * @class Application
+ * @class BaseApp
  * @brief Clase base que maneja el ciclo de vida de la aplicacin.
  */
-class Application {
+class BaseApp {
 public:
-    Application() = default; ///< Constructor por defecto.
-    ~Application(); ///< Destructor para limpieza de recursos.
+    BaseApp() = default; ///< Constructor por defecto.
+    ~BaseApp(); ///< Destructor para limpieza de recursos.
 
     /**
      * @brief Ejecuta la aplicacin.
      * Este mtodo inicia el bucle principal de la aplicacin.
      * @return Cdigo de retorno para el sistema operativo.
      */
-    int execute();
+    int run();
 
     /**
      * @brief Inicializa los recursos y sistemas de la aplicacin.
      * @return Verdadero si la inicializacin fue exitosa.
      */
-    bool setup();
+    bool initialize();
 
     /**
      * @brief Realiza actualizaciones por fotograma.
      * Este mtodo gestiona la lgica del programa que debe ejecutarse
      * en cada iteracin del bucle principal.
      */
-    void processUpdates();
+    void update();
 
     /**
      * @brief Renderiza todos los elementos en pantalla.
      * Este mtodo dibuja los objetos en la ventana grfica.
      */
-    void draw();
+    void render();
 
     /**
      * @brief Libera los recursos asignados durante la ejecucin.
      */
-    void releaseResources();
+    void cleanup();
 
     /**
      * @brief Gestiona el movimiento de un actor en funcin del tiempo.
-     * @param elapsedTime Tiempo transcurrido desde el ltimo fotograma.
-     * @param actor Puntero compartido al actor que se desea mover.
+     * @param deltaTime Tiempo transcurrido desde el ltimo fotograma.
+     * @param circle Puntero compartido al actor que se desea mover.
      */
-    void manageActorMovement(float elapsedTime, EngineUtilities::TSharedPointer<Actor> actor);
+    void updateMovement(float deltaTime, EngineUtilities::TSharedPointer<Actor> circle);
+
+    /**
+     * @brief Avanza la trayectoria cuando el jugador entra al checkpoint activo.
+     * @param checkpointIndex ndice del checkpoint dentro de la trayectoria.
+     * @param event Evento de entrada generado por el sistema de volmenes.
+     */
+    void onCheckpointEntered(int checkpointIndex, const TriggerEvent& event);
+
+    /**
+     * @brief Activa el dibujo de la escena en un hilo propio (debe llamarse antes de ejecutar).
+     * @param enabled `true` para dibujar desde instantneas en el hilo de render.
+     */
+    void setThreadedRendering(bool enabled);
+
+    /**
+     * @brief Agrega actores de prueba que se mueven cada fotograma, para medir una escena cargada.
+     * @param count Cantidad de actores adicionales.
+     */
+    void setStressActorCount(int count);
+
+    /**
+     * @brief Activa el modo bajo demanda: solo se dibuja cuando llega entrada, cambia algn actor
+     * o hay una animacin activa; el resto de los fotogramas solo se simula.
+     * @param enabled `true` para omitir los fotogramas sin cambios.
+     */
+    void setOnDemandRendering(bool enabled);
+
+    /**
+     * @brief Tiempo mximo sin dibujar en el modo bajo demanda.
+     * @param seconds Segundos; 0 desactiva el redibujado forzado.
+     */
+    void setMaxIdleInterval(float seconds);
+
+    /**
+     * @brief Pide dibujar los prximos fotogramas aunque la escena no cambie
+     * (p. ej. una animacin que no mueve actores). Debe llamarse mientras la animacin siga activa.
+     */
+    void requestRedraw();
+
+    /**
+     * @brief Muestra la ventana "3D View" con un cubo girando dibujado por la tubera 3D en CPU
+     * (debe llamarse antes de ejecutar).
+     * @param enabled `true` para mostrarla.
+     */
+    void setShow3DView(bool enabled);
+
+    /**
+     * @brief Recarga las texturas cuando cambian sus archivos (debe llamarse antes de ejecutar).
+     * No se usa junto con el hilo de render, que dibuja con las texturas mientras se reemplazan.
+     * @param enabled `true` para vigilar el directorio de trabajo.
+     */
+    void setHotReload(bool enabled);
+
+    /**
+     * @brief Escribe el registro en formato binario (`LogData.glog`) en vez de texto; los mensajes
+     * de `GOMI_LOG` no se formatean al escribirlos: solo la consola arma las lneas que muestra (o
+     * que revisa su filtro de texto). Se lee con `--decode-log`.
+     */
+    void setBinaryLog(bool enabled);
+
+    /**
+     * @brief Ajusta el detalle de los crculos al tamao con el que se ven en la vista actual.
+     */
+    void updateLevelOfDetail();
+
+    /**
+     * @brief Copia el estado de dibujo de los actores y lo publica al hilo de render.
+     */
+    void submitSnapshot();
+
+    /**
+     * @brief Decide si el fotograma actual debe dibujarse en el modo bajo demanda.
+     * @return `true` si hubo entrada, cambios en la escena o en la consola, una animacin activa,
+     * o si se alcanz el tiempo mximo sin dibujar.
+     */
+    bool needsRedraw();
+
+    /**
+     * @brief Dibuja la escena 3D en CPU, la sube a una textura y la muestra en ImGui.
+     */
+    void render3DView();
+
+    /**
+     * @brief Muestra los tiempos de simulacin, render y fotograma.
+     */
+    void showFrameTimings();
 
 private:
-    sf::Clock m_timer; ///< Reloj para medir el tiempo entre fotogramas.
-    sf::Time m_elapsedTime; ///< Tiempo transcurrido entre fotogramas.
+    sf::Clock clock; ///< Reloj para medir el tiempo entre fotogramas.
+    sf::Time deltaTime; ///< Tiempo transcurrido entre fotogramas.
 
-    Window* m_mainWindow = nullptr; ///< Puntero a la ventana principal.
+    std::unique_ptr<Window> m_window; ///< Ventana principal.
 
     // Actores en la escena
-    EngineUtilities::TSharedPointer<Actor> m_triangleActor;
-    EngineUtilities::TSharedPointer<Actor> m_circleActor;
-    EngineUtilities::TSharedPointer<Actor> m_pathActor;
+    EngineUtilities::TSharedPointer<Actor> Triangle;
+    EngineUtilities::TSharedPointer<Actor> Circle;
+    EngineUtilities::TSharedPointer<Actor> Track;
 
-    std::vector<EngineUtilities::TSharedPointer<Actor>> m_sceneActors; ///< Lista de actores en escena.
+    std::vector<EngineUtilities::TSharedPointer<Actor>> m_actors; ///< Lista de actores en escena.
 
     // Puntos para definir trayectorias
-    Vector2 m_pathPoints[9];
-    int m_activePoint = 0; ///< Punto actual en la trayectoria.
-    int m_activeActor = 0; ///< Actor seleccionado actualmente.
+    Vector2 points[9];
+    int m_currentPoint = 0; ///< Punto actual en la trayectoria.
+
+    // Checkpoints de la trayectoria y el sistema que genera sus eventos
+    TriggerSystem m_triggerSystem; ///< Volmenes de disparo y cola de eventos del fotograma.
+    std::vector<EngineUtilities::TSharedPointer<Actor>> m_checkpoints; ///< Un checkpoint por punto de la trayectoria.
+
+    GUI m_GUI; ///< Interfaz grfica de usuario.
+
+    BatchRenderer m_batchRenderer; ///< Agrupa las formas de los actores en lotes por textura.
+    RenderQueue m_renderQueue; ///< Comandos del fotograma ordenados por capa, textura y material.
+    RenderThread m_renderThread; ///< Dibuja las instantneas de la escena en un hilo propio.
+    bool m_threadedRendering = false; ///< La escena se dibuja en el hilo de render.
+    std::vector<EngineUtilities::TSharedPointer<Actor>> m_stressActors; ///< Actores de prueba (fuera de la jerarqua).
+    int m_stressActorCount = 0; ///< Actores de prueba a crear al inicializar.
+    float m_simulationMs = 0.0f; ///< Duracin de la actualizacin del ltimo fotograma.
+    float m_sceneRenderMs = 0.0f; ///< Duracin del dibujo de la escena (en el hilo que la dibuje).
+    size_t m_sceneDrawCalls = 0; ///< Llamadas de dibujo de la escena en el ltimo fotograma.
+    size_t m_previewDrawCalls = 0; ///< Llamadas de dibujo de la vista previa en el ltimo fotograma.
+    size_t m_unbatchedDrawCalls = 0; ///< Llamadas que hara la escena con una por forma (sin lotes ni horneado).
+    float m_frameMs = 0.0f; ///< Duracin total del ltimo fotograma del hilo principal.
+    int m_lodChanges = 0; ///< Crculos que cambiaron de nivel de detalle en el ltimo fotograma.
+    std::unique_ptr<RenderViewport> m_previewViewport; ///< Vista previa del jugador (comparte el pool de la ventana).
+    StaticRenderLayer m_staticLayer; ///< Geometra horneada de los actores estticos (la pista).
+    TextureHandle m_trackTexture; ///< Textura de la pista (la mantiene en la cach).
+    SpriteRegion m_playerSprite; ///< Sprite del jugador (mantiene su atlas en la cach).
+    bool m_hotReload = false; ///< Recargar las texturas cuando cambian sus archivos.
+    StartupTimeline m_startupTimeline; ///< Fases del arranque hasta el primer fotograma.
+    std::vector<TextureHandle> m_preloadedTextures; ///< Texturas del manifiesto (las mantiene en la cach).
+    static constexpr const char* PRELOAD_MANIFEST = "Preload.manifest"; ///< Manifiesto de recursos por escena.
+    static constexpr const char* PRELOAD_SCENE = "Race"; ///< Escena que se carga al arrancar.
+    LogSink m_logSink; ///< Escribe el registro en disco desde su propio hilo.
+    LogConsole m_logConsole; ///< Ventana del registro; lee el historial sin copiarlo.
+    static constexpr const char* LOG_FILE = "LogData.txt"; ///< Archivo del registro.
+    static constexpr const char* BINARY_LOG_FILE = "LogData.glog"; ///< Archivo del registro binario.
+    bool m_binaryLog = false; ///< Escribir el registro en formato binario.
+    static constexpr size_t LOG_FILE_MAX_BYTES = 4 * 1024 * 1024; ///< Tamao a partir del cual se rota el registro.
+    static constexpr int LOG_FILE_COUNT = 3; ///< Archivos de registro que se conservan (el actual y dos anteriores).
+    static constexpr float TEXTURE_UPLOAD_BUDGET_MS = 2.0f; ///< Tiempo por fotograma para subir texturas cargadas en segundo plano.
 
-    // Texturas utilizadas en la aplicacin
-    sf::Texture m_backgroundTexture;
-    sf::Texture m_characterTexture;
+    static constexpr int REDRAW_SETTLE_FRAMES = 3; ///< Fotogramas dibujados tras un cambio (ImGui necesita varios para asentarse).
+    bool m_onDemandRendering = false; ///< Omitir los fotogramas sin cambios.
+    sf::Time m_maxIdleInterval = sf::seconds(1.0f); ///< Tiempo mximo sin dibujar (0 = sin lmite).
+    sf::Clock m_idleClock; ///< Tiempo desde el ltimo fotograma dibujado.
+    int m_pendingRedrawFrames = REDRAW_SETTLE_FRAMES; ///< Fotogramas que an se deben dibujar.
+    uint64_t m_lastSceneVersion = 0; ///< Suma de versiones de actores y formas en el ltimo control.
+    size_t m_lastEventCount = 0; ///< Eventos de la ventana en el ltimo control.
+    size_t m_lastMessageCount = 0; ///< Mensajes de la consola en el ltimo control.
+    unsigned long long m_renderedFrameCount = 0; ///< Fotogramas dibujados.
+    unsigned long long m_skippedFrameCount = 0; ///< Fotogramas omitidos por no tener cambios.
 
-    GUI m_userInterface; ///< Interfaz grfica de usuario.
+    bool m_show3DView = false; ///< Mostrar la ventana "3D View".
+    std::unique_ptr<SoftwareRenderer3D> m_renderer3D; ///< Tubera 3D en CPU.
+    std::vector<Vertex3D> m_cubeMesh; ///< Cubo de demostracin.
+    std::vector<uint8_t> m_view3DPixels; ///< Imagen lineal antes de subirla.
+    sf::Texture m_view3DTexture; ///< Textura mostrada en ImGui.
+    float m_view3DAngle = 0.0f; ///< Giro del cubo en radianes.
+    float m_view3DMs = 0.0f; ///< Duracin del ltimo dibujo 3D.
 };
@@ -0,0 +1,136 @@
+#pragma once
+#include "Prerequisites.h"
+#include "ShapeFactory.h"
+
+class Window;
+class RenderBackend;
+
+/**
+ * @class BatchRenderer
+ * @brief Agrupa las formas que comparten textura y modo de mezcla en un solo `sf::VertexArray`.
+ *
+ * Las formas se envían en orden de dibujo; cada racha de formas consecutivas con la misma
+ * textura y el mismo modo de mezcla se convierte en un lote de triángulos transformados en CPU,
+ * que se dibuja con una sola llamada. El orden de dibujo se conserva. Los arreglos de vértices
+ * se reutilizan entre fotogramas, y su contenido se puede inspeccionar sin ventana ni GPU.
+ */
+class BatchRenderer {
+public:
+    /**
+     * @struct Batch
+     * @brief Lote de vértices que se dibuja con una sola llamada.
+     */
+    struct Batch {
+        const sf::Texture* texture = nullptr;     ///< Textura compartida por el lote (puede ser nula).
+        sf::BlendMode blendMode = sf::BlendAlpha; ///< Modo de mezcla compartido por el lote.
+        sf::VertexArray vertices{ sf::Triangles }; ///< Triángulos en coordenadas de mundo.
+        const sf::Drawable* drawable = nullptr;   ///< Forma que no se puede agrupar y se dibuja directamente.
+    };
+
+    BatchRenderer() = default; ///< Constructor por defecto.
+    ~BatchRenderer() = default; ///< Destructor por defecto.
+
+    /**
+     * @brief Inicia un fotograma: vacía los lotes conservando su memoria y reinicia el conteo de llamadas.
+     */
+    void begin();
+
+    /**
+     * @brief Agrega la forma de un `ShapeFactory` a los lotes.
+     * @param shape Componente de forma a dibujar.
+     * @param blendMode Modo de mezcla con el que se dibuja.
+     */
+    void submit(const ShapeFactory& shape, const sf::BlendMode& blendMode = sf::BlendAlpha);
+
+    /**
+     * @brief Agrega una forma SFML a los lotes.
+     * Las formas con contorno se dibujan directamente porque su geometría no se genera aquí.
+     * @param shape Forma a dibujar.
+     * @param blendMode Modo de mezcla con el que se dibuja.
+     */
+    void submit(const sf::Shape& shape, const sf::BlendMode& blendMode = sf::BlendAlpha);
+
+    /**
+     * @brief Agrega un polígono convexo descrito por sus puntos locales.
+     * @param points Puntos en coordenadas locales.
+     * @param pointCount Cantidad de puntos.
+     * @param transform Transformación local a mundo.
+     * @param color Color de relleno.
+     * @param textureRect Región de la textura en píxeles.
+     * @param texture Textura (puede ser nula).
+     * @param blendMode Modo de mezcla con el que se dibuja.
+     */
+    void submitPolygon(const sf::Vector2f* points, size_t pointCount,
+                       const sf::Transform& transform, const sf::Color& color,
+                       const sf::IntRect& textureRect, const sf::Texture* texture,
+                       const sf::BlendMode& blendMode = sf::BlendAlpha);
+
+    /**
+     * @brief Dibuja todos los lotes del fotograma, una llamada por lote.
+     * @param window Ventana donde se dibuja.
+     */
+    void flush(Window& window);
+
+    /**
+     * @brief Dibuja todos los lotes del fotograma en un destino de SFML.
+     * @param target Ventana o textura de render donde se dibuja.
+     */
+    void flush(sf::RenderTarget& target);
+
+    /**
+     * @brief Dibuja todos los lotes del fotograma en un backend (p. ej. el rasterizador por software).
+     * @param backend Backend donde se dibuja.
+     */
+    void flush(RenderBackend& backend);
+
+    /**
+     * @brief Genera los triángulos transformados de una forma convexa.
+     * Las coordenadas de textura se calculan igual que en `sf::Shape`.
+     * @param shape Forma de origen.
+     * @param out Arreglo al que se agregan los vértices.
+     */
+    static void appendShapeVertices(const sf::Shape& shape, sf::VertexArray& out);
+
+    /**
+     * @brief Genera los triángulos transformados de un polígono convexo dado por sus puntos.
+     */
+    static void appendPolygonVertices(const sf::Vector2f* points, size_t pointCount,
+                                      const sf::Transform& transform, const sf::Color& color,
+                                      const sf::IntRect& textureRect, sf::VertexArray& out);
+
+    // Inspección de los lotes del fotograma actual.
+    size_t getBatchCount() const { return m_batchCount; }
+    const Batch& getBatch(size_t index) const { return m_batches[index]; }
+
+    /**
+     * @brief Formas enviadas en el fotograma (equivale a las llamadas de dibujo sin agrupar).
+     */
+    size_t getSubmittedCount() const { return m_submittedCount; }
+
+    /**
+     * @brief Llamadas de dibujo emitidas desde `begin`, sumando cada `flush` del fotograma
+     * (p. ej. la escena y la vista previa).
+     */
+    size_t getDrawCallCount() const { return m_drawCallCount; }
+
+    /**
+     * @brief Total de vértices en los lotes del fotograma.
+     */
+    size_t getVertexCount() const;
+
+private:
+    /**
+     * @brief Devuelve el lote al final de la lista si es compatible, o abre uno nuevo.
+     */
+    Batch& batchFor(const sf::Texture* texture, const sf::BlendMode& blendMode);
+
+    /**
+     * @brief Abre siempre un lote nuevo al final de la lista.
+     */
+    Batch& openBatch(const sf::Texture* texture, const sf::BlendMode& blendMode);
+
+    std::vector<Batch> m_batches; ///< Lotes reutilizados entre fotogramas.
+    size_t m_batchCount = 0;      ///< Lotes en uso en el fotograma actual.
+    size_t m_submittedCount = 0;  ///< Formas enviadas en el fotograma actual.
+    size_t m_drawCallCount = 0;   ///< Llamadas de dibujo desde `begin`.
+};
@@ -2,10 +2,10 @@
 class Window;
 
 /**
- * @enum ComponentCategory
+ * @enum ComponentType
  * @brief Define los tipos de componentes disponibles en el sistema.
  */
-enum ComponentCategory {
+enum ComponentType {
     UNDEFINED = 0,
     TRANSFORM = 1,
     SPRITE = 2,
@@ -13,26 +13,28 @@ enum ComponentCategory {
     PHYSICS = 4,
     AUDIO_SOURCE = 5,
     SHAPE = 6,
-    TEXTURE = 7
+    TEXTURE = 7,
+    TRIGGER = 8,
+    MESH = 9
 };
 
 /**
- * @class GameComponent
+ * @class Component
  * @brief Clase abstracta base para todos los componentes de un juego.
  * Proporciona una interfaz para actualizar y renderizar componentes,
  * y permite identificar su categoría.
  */
-class GameComponent {
+class Component {
 public:
-    GameComponent() = default; ///< Constructor por defecto.
+    Component() = default; ///< Constructor por defecto.
 
     /**
      * @brief Constructor que inicializa el componente con una categoría específica.
-     * @param category Tipo del componente.
+     * @param type Tipo del componente.
      */
-    explicit GameComponent(ComponentCategory category) : m_category(category) {}
+    explicit Component(ComponentType type) : m_type(type) {}
 
-    virtual ~GameComponent() = default; ///< Destructor virtual para limpieza segura.
+    virtual ~Component() = default; ///< Destructor virtual para limpieza segura.
 
     /**
      * @brief Método abstracto para actualizar el estado del componente.
@@ -50,8 +52,8 @@ public:
      * @brief Devuelve la categoría del componente.
      * @return Categoría del componente.
      */
-    ComponentCategory getCategory() const { return m_category; }
+    ComponentType getType() const { return m_type; }
 
 protected:
-    ComponentCategory m_category = UNDEFINED; ///< Categoría del componente.
+    ComponentType m_type = UNDEFINED; ///< Categoría del componente.
 };
@@ -5,13 +5,13 @@
 class Window;
 
 /**
- * @class GameEntity
+ * @class Entity
  * @brief Clase base abstracta que representa una entidad dentro del juego.
  * Las entidades pueden contener múltiples componentes para definir su comportamiento.
  */
-class GameEntity {
+class Entity {
 public:
-    virtual ~GameEntity() = default; ///< Destructor virtual para limpieza segura.
+    virtual ~Entity() = default; ///< Destructor virtual para limpieza segura.
 
     /**
      * @brief Método abstracto para actualizar la entidad.
@@ -31,9 +31,9 @@ public:
      * @param component Puntero compartido al componente a añadir.
      */
     template <typename T>
-    void attachComponent(EngineUtilities::TSharedPointer<T> component) {
+    void addComponent(EngineUtilities::TSharedPointer<T> component) {
         static_assert(std::is_base_of<Component, T>::value, "El tipo T debe derivar de Component");
-        m_components.push_back(component.template dynamic_pointer_cast<Component>());
+        components.push_back(component.template dynamic_pointer_cast<Component>());
     }
 
     /**
@@ -42,8 +42,8 @@ public:
      * @return Puntero compartido al componente encontrado, o nullptr si no existe.
      */
     template <typename T>
-    EngineUtilities::TSharedPointer<T> fetchComponent() const {
-        for (const auto& component : m_components) {
+    EngineUtilities::TSharedPointer<T> getComponent() const {
+        for (const auto& component : components) {
             EngineUtilities::TSharedPointer<T> specificComponent = component.template dynamic_pointer_cast<T>();
             if (specificComponent) {
                 return specificComponent;
@@ -56,5 +56,5 @@ protected:
     bool m_isActive = true; ///< Indica si la entidad está activa.
     int m_id = 0; ///< Identificador único de la entidad.
 
-    std::vector<EngineUtilities::TSharedPointer<Component>> m_components; ///< Lista de componentes adjuntos a la entidad.
+    std::vector<EngineUtilities::TSharedPointer<Component>> components; ///< Lista de componentes adjuntos a la entidad.
 };
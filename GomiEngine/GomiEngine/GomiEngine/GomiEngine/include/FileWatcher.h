@@ -0,0 +1,92 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class FileWatcher
+ * @brief Vigila directorios en un hilo propio y junta los cambios de archivos.
+ *
+ * Usa `inotify` en Linux y `ReadDirectoryChangesW` en Windows. Los editores suelen escribir un
+ * archivo en varias operaciones (truncar, escribir, renombrar), así que cada ruta se entrega una
+ * sola vez, cuando lleva `setCoalesceDelay` milisegundos sin nuevos eventos. `poll` no toca el
+ * disco: solo revisa la lista que llena el hilo del vigilante.
+ */
+class FileWatcher {
+public:
+    FileWatcher(); ///< Constructor por defecto (sin directorios).
+
+    /**
+     * @brief Detiene el hilo y libera los recursos del sistema.
+     */
+    ~FileWatcher();
+
+    // Deshabilitar copia y asignación
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    /**
+     * @brief Agrega un directorio a vigilar. Se llama antes de `start`.
+     * @param directory Ruta del directorio.
+     * @param recursive Incluir los subdirectorios.
+     * @return true si el sistema aceptó el directorio.
+     */
+    bool addDirectory(const std::string& directory, bool recursive = true);
+
+    /**
+     * @brief Inicia el hilo del vigilante.
+     * @return true si el hilo está corriendo.
+     */
+    bool start();
+
+    /**
+     * @brief Detiene el hilo (tarda a lo sumo un intervalo de espera).
+     */
+    void stop();
+
+    /**
+     * @brief Tiempo sin eventos que debe pasar antes de entregar un archivo.
+     */
+    void setCoalesceDelay(float milliseconds) { m_coalesceDelayMs = milliseconds; }
+
+    /**
+     * @brief Entrega los archivos que cambiaron y ya se asentaron. No bloquea.
+     * @param changedFiles Recibe las rutas (con '/' como separador) al final.
+     * @return Cantidad de rutas agregadas.
+     */
+    size_t poll(std::vector<std::string>& changedFiles);
+
+    bool isRunning() const { return m_running.load(); } ///< Indica si el hilo está corriendo.
+
+private:
+    /**
+     * @struct Watch
+     * @brief Directorio vigilado; su contenido depende del sistema (ver FileWatcher.cpp).
+     */
+    struct Watch;
+
+    /**
+     * @brief Ciclo del hilo: espera eventos y los anota en `m_pending`.
+     */
+    void run();
+
+    /**
+     * @brief Anota un cambio; si la ruta ya estaba pendiente, reinicia su espera.
+     */
+    void recordChange(const std::string& path);
+
+    std::vector<std::unique_ptr<Watch>> m_watches; ///< Directorios vigilados.
+    std::thread m_thread;                          ///< Hilo del vigilante.
+    std::atomic<bool> m_running{ false };          ///< El hilo debe seguir corriendo.
+    std::mutex m_mutex;                            ///< Protege `m_pending`.
+    std::unordered_map<std::string, std::chrono::steady_clock::time_point> m_pending; ///< Ruta -> último evento.
+    float m_coalesceDelayMs = 150.0f;              ///< Espera sin eventos antes de entregar.
+#ifndef _WIN32
+    int m_inotify = -1;                            ///< Descriptor de inotify.
+#endif
+};
@@ -6,14 +6,14 @@
 class Window;
 
 /**
- * @class InterfaceManager
+ * @class GUI
  * @brief Clase responsable de gestionar la interfaz grfica de usuario (GUI) del sistema.
  * Permite la interaccin con elementos visuales y herramientas de depuracin.
  */
-class InterfaceManager {
+class GUI {
 public:
-    InterfaceManager() = default; ///< Constructor por defecto.
-    ~InterfaceManager() = default; ///< Destructor por defecto.
+    GUI() = default; ///< Constructor por defecto.
+    ~GUI() = default; ///< Destructor por defecto.
 
     /**
      * @brief Inicializa los recursos necesarios para la GUI.
@@ -23,7 +23,7 @@ public:
     /**
      * @brief Actualiza los elementos interactivos de la GUI en cada fotograma.
      */
-    void refresh();
+    void updateInterface();
 
     /**
      * @brief Dibuja la GUI en pantalla.
@@ -33,7 +33,7 @@ public:
     /**
      * @brief Libera los recursos asociados a la GUI.
      */
-    void release();
+    void releaseResources();
 
     /**
      * @brief Configura el estilo visual y temtico de la interfaz.
@@ -42,31 +42,31 @@ public:
 
     /**
      * @brief Muestra una consola de mensajes categorizados (errores, advertencias, informacin).
-     * @param logMessages Mapa de mensajes clasificados por tipo.
+     * @param messages Mapa de mensajes clasificados por tipo.
      */
-    void displayConsole(const std::map<ConsolErrorType, std::string>& logMessages);
+    void showConsole(std::map<ConsolErrorType, std::string> messages);
 
     /**
      * @brief Presenta un men jerrquico para gestionar los actores de la escena.
-     * @param actorList Lista de actores disponibles en la aplicacin.
+     * @param actors Lista de actores disponibles en la aplicacin (los botones agregan actores).
      */
-    void displayHierarchy(const std::vector<EngineUtilities::TSharedPointer<Actor>>& actorList);
+    void showHierarchy(std::vector<EngineUtilities::TSharedPointer<Actor>>& actors);
 
     /**
      * @brief Proporciona un panel para visualizar y modificar las propiedades del actor seleccionado.
      */
-    void displayInspector();
+    void showInspector();
 
     /**
      * @brief Crea un control de interfaz para manipular valores de tipo `vec2`.
      * @param label Etiqueta del control.
      * @param values Puntero a los valores flotantes a modificar.
-     * @param defaultValue Valor inicial al que se puede restablecer.
+     * @param resetValue Valor mnimo del control.
      * @param columnWidth Ancho de la columna para la etiqueta.
      */
-    void vector2Control(const std::string& label,
+    void displayVec2Control(const std::string& label,
         float* values,
-        float defaultValue = 0.0f,
+        float resetValue = 0.0f,
         float columnWidth = 100.0f);
 
 private:
@@ -0,0 +1,26 @@
+#pragma once
+#include <cstddef>
+
+namespace EngineUtilities {
+	// Valores iniciales de FNV-1a de 64 bits.
+	constexpr unsigned long long FNV_OFFSET_BASIS = 14695981039346656037ull;
+	constexpr unsigned long long FNV_PRIME = 1099511628211ull;
+
+	/**
+	 * Calcula el hash FNV-1a de 64 bits de un bloque de memoria.
+	 *
+	 * Es estable entre plataformas y ejecuciones, por lo que sirve para identificar
+	 * contenido guardado en disco (cachés, archivos empaquetados).
+	 */
+	inline unsigned long long hashFNV1a(const void* data, size_t size,
+	                                    unsigned long long hash = FNV_OFFSET_BASIS)
+	{
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash ^= bytes[i];
+			hash *= FNV_PRIME;
+		}
+		return hash;
+	}
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include "LogHistory.h"
+#include <deque>
+
+/**
+ * @class LogConsole
+ * @brief Ventana "Console" que lee el historial del registro sin copiarlo.
+ *
+ * Solo se dibujan las líneas visibles (`ImGuiListClipper`), así que el costo por fotograma no
+ * depende de cuántos mensajes haya; los mensajes de `GOMI_LOG` se formatean al dibujarlos o al
+ * revisarlos contra el filtro de texto. Con filtros (severidad o texto) se mantiene un índice con las
+ * secuencias que pasan: cada fotograma solo revisa los mensajes nuevos y saca del frente los que el
+ * historial descartó. Cambiar un filtro rehace el índice en varios fotogramas, revisando mensajes
+ * hasta gastar `setIndexBudget` milisegundos; mientras tanto se muestra lo ya indexado.
+ */
+class LogConsole {
+public:
+    /**
+     * @brief Dibuja la ventana. Llamar una vez por fotograma desde el hilo principal, después de
+     * `NotificationService::pump`.
+     */
+    void draw(const LogHistory& history);
+
+    /**
+     * @brief Cambia los filtros como si se editaran en la ventana (rehace el índice).
+     * @param text Filtro de texto de `ImGuiTextFilter` ("a,b" = a o b, "-a" = sin a).
+     */
+    void setFilter(const char* text, bool showNormal, bool showWarning, bool showError);
+
+    /**
+     * @brief Tiempo máximo por fotograma para revisar mensajes al rehacer el índice.
+     */
+    void setIndexBudget(float milliseconds) { m_indexBudgetMs = milliseconds; }
+
+    /**
+     * @brief Detiene la vista en los mensajes actuales; los nuevos se siguen indexando.
+     */
+    void setPaused(bool paused, const LogHistory& history);
+
+    float getLastDrawMs() const { return m_lastDrawMs; } ///< Duración del último `draw`.
+    size_t getVisibleCount() const { return m_rowCount; } ///< Mensajes que pasan los filtros (último `draw`).
+
+    /**
+     * @brief Indica si el índice ya revisó todo el historial.
+     */
+    bool isIndexComplete(const LogHistory& history) const {
+        return !isFiltered() || m_indexedEnd >= history.getEndSequence();
+    }
+
+private:
+    bool isFiltered() const;                     ///< Algún filtro oculta mensajes.
+    bool matches(const LogLine& line) const;     ///< El mensaje pasa los filtros.
+    void invalidateIndex();                      ///< Los filtros cambiaron: el índice se rehace.
+    uint64_t getStartSequence(const LogHistory& history) const; ///< Primer mensaje que se muestra.
+
+    /**
+     * @brief Saca del índice lo descartado y agrega los mensajes sin revisar, hasta el presupuesto.
+     */
+    void updateIndex(const LogHistory& history);
+
+    /**
+     * @brief Dibuja las `m_rowCount` líneas desde `start` (o del índice, si hay filtros), solo las visibles.
+     */
+    void drawLines(const LogHistory& history, uint64_t start);
+
+    ImGuiTextFilter m_filter;                      ///< Filtro de texto.
+    bool m_showSeverity[3] = { true, true, true }; ///< NORMAL, WARNING, ERROR.
+    std::deque<uint64_t> m_index;                  ///< Secuencias que pasan los filtros, en orden.
+    uint64_t m_indexedEnd = 0;                     ///< Siguiente secuencia sin revisar.
+    float m_indexBudgetMs = 0.5f;                  ///< Tiempo para rehacer el índice por fotograma.
+
+    bool m_autoScroll = true;      ///< Seguir los mensajes nuevos si la vista está al final.
+    bool m_paused = false;         ///< La vista no avanza.
+    uint64_t m_pausedEnd = 0;      ///< Fin de la vista mientras está en pausa.
+    uint64_t m_clearedBefore = 0;  ///< "Clear" oculta los mensajes anteriores a esta secuencia.
+    size_t m_rowCount = 0;         ///< Líneas del último `draw`.
+    float m_lastDrawMs = 0.0f;     ///< Duración del último `draw`.
+};
@@ -0,0 +1,160 @@
+#pragma once
+#include "Prerequisites.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <string_view>
+
+/**
+ * @struct LogLine
+ * @brief Mensaje del historial, leído sin copiar: `text` apunta al almacén del historial y es
+ * válido hasta que el mensaje se descarta (o hasta `clear`).
+ */
+struct LogLine {
+  uint64_t timestampNs = 0;          ///< Nanosegundos desde que se creó el registro.
+  const char* source = "";           ///< Origen del mensaje.
+  const LogFormat* format = nullptr; ///< Formato de `GOMI_LOG` (nulo si `text` ya es texto).
+  ConsolErrorType severity = NORMAL; ///< Severidad.
+  uint32_t threadId = 0;             ///< Hilo que lo escribió.
+  std::string_view text;             ///< Texto (sin terminador), o los argumentos si hay `format`.
+
+  /**
+   * @brief Texto del mensaje. Los de `GOMI_LOG` se formatean aquí, solo cuando alguien los lee.
+   * @param buffer Destino del texto formateado (se recomienda `LOG_MESSAGE_BYTES`).
+   */
+  std::string_view
+  getText(char* buffer, size_t capacity) const {
+    if (format == nullptr) {
+      return text;
+    }
+    size_t length = formatStructuredMessage(format->format, reinterpret_cast<const uint8_t*>(text.data()),
+                                            text.size(), buffer, capacity);
+    return std::string_view(buffer, length);
+  }
+};
+
+/**
+ * @class LogHistory
+ * @brief Mensajes consumidos del registro, pensado para cientos de miles o millones de líneas.
+ *
+ * Cada mensaje recibe un número de secuencia creciente que no cambia aunque se descarten los más
+ * antiguos, así que quien indexe el historial (la consola) puede guardar secuencias y agregar
+ * solo lo nuevo. Los mensajes de `GOMI_LOG` se guardan sin formatear (el formato y los argumentos)
+ * y se arman al leerlos con `LogLine::getText`. Los textos se copian uno tras otro en bloques de `BLOCK_SIZE` bytes y cada línea
+ * guarda solo su posición: agregar no reserva memoria salvo al abrir un bloque, y al pasar de
+ * `capacity` mensajes se liberan los bloques que ya no usa nadie.
+ */
+class
+LogHistory {
+public:
+  /**
+   * @param capacity Mensajes que se conservan; al pasarla se descartan los más antiguos.
+   */
+  explicit LogHistory(size_t capacity) : m_capacity(capacity > 0 ? capacity : 1) {}
+
+  /**
+   * @brief Agrega un mensaje al final (los textos mayores que un bloque se recortan).
+   * @param format Formato de `GOMI_LOG`; si no es nulo, `text` son sus argumentos codificados.
+   */
+  void
+  append(uint64_t timestampNs, const char* source, ConsolErrorType severity, uint32_t threadId,
+         const LogFormat* format, std::string_view text) {
+    if (m_lines.size() == m_capacity) {
+      m_lines.pop_front();
+      ++m_firstSequence;
+      releaseUnusedBlocks();
+    }
+
+    // Un texto vacío no ocupa bloque: su posición puede quedar justo al final del último.
+    size_t length = std::min(text.size(), BLOCK_SIZE);
+    if (length > 0) {
+      if (m_blocks.empty() || m_writeOffset + length > m_blockBase + m_blocks.size() * BLOCK_SIZE) {
+        // El texto no cabe en lo que queda del bloque: se abre otro y el resto se desperdicia.
+        m_blocks.emplace_back(new char[BLOCK_SIZE]);
+        m_writeOffset = m_blockBase + (m_blocks.size() - 1) * BLOCK_SIZE;
+      }
+      std::memcpy(blockAt(m_writeOffset), text.data(), length);
+    }
+    m_lines.push_back({ timestampNs, source, format, m_writeOffset, threadId, static_cast<uint32_t>(length),
+                        static_cast<uint8_t>(severity) });
+    m_writeOffset += length;
+  }
+
+  /**
+   * @brief Mensaje con secuencia `sequence`, que debe estar en [getFirstSequence, getEndSequence).
+   */
+  LogLine
+  at(uint64_t sequence) const {
+    const Line& line = m_lines[static_cast<size_t>(sequence - m_firstSequence)];
+    std::string_view text = line.length > 0 ? std::string_view(blockAt(line.offset), line.length) : std::string_view();
+    return { line.timestampNs, line.source, line.format, static_cast<ConsolErrorType>(line.severity),
+             line.threadId, text };
+  }
+
+  /**
+   * @brief Descarta todos los mensajes (las secuencias siguen creciendo).
+   */
+  void
+  clear() {
+    m_firstSequence += m_lines.size();
+    m_lines.clear();
+    m_blocks.clear();
+    m_blockBase = m_writeOffset;
+  }
+
+  uint64_t getFirstSequence() const { return m_firstSequence; }                ///< Secuencia del más antiguo.
+  uint64_t getEndSequence() const { return m_firstSequence + m_lines.size(); } ///< Secuencia del siguiente.
+  size_t size() const { return m_lines.size(); }                               ///< Mensajes guardados.
+  bool empty() const { return m_lines.empty(); }                               ///< No hay mensajes.
+  size_t getCapacity() const { return m_capacity; }                            ///< Mensajes que caben.
+
+  /**
+   * @brief Memoria usada por las líneas y los bloques de texto.
+   */
+  size_t
+  getMemoryBytes() const {
+    return m_lines.size() * sizeof(Line) + m_blocks.size() * BLOCK_SIZE;
+  }
+
+  static constexpr size_t BLOCK_SIZE = 1024 * 1024; ///< Bytes por bloque de texto.
+
+private:
+  /**
+   * @struct Line
+   * @brief Mensaje guardado; el texto se ubica por su posición global en los bloques.
+   */
+  struct Line {
+    uint64_t timestampNs;
+    const char* source;
+    const LogFormat* format;
+    uint64_t offset;
+    uint32_t threadId;
+    uint32_t length;
+    uint8_t severity;
+  };
+
+  char*
+  blockAt(uint64_t offset) const {
+    uint64_t relative = offset - m_blockBase;
+    return m_blocks[static_cast<size_t>(relative / BLOCK_SIZE)].get() + relative % BLOCK_SIZE;
+  }
+
+  // Libera los bloques anteriores al texto del mensaje más antiguo.
+  void
+  releaseUnusedBlocks() {
+    uint64_t oldest = m_lines.empty() ? m_writeOffset : m_lines.front().offset;
+    while (m_blocks.size() > 1 && oldest >= m_blockBase + BLOCK_SIZE) {
+      m_blocks.pop_front();
+      m_blockBase += BLOCK_SIZE;
+    }
+  }
+
+  size_t m_capacity;                          ///< Mensajes que se conservan.
+  std::deque<Line> m_lines;                   ///< Mensajes, del más antiguo al más nuevo.
+  std::deque<std::unique_ptr<char[]>> m_blocks; ///< Bloques de texto.
+  uint64_t m_firstSequence = 0;               ///< Secuencia de `m_lines.front()`.
+  uint64_t m_blockBase = 0;                   ///< Posición global del primer byte de `m_blocks.front()`.
+  uint64_t m_writeOffset = 0;                 ///< Posición global donde va el siguiente texto.
+};
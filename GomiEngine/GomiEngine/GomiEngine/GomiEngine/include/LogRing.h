@@ -0,0 +1,168 @@
+#pragma once
+#include "Prerequisites.h"
+#include "StructuredLog.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @struct LogRecord
+ * @brief Mensaje del registro con tamaño fijo, para copiarlo al búfer circular sin reservar memoria.
+ */
+struct LogRecord {
+  static constexpr size_t MAX_TEXT = LOG_RECORD_TEXT_BYTES; ///< Bytes de texto (incluido el terminador); lo demás se recorta.
+
+  uint64_t timestampNs = 0;                 ///< Nanosegundos desde que se creó el registro.
+  const char* source = "";                  ///< Origen del mensaje (cadena estática, p. ej. "ResourceManager").
+  const LogFormat* format = nullptr;        ///< Formato de un mensaje de `GOMI_LOG` (nulo si `text` ya es texto).
+  ConsolErrorType severity = NORMAL;        ///< Severidad.
+  uint32_t threadId = 0;                    ///< Identificador corto del hilo que lo escribió.
+  uint32_t length = 0;                      ///< Bytes usados de `text`.
+  char text[MAX_TEXT] = {};                 ///< Texto terminado en nulo, o los argumentos si hay `format`.
+};
+
+/**
+ * @enum LogOverflow
+ * @brief Qué hacer cuando el búfer está lleno. En ningún caso el productor espera.
+ */
+enum class LogOverflow {
+  DROP_NEWEST, ///< Se descarta el mensaje nuevo.
+  DROP_OLDEST  ///< Se descarta el mensaje más antiguo para dejar lugar al nuevo.
+};
+
+/**
+ * @class LogRing
+ * @brief Búfer circular acotado y sin bloqueos para varios productores (cola de Vyukov).
+ *
+ * Cada celda lleva un número de secuencia que indica si está libre para el productor de la
+ * vuelta actual o lista para el consumidor, así que escribir solo cuesta un compare-exchange
+ * sobre la posición de escritura y la copia del mensaje en su celda. Los productores nunca
+ * esperan: con el búfer lleno aplican la política de `LogOverflow` y cuentan el descarte.
+ * Puede haber varios consumidores, aunque el motor usa uno solo.
+ */
+class
+LogRing {
+public:
+  /**
+   * @brief Crea el búfer.
+   * @param capacity Cantidad de mensajes (se redondea a potencia de dos).
+   * @param overflow Política cuando el búfer está lleno.
+   */
+  explicit LogRing(size_t capacity, LogOverflow overflow = LogOverflow::DROP_NEWEST)
+    : m_overflow(overflow) {
+    size_t size = 2;
+    while (size < capacity) {
+      size <<= 1;
+    }
+    m_mask = size - 1;
+    m_cells.reset(new Cell[size]);
+    for (size_t i = 0; i < size; ++i) {
+      m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  // Deshabilitar copia y asignación
+  LogRing(const LogRing&) = delete;
+  LogRing& operator=(const LogRing&) = delete;
+
+  /**
+   * @brief Reserva una celda y deja que `fill` escriba el mensaje directamente en ella.
+   * @param fill Función `void(LogRecord&)`; recibe una celda con datos de la vuelta anterior.
+   * @return false si el mensaje se descartó por falta de lugar.
+   */
+  template<typename Fill>
+  bool
+  push(Fill&& fill) {
+    size_t position = m_writePosition.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    for (;;) {
+      cell = &m_cells[position & m_mask];
+      size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+      if (difference == 0) {
+        if (m_writePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      }
+      else if (difference < 0) {
+        // Lleno: se libera el más antiguo y se vuelve a intentar. Si la política es descartar el
+        // nuevo, o el más antiguo aún se está escribiendo, se descarta el nuevo sin esperar.
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        if (getOverflow() == LogOverflow::DROP_NEWEST || !popInto(nullptr)) {
+          return false;
+        }
+        position = m_writePosition.load(std::memory_order_relaxed);
+      }
+      else {
+        position = m_writePosition.load(std::memory_order_relaxed);
+      }
+    }
+    fill(cell->record);
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Saca el mensaje más antiguo.
+   * @return false si el búfer está vacío (o el siguiente mensaje aún se está escribiendo).
+   */
+  bool
+  pop(LogRecord& record) {
+    return popInto(&record);
+  }
+
+  void setOverflow(LogOverflow overflow) { m_overflow.store(overflow, std::memory_order_relaxed); } ///< Cambia la política.
+  LogOverflow getOverflow() const { return m_overflow.load(std::memory_order_relaxed); }            ///< Política de desborde.
+  size_t getCapacity() const { return m_mask + 1; }                 ///< Mensajes que caben.
+  uint64_t getPushedCount() const { return m_writePosition.load(std::memory_order_relaxed); } ///< Mensajes escritos.
+
+  /**
+   * @brief Mensajes descartados desde la creación (nuevos o antiguos, según la política).
+   */
+  uint64_t getDroppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+  /**
+   * @struct Cell
+   * @brief Mensaje y su secuencia, en su propia línea de caché.
+   */
+  struct alignas(64) Cell {
+    std::atomic<size_t> sequence{ 0 };
+    LogRecord record;
+  };
+
+  // Saca un mensaje; con `record` nulo solo lo descarta.
+  bool
+  popInto(LogRecord* record) {
+    size_t position = m_readPosition.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    for (;;) {
+      cell = &m_cells[position & m_mask];
+      size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+      if (difference == 0) {
+        if (m_readPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      }
+      else if (difference < 0) {
+        return false;
+      }
+      else {
+        position = m_readPosition.load(std::memory_order_relaxed);
+      }
+    }
+    if (record != nullptr) {
+      *record = cell->record;
+    }
+    cell->sequence.store(position + m_mask + 1, std::memory_order_release);
+    return true;
+  }
+
+  std::unique_ptr<Cell[]> m_cells;                  ///< Celdas del búfer.
+  size_t m_mask = 0;                                ///< Capacidad - 1.
+  std::atomic<LogOverflow> m_overflow;              ///< Política de desborde.
+  alignas(64) std::atomic<size_t> m_writePosition{ 0 }; ///< Siguiente posición de escritura.
+  alignas(64) std::atomic<size_t> m_readPosition{ 0 };  ///< Siguiente posición de lectura.
+  alignas(64) std::atomic<uint64_t> m_dropped{ 0 };     ///< Mensajes descartados.
+};
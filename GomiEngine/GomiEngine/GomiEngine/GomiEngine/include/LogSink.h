@@ -0,0 +1,167 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct LogRecord;
+
+/**
+ * @enum LogFileFormat
+ * @brief Cómo escribe `LogSink` los mensajes.
+ */
+enum class LogFileFormat {
+    TEXT,  ///< Una línea por mensaje; los de `GOMI_LOG` se formatean en el hilo del sink.
+    BINARY ///< Registro `.glog` sin formatear (ver `BinaryLog`); se lee con `--decode-log`.
+};
+
+/**
+ * @struct LogSinkStats
+ * @brief Lo que escribió el sink desde que arrancó.
+ */
+struct LogSinkStats {
+    unsigned long long records = 0;   ///< Mensajes escritos.
+    unsigned long long bytes = 0;     ///< Bytes escritos.
+    unsigned long long writes = 0;    ///< Llamadas de escritura al sistema.
+    unsigned long long rotations = 0; ///< Archivos rotados.
+};
+
+/**
+ * @class LogSink
+ * @brief Hilo que consume el registro de `NotificationService` y lo escribe a disco.
+ *
+ * Mientras corre es el único consumidor del `LogRing`: saca los mensajes por lotes, los escribe
+ * en un búfer de `BUFFER_SIZE` bytes y hace una sola escritura por búfer lleno o por lote, así que
+ * lo que se registró llega al sistema operativo en unos milisegundos aunque el proceso se caiga
+ * después. Los mensajes también se entregan, sin formatear, a `NotificationService` para el
+ * historial de la consola.
+ *
+ * Cuando el archivo llega a `maxFileBytes` (se puede pasar por un mensaje) se renombra a
+ * `<nombre>.1<ext>` y los anteriores se recorren hasta `maxFiles - 1`; al arrancar se rota el
+ * archivo de la ejecución anterior. Ante
+ * `exit`, `std::terminate` o una señal fatal (SIGSEGV, SIGABRT, SIGFPE, SIGILL) se vacía el búfer
+ * antes de terminar; en el caso de las señales es un último intento, no algo garantizado.
+ */
+class LogSink {
+public:
+    LogSink(); ///< Sink detenido.
+
+    /**
+     * @brief Detiene el hilo después de escribir lo pendiente.
+     */
+    ~LogSink();
+
+    // Deshabilitar copia y asignación
+    LogSink(const LogSink&) = delete;
+    LogSink& operator=(const LogSink&) = delete;
+
+    /**
+     * @brief Abre el archivo y arranca el hilo. Solo puede haber un sink corriendo.
+     * @param path Ruta del archivo (p. ej. "LogData.txt").
+     * @param maxFileBytes Tamaño a partir del cual se rota el archivo.
+     * @param maxFiles Archivos que se conservan, contando el actual.
+     * @param format Texto o registro binario.
+     * @return false si no se pudo abrir el archivo o ya hay otro sink corriendo.
+     */
+    bool start(const std::string& path, size_t maxFileBytes, int maxFiles,
+               LogFileFormat format = LogFileFormat::TEXT);
+
+    /**
+     * @brief Escribe lo pendiente, detiene el hilo y cierra el archivo.
+     */
+    void stop();
+
+    /**
+     * @brief Escribe en el archivo todo lo registrado hasta ahora. Se puede llamar desde cualquier hilo.
+     */
+    void flush();
+
+    /**
+     * @brief Tiempo máximo que el hilo espera sin mensajes antes de volver a revisar el búfer.
+     */
+    void setPollInterval(float milliseconds) { m_pollIntervalMs = milliseconds; }
+
+    bool isRunning() const { return m_running.load(); } ///< Indica si el hilo está corriendo.
+    LogSinkStats getStats();                            ///< Estadísticas (toma el candado del sink).
+
+private:
+    static constexpr size_t BUFFER_SIZE = 64 * 1024; ///< Bytes formateados antes de escribir.
+    static constexpr size_t BATCH_SIZE = 1024;       ///< Mensajes por lote.
+
+    /**
+     * @brief Ciclo del hilo: saca lotes mientras haya mensajes y duerme cuando no.
+     */
+    void run();
+
+    /**
+     * @brief Saca y escribe un lote (requiere `m_mutex`).
+     * @param deliver Entregar los mensajes al historial (no se hace durante un fallo fatal).
+     * @return Cantidad de mensajes del lote.
+     */
+    size_t drainBatch(bool deliver);
+
+    /**
+     * @brief Agrega un mensaje al final del búfer, escribiendo el búfer si no cabe y rotando el
+     * archivo si llegó al tamaño máximo.
+     * @param message Texto ya formateado (solo se usa en formato texto).
+     */
+    void append(const LogRecord& record, const char* message);
+
+    /**
+     * @brief Agrega una entrada RECORD (y la FORMAT de su llamada si este archivo aún no la tiene).
+     */
+    void appendBinary(const LogRecord& record);
+
+    /**
+     * @brief Reserva `size` bytes al final del búfer.
+     */
+    char* reserve(size_t size);
+
+    /**
+     * @brief Escribe el búfer en el archivo.
+     */
+    void writeBuffer();
+
+    /**
+     * @brief Abre `m_path` vacío (con el encabezado si es binario).
+     */
+    bool openFile();
+
+    /**
+     * @brief Cierra el archivo actual, recorre los anteriores y abre uno vacío.
+     */
+    bool rotate();
+
+    /**
+     * @brief Vacía el sink activo sin esperar al candado si otro hilo lo tiene (para fallos fatales).
+     */
+    static void flushActive();
+
+    static void onExit();            ///< Manejador de `std::atexit`.
+    static void onTerminate();       ///< Manejador de `std::set_terminate`.
+    static void onSignal(int value); ///< Manejador de señales fatales.
+
+    std::string m_path;                   ///< Archivo actual.
+    size_t m_maxFileBytes = 0;            ///< Tamaño de rotación.
+    int m_maxFiles = 1;                   ///< Archivos que se conservan.
+    LogFileFormat m_format = LogFileFormat::TEXT; ///< Texto o binario.
+    std::vector<bool> m_writtenFormats;   ///< Formatos (por id) ya escritos en el archivo binario actual.
+    std::FILE* m_file = nullptr;          ///< Archivo abierto (sin búfer de stdio).
+    size_t m_fileBytes = 0;               ///< Bytes en el archivo actual.
+    std::vector<char> m_buffer;           ///< Texto formateado sin escribir.
+    size_t m_used = 0;                    ///< Bytes usados de `m_buffer`.
+    std::vector<LogRecord> m_delivery;    ///< Mensajes del lote para el historial (sin formatear).
+    LogSinkStats m_stats;                 ///< Estadísticas.
+    float m_pollIntervalMs = 50.0f;       ///< Espera máxima sin mensajes.
+
+    std::thread m_thread;                 ///< Hilo del sink.
+    std::atomic<bool> m_running{ false }; ///< El hilo debe seguir corriendo.
+    std::mutex m_mutex;                   ///< Un solo consumidor a la vez (hilo, `flush`, fallos).
+    std::mutex m_wakeMutex;               ///< Acompaña a `m_wake`.
+    std::condition_variable m_wake;       ///< Despierta al hilo para terminar.
+
+    static std::atomic<LogSink*> s_active; ///< Sink que vacían los manejadores de fallos.
+};
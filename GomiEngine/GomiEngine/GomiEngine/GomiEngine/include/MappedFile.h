@@ -0,0 +1,50 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+/**
+ * @class MappedFile
+ * @brief Archivo de solo lectura proyectado en memoria.
+ *
+ * El sistema operativo carga las páginas bajo demanda y las comparte con su caché de disco, así
+ * que abrir un archivo grande no copia nada: los datos se leen directamente desde `data()`.
+ * Usa `CreateFileMapping` en Windows y `mmap` en los demás sistemas.
+ */
+class MappedFile {
+public:
+    MappedFile() = default; ///< Constructor por defecto (sin archivo).
+
+    /**
+     * @brief Libera la proyección.
+     */
+    ~MappedFile() { close(); }
+
+    // Deshabilitar copia y asignación
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Proyecta un archivo completo en memoria.
+     * @param path Ruta del archivo.
+     * @return true si se pudo abrir; un archivo vacío se abre con `size() == 0`.
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Libera la proyección y cierra el archivo.
+     */
+    void close();
+
+    const char* data() const { return m_data; }  ///< Inicio de los datos (nulo si está vacío).
+    size_t size() const { return m_size; }       ///< Tamaño en bytes.
+    bool isOpen() const { return m_open; }       ///< Indica si hay un archivo abierto.
+
+private:
+    const char* m_data = nullptr;  ///< Datos proyectados.
+    size_t m_size = 0;             ///< Tamaño del archivo.
+    bool m_open = false;           ///< Hay un archivo abierto.
+#ifdef _WIN32
+    void* m_file = nullptr;        ///< HANDLE del archivo.
+    void* m_mapping = nullptr;     ///< HANDLE de la proyección.
+#endif
+};
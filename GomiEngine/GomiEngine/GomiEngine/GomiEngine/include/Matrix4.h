@@ -0,0 +1,158 @@
+#pragma once
+#include <cmath>
+#include "Vector3.h"
+#include "Vector4.h"
+#include "Quaternion.h"
+
+/**
+ * @class Matrix4
+ * @brief Matriz 4x4 para transformaciones 3D, con vectores columna (`M * v`).
+ *
+ * Los elementos se guardan por filas: `m[fila][columna]`. Las transformaciones se componen de
+ * derecha a izquierda, así que `proyección * vista * modelo` aplica primero el modelo.
+ */
+class Matrix4 {
+public:
+    // Elementos de la matriz por filas.
+    float m[4][4];
+
+    /**
+     * @brief Constructor por defecto.
+     * Inicializa la matriz como identidad.
+     */
+    Matrix4() {
+        for (int row = 0; row < 4; ++row) {
+            for (int column = 0; column < 4; ++column) {
+                m[row][column] = row == column ? 1.0f : 0.0f;
+            }
+        }
+    }
+
+    // Sobrecarga del operador para componer 2 transformaciones.
+    Matrix4 operator*(const Matrix4& other) const {
+        Matrix4 result;
+        for (int row = 0; row < 4; ++row) {
+            for (int column = 0; column < 4; ++column) {
+                result.m[row][column] = m[row][0] * other.m[0][column] + m[row][1] * other.m[1][column] +
+                                        m[row][2] * other.m[2][column] + m[row][3] * other.m[3][column];
+            }
+        }
+        return result;
+    }
+
+    // Sobrecarga del operador para transformar un vector homogéneo.
+    Vector4 operator*(const Vector4& v) const {
+        return Vector4(m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z + m[0][3] * v.w,
+                       m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z + m[1][3] * v.w,
+                       m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z + m[2][3] * v.w,
+                       m[3][0] * v.x + m[3][1] * v.y + m[3][2] * v.z + m[3][3] * v.w);
+    }
+
+    /**
+     * @brief Transforma un punto (w = 1).
+     * @param point Punto en 3D.
+     * @return Punto en coordenadas homogéneas.
+     */
+    Vector4 transformPoint(const Vector3& point) const {
+        return (*this) * Vector4(point.x, point.y, point.z, 1.0f);
+    }
+
+    /**
+     * @brief Matriz de traslación.
+     * @param offset Desplazamiento.
+     */
+    static Matrix4 translation(const Vector3& offset) {
+        Matrix4 result;
+        result.m[0][3] = offset.x;
+        result.m[1][3] = offset.y;
+        result.m[2][3] = offset.z;
+        return result;
+    }
+
+    /**
+     * @brief Matriz de escala.
+     * @param factors Escala por eje.
+     */
+    static Matrix4 scale(const Vector3& factors) {
+        Matrix4 result;
+        result.m[0][0] = factors.x;
+        result.m[1][1] = factors.y;
+        result.m[2][2] = factors.z;
+        return result;
+    }
+
+    /**
+     * @brief Matriz de rotación a partir de un cuaternión.
+     * @param rotation Cuaternión (se normaliza antes de usarse).
+     */
+    static Matrix4 rotation(const Quaternion& rotation) {
+        Quaternion q = rotation.normalize();
+        Matrix4 result;
+        result.m[0][0] = 1.0f - 2.0f * (q.y * q.y + q.z * q.z);
+        result.m[0][1] = 2.0f * (q.x * q.y - q.w * q.z);
+        result.m[0][2] = 2.0f * (q.x * q.z + q.w * q.y);
+        result.m[1][0] = 2.0f * (q.x * q.y + q.w * q.z);
+        result.m[1][1] = 1.0f - 2.0f * (q.x * q.x + q.z * q.z);
+        result.m[1][2] = 2.0f * (q.y * q.z - q.w * q.x);
+        result.m[2][0] = 2.0f * (q.x * q.z - q.w * q.y);
+        result.m[2][1] = 2.0f * (q.y * q.z + q.w * q.x);
+        result.m[2][2] = 1.0f - 2.0f * (q.x * q.x + q.y * q.y);
+        return result;
+    }
+
+    /**
+     * @brief Proyección en perspectiva al estilo OpenGL (la cámara mira hacia -Z y el volumen
+     * visible queda en [-1, 1] en los tres ejes tras dividir entre w).
+     * @param fovY Campo de visión vertical en radianes.
+     * @param aspect Relación ancho / alto.
+     * @param nearPlane Distancia al plano cercano (mayor que 0).
+     * @param farPlane Distancia al plano lejano.
+     */
+    static Matrix4 perspective(float fovY, float aspect, float nearPlane, float farPlane) {
+        float focal = std::cos(fovY * 0.5f) / std::sin(fovY * 0.5f);
+        Matrix4 result;
+        result.m[0][0] = focal / aspect;
+        result.m[1][1] = focal;
+        result.m[2][2] = (farPlane + nearPlane) / (nearPlane - farPlane);
+        result.m[2][3] = 2.0f * farPlane * nearPlane / (nearPlane - farPlane);
+        result.m[3][2] = -1.0f;
+        result.m[3][3] = 0.0f;
+        return result;
+    }
+
+    /**
+     * @brief Matriz de vista de una cámara en `eye` que mira hacia `target`.
+     * @param eye Posición de la cámara.
+     * @param target Punto observado.
+     * @param up Dirección aproximada hacia arriba.
+     */
+    static Matrix4 lookAt(const Vector3& eye, const Vector3& target, const Vector3& up) {
+        Vector3 forward = (target - eye).normalize();
+        Vector3 right = Vector3(forward.y * up.z - forward.z * up.y,
+                                forward.z * up.x - forward.x * up.z,
+                                forward.x * up.y - forward.y * up.x).normalize();
+        Vector3 trueUp(right.y * forward.z - right.z * forward.y,
+                       right.z * forward.x - right.x * forward.z,
+                       right.x * forward.y - right.y * forward.x);
+
+        Matrix4 result;
+        const Vector3 axes[3] = { right, trueUp, forward * -1.0f };
+        for (int row = 0; row < 3; ++row) {
+            result.m[row][0] = axes[row].x;
+            result.m[row][1] = axes[row].y;
+            result.m[row][2] = axes[row].z;
+            result.m[row][3] = -(axes[row].x * eye.x + axes[row].y * eye.y + axes[row].z * eye.z);
+        }
+        return result;
+    }
+
+    // Método para devolver un puntero a los datos no constantes.
+    float* data() {
+        return &m[0][0];
+    }
+
+    // Método para devolver un puntero a los datos constantes.
+    const float* data() const {
+        return &m[0][0];
+    }
+};
@@ -115,6 +115,9 @@ namespace EngineUtilities {
 		// Comprobar si el puntero es nulo.
 		bool isNull() const { return ptr == nullptr; }
 
+		// Cantidad de punteros que comparten el objeto (0 si es nulo).
+		int useCount() const { return refCount ? *refCount : 0; }
+
 
 	public:
 		// Puntero al objeto gestionado.
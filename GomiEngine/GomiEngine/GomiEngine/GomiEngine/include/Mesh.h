@@ -0,0 +1,112 @@
+#pragma once
+#include "Prerequisites.h"
+#include "Component.h"
+#include "ObjLoader.h"
+#include "MappedFile.h"
+#include <cstdint>
+#include <memory>
+
+struct Vertex3D;
+
+/**
+ * @class Mesh
+ * @brief Componente de malla 3D: vértices intercalados (`MeshVertex`) e índices de 32 bits.
+ *
+ * La malla se lee de un OBJ con `ObjLoader` o de su caché binaria (`.gmesh`). La caché guarda
+ * los búferes tal como están en memoria, así que `loadCache` solo proyecta el archivo y apunta a
+ * sus datos: no copia ni convierte nada, y las páginas se cargan cuando se usan.
+ *
+ * Formato de la caché (little-endian): un encabezado de `CACHE_HEADER_SIZE` bytes con la firma
+ * "GMSH", la versión, las cantidades, la caja envolvente y el hash del OBJ de origen (nombre,
+ * tamaño y fecha, como el atlas), seguido de los vértices y después de los índices.
+ */
+class Mesh : public Component {
+public:
+    static constexpr uint32_t CACHE_MAGIC = 0x48534D47;  ///< "GMSH" en little-endian.
+    static constexpr uint32_t CACHE_VERSION = 1;         ///< Versión del formato de caché.
+    static constexpr size_t CACHE_HEADER_SIZE = 64;      ///< Bytes del encabezado.
+
+    /**
+     * @brief Constructor por defecto (malla vacía).
+     */
+    Mesh() : Component(ComponentType::MESH) {}
+
+    virtual ~Mesh() = default; ///< Destructor por defecto.
+
+    /**
+     * @brief Carga la malla desde su caché si sigue vigente; si no, lee el OBJ y guarda la caché.
+     * @param objPath Ruta del OBJ (la caché es `objPath + ".gmesh"`).
+     * @return true si la malla se cargó por cualquiera de los dos caminos.
+     */
+    bool load(const std::string& objPath);
+
+    /**
+     * @brief Lee un archivo OBJ.
+     * @param path Ruta del archivo.
+     * @param parallel Leer los archivos grandes en paralelo.
+     */
+    bool loadFromObj(const std::string& path, bool parallel = true);
+
+    /**
+     * @brief Proyecta una caché binaria y usa sus datos sin copiarlos.
+     * @param cachePath Ruta de la caché.
+     * @param sourcePath OBJ de origen; si existe y cambió, la caché se rechaza. Vacío = no revisar.
+     */
+    bool loadCache(const std::string& cachePath, const std::string& sourcePath = "");
+
+    /**
+     * @brief Escribe la caché binaria de la malla actual.
+     * @param cachePath Ruta de la caché.
+     * @param sourcePath OBJ de origen, para invalidar la caché cuando cambie.
+     */
+    bool saveCache(const std::string& cachePath, const std::string& sourcePath) const;
+
+    /**
+     * @brief Agrega los triángulos a una lista de `SoftwareRenderer3D`, coloreados según su normal.
+     * @param out Lista de vértices (tres por triángulo).
+     */
+    void appendTriangles(std::vector<Vertex3D>& out) const;
+
+    /**
+     * @brief Actualiza el componente de malla (no tiene estado que avanzar).
+     */
+    void update(float deltaTime) override {}
+
+    /**
+     * @brief La malla se dibuja con `SoftwareRenderer3D`, no en la ventana 2D.
+     */
+    void render(Window& window) override {}
+
+    const MeshVertex* getVertices() const { return m_vertexData; } ///< Vértices intercalados.
+    size_t getVertexCount() const { return m_vertexCount; }       ///< Cantidad de vértices.
+    const uint32_t* getIndices() const { return m_indexData; }    ///< Tres índices por triángulo.
+    size_t getIndexCount() const { return m_indexCount; }         ///< Cantidad de índices.
+    bool isMapped() const { return m_cacheFile != nullptr; }      ///< Los datos viven en la caché proyectada.
+    const Vector3& getBoundsMin() const { return m_boundsMin; }   ///< Esquina mínima de la caja envolvente.
+    const Vector3& getBoundsMax() const { return m_boundsMax; }   ///< Esquina máxima de la caja envolvente.
+
+    /**
+     * @brief Ruta de la caché de un OBJ.
+     */
+    static std::string getCachePath(const std::string& objPath) { return objPath + ".gmesh"; }
+
+private:
+    /**
+     * @brief Hash del OBJ de origen (nombre, tamaño y fecha de modificación).
+     */
+    static unsigned long long computeSourceHash(const std::string& sourcePath);
+
+    /**
+     * @brief Apunta a los búferes propios y recalcula la caja envolvente.
+     */
+    void adoptOwnedData();
+
+    MeshData m_data;                          ///< Búferes propios (vacíos si se usa la caché).
+    std::unique_ptr<MappedFile> m_cacheFile;  ///< Caché proyectada (nula si se leyó el OBJ).
+    const MeshVertex* m_vertexData = nullptr; ///< Vértices en uso.
+    const uint32_t* m_indexData = nullptr;    ///< Índices en uso.
+    size_t m_vertexCount = 0;                 ///< Cantidad de vértices.
+    size_t m_indexCount = 0;                  ///< Cantidad de índices.
+    Vector3 m_boundsMin;                      ///< Esquina mínima de la caja envolvente.
+    Vector3 m_boundsMax;                      ///< Esquina máxima de la caja envolvente.
+};
@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct MeshVertex
+ * @brief Vértice intercalado de una malla (32 bytes): posición, normal y coordenada de textura.
+ */
+struct MeshVertex {
+    float position[3];  ///< Posición en coordenadas del modelo.
+    float normal[3];    ///< Normal unitaria.
+    float texCoord[2];  ///< Coordenada de textura (0 si el archivo no la define).
+};
+
+/**
+ * @struct MeshData
+ * @brief Malla indexada: vértices únicos más tres índices por triángulo.
+ */
+struct MeshData {
+    std::vector<MeshVertex> vertices;  ///< Vértices sin repetir.
+    std::vector<uint32_t> indices;     ///< Índices de los triángulos.
+};
+
+/**
+ * @class ObjLoader
+ * @brief Lector de Wavefront OBJ que trabaja directamente sobre el archivo proyectado en memoria.
+ *
+ * Entiende `v`, `vt`, `vn` y `f` (con índices `v`, `v/t`, `v//n`, `v/t/n` y negativos) e ignora
+ * el resto de las líneas. No crea un `std::string` por línea: los números se leen con analizadores
+ * propios directamente del búfer.
+ *
+ * Los archivos grandes se dividen en bloques que terminan en un salto de línea y se leen en
+ * paralelo con `JobSystem`; al unirlos se corrigen los índices relativos de cada bloque. Después,
+ * las combinaciones (posición, textura, normal) repetidas se funden con una tabla hash de
+ * direccionamiento abierto, y las caras de más de tres lados se dividen en abanico. Si el archivo
+ * no trae normales, se calculan normales suaves ponderadas por área.
+ */
+class ObjLoader {
+public:
+    /**
+     * @brief Lee un archivo OBJ.
+     * @param path Ruta del archivo.
+     * @param mesh Malla de salida (se reemplaza).
+     * @return true si se pudo leer.
+     */
+    bool loadFromFile(const std::string& path, MeshData& mesh);
+
+    /**
+     * @brief Lee un OBJ que ya está en memoria (no necesita terminar en nulo).
+     * @param data Contenido del archivo.
+     * @param size Tamaño en bytes.
+     * @param mesh Malla de salida (se reemplaza).
+     * @return true si se pudo leer; si no, `getError` describe el problema.
+     */
+    bool parse(const char* data, size_t size, MeshData& mesh);
+
+    /**
+     * @brief Permite leer en paralelo los archivos de más de `PARALLEL_CHUNK_SIZE` (activado por defecto).
+     */
+    void setParallel(bool enabled) { m_parallel = enabled; }
+
+    const std::string& getError() const { return m_error; } ///< Error de la última lectura.
+
+    // Estadísticas de la última lectura.
+    size_t getPositionCount() const { return m_positionCount; }    ///< Líneas `v`.
+    size_t getTriangleCount() const { return m_triangleCount; }    ///< Triángulos tras dividir las caras.
+    size_t getSkippedLineCount() const { return m_skippedLines; }  ///< Líneas mal formadas ignoradas.
+    size_t getChunkCount() const { return m_chunkCount; }          ///< Bloques leídos.
+
+    static constexpr size_t PARALLEL_CHUNK_SIZE = 1 << 20; ///< Bytes mínimos por bloque paralelo.
+
+private:
+    bool m_parallel = true;       ///< Leer en paralelo.
+    std::string m_error;          ///< Error de la última lectura.
+    size_t m_positionCount = 0;   ///< Posiciones leídas.
+    size_t m_triangleCount = 0;   ///< Triángulos generados.
+    size_t m_skippedLines = 0;    ///< Líneas ignoradas.
+    size_t m_chunkCount = 0;      ///< Bloques usados.
+};
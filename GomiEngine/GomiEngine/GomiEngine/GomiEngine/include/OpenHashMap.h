@@ -0,0 +1,239 @@
+#pragma once
+#include "Hash.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace EngineUtilities {
+	/**
+	 * Mapa de cadenas a valores con direccionamiento abierto.
+	 *
+	 * Las entradas viven juntas en un arreglo denso y la tabla de ranuras solo guarda parte
+	 * del hash y el índice de la entrada, así que una búsqueda recorre pocas ranuras
+	 * contiguas y casi nunca compara cadenas que no coinciden. Las búsquedas aceptan
+	 * `std::string_view`, por lo que consultar con una literal o una subcadena no reserva
+	 * memoria para la clave.
+	 *
+	 * Insertar o borrar puede mover las entradas: no se deben guardar punteros a los valores
+	 * entre modificaciones del mapa.
+	 */
+	template<typename V>
+	class OpenHashMap
+	{
+	public:
+		// Entrada del arreglo denso.
+		struct Entry
+		{
+			std::string key;
+			V value;
+			uint64_t hash;
+		};
+
+		OpenHashMap() = default;
+
+		// Busca una clave; devuelve nulo si no existe.
+		V* find(std::string_view key)
+		{
+			size_t slot = findSlot(key, hashKey(key));
+			return slot == NOT_FOUND ? nullptr : &m_entries[m_slots[slot].entry].value;
+		}
+
+		const V* find(std::string_view key) const
+		{
+			return const_cast<OpenHashMap*>(this)->find(key);
+		}
+
+		// Indica si la clave existe.
+		bool contains(std::string_view key) const
+		{
+			return find(key) != nullptr;
+		}
+
+		/**
+		 * Devuelve el valor de la clave, creándolo con su constructor por defecto si no
+		 * existía. `second` es true si se insertó.
+		 */
+		std::pair<V*, bool> tryEmplace(std::string_view key)
+		{
+			uint64_t hash = hashKey(key);
+			size_t slot = findSlot(key, hash);
+			if (slot != NOT_FOUND)
+			{
+				return { &m_entries[m_slots[slot].entry].value, false };
+			}
+			if ((m_entries.size() + 1) * 8 > m_slots.size() * 7)
+			{
+				rehash(m_slots.empty() ? MIN_CAPACITY : m_slots.size() * 2);
+			}
+			m_entries.push_back({ std::string(key), V(), hash });
+			placeEntry(static_cast<uint32_t>(m_entries.size() - 1));
+			return { &m_entries.back().value, true };
+		}
+
+		// Asigna un valor a la clave (inserta o reemplaza).
+		V& insert(std::string_view key, V value)
+		{
+			V& stored = *tryEmplace(key).first;
+			stored = std::move(value);
+			return stored;
+		}
+
+		/**
+		 * Borra una clave. La última entrada ocupa el hueco y las ranuras siguientes se
+		 * recorren hacia atrás, así que no quedan lápidas que alarguen las búsquedas.
+		 */
+		bool erase(std::string_view key)
+		{
+			size_t slot = findSlot(key, hashKey(key));
+			if (slot == NOT_FOUND)
+			{
+				return false;
+			}
+			uint32_t removed = m_slots[slot].entry;
+			removeSlot(slot);
+
+			uint32_t last = static_cast<uint32_t>(m_entries.size() - 1);
+			if (removed != last)
+			{
+				size_t lastSlot = slotOfEntry(last);
+				m_entries[removed] = std::move(m_entries[last]);
+				m_slots[lastSlot].entry = removed;
+			}
+			m_entries.pop_back();
+			return true;
+		}
+
+		// Vacía el mapa conservando la memoria.
+		void clear()
+		{
+			m_entries.clear();
+			for (Slot& slot : m_slots)
+			{
+				slot = Slot();
+			}
+		}
+
+		// Reserva lugar para `count` entradas sin volver a distribuir.
+		void reserve(size_t count)
+		{
+			size_t capacity = MIN_CAPACITY;
+			while (count * 8 > capacity * 7)
+			{
+				capacity *= 2;
+			}
+			if (capacity > m_slots.size())
+			{
+				rehash(capacity);
+			}
+			m_entries.reserve(count);
+		}
+
+		size_t size() const { return m_entries.size(); }
+		bool empty() const { return m_entries.empty(); }
+
+		// Recorrido en orden de inserción (alterado por los borrados).
+		typename std::vector<Entry>::iterator begin() { return m_entries.begin(); }
+		typename std::vector<Entry>::iterator end() { return m_entries.end(); }
+		typename std::vector<Entry>::const_iterator begin() const { return m_entries.begin(); }
+		typename std::vector<Entry>::const_iterator end() const { return m_entries.end(); }
+
+	private:
+		// Ranura de la tabla: 32 bits altos del hash e índice de la entrada (EMPTY si está libre).
+		struct Slot
+		{
+			uint32_t tag = 0;
+			uint32_t entry = EMPTY;
+		};
+
+		static constexpr uint32_t EMPTY = 0xFFFFFFFFu;
+		static constexpr size_t NOT_FOUND = ~size_t(0);
+		static constexpr size_t MIN_CAPACITY = 16;
+
+		static uint64_t hashKey(std::string_view key)
+		{
+			uint64_t hash = hashFNV1a(key.data(), key.size());
+			// FNV-1a deja poca variación en los bits bajos con claves parecidas; se mezclan.
+			hash ^= hash >> 32;
+			hash *= 0xD6E8FEB86659FD93ull;
+			hash ^= hash >> 32;
+			return hash;
+		}
+
+		size_t mask() const { return m_slots.size() - 1; }
+
+		size_t findSlot(std::string_view key, uint64_t hash) const
+		{
+			if (m_slots.empty())
+			{
+				return NOT_FOUND;
+			}
+			const uint32_t tag = static_cast<uint32_t>(hash >> 32);
+			for (size_t slot = static_cast<size_t>(hash) & mask();; slot = (slot + 1) & mask())
+			{
+				const Slot& current = m_slots[slot];
+				if (current.entry == EMPTY)
+				{
+					return NOT_FOUND;
+				}
+				if (current.tag == tag && m_entries[current.entry].key == key)
+				{
+					return slot;
+				}
+			}
+		}
+
+		size_t slotOfEntry(uint32_t entry) const
+		{
+			for (size_t slot = static_cast<size_t>(m_entries[entry].hash) & mask();; slot = (slot + 1) & mask())
+			{
+				if (m_slots[slot].entry == entry)
+				{
+					return slot;
+				}
+			}
+		}
+
+		void placeEntry(uint32_t entry)
+		{
+			uint64_t hash = m_entries[entry].hash;
+			size_t slot = static_cast<size_t>(hash) & mask();
+			while (m_slots[slot].entry != EMPTY)
+			{
+				slot = (slot + 1) & mask();
+			}
+			m_slots[slot].tag = static_cast<uint32_t>(hash >> 32);
+			m_slots[slot].entry = entry;
+		}
+
+		// Borrado con desplazamiento hacia atrás para sondeo lineal.
+		void removeSlot(size_t hole)
+		{
+			for (size_t next = (hole + 1) & mask(); m_slots[next].entry != EMPTY; next = (next + 1) & mask())
+			{
+				size_t home = static_cast<size_t>(m_entries[m_slots[next].entry].hash) & mask();
+				// La entrada de `next` puede ocupar el hueco si su ranura ideal no está entre el
+				// hueco (exclusivo) y ella misma (inclusivo), contando la vuelta de la tabla.
+				if (((next - home) & mask()) >= ((next - hole) & mask()))
+				{
+					m_slots[hole] = m_slots[next];
+					hole = next;
+				}
+			}
+			m_slots[hole] = Slot();
+		}
+
+		void rehash(size_t capacity)
+		{
+			m_slots.assign(capacity, Slot());
+			for (uint32_t i = 0; i < m_entries.size(); ++i)
+			{
+				placeEntry(i);
+			}
+		}
+
+		std::vector<Entry> m_entries;
+		std::vector<Slot> m_slots;
+	};
+}
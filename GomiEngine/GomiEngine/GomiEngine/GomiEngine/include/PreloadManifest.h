@@ -0,0 +1,71 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @enum PreloadType
+ * @brief Tipo de recurso de una entrada del manifiesto.
+ */
+enum class PreloadType {
+    TEXTURE, ///< Textura suelta.
+    ATLAS,   ///< Atlas de sprites.
+    FONT,    ///< Fuente.
+    SOUND,   ///< Sonido.
+    SHADER   ///< Shader.
+};
+
+/**
+ * @struct PreloadEntry
+ * @brief Recurso que una escena necesita antes del primer fotograma.
+ */
+struct PreloadEntry {
+    PreloadType type = PreloadType::TEXTURE; ///< Tipo de recurso.
+    std::string name;                        ///< Nombre (textura o atlas sin extensión; ruta para los demás).
+    std::string extension;                   ///< Extensión de las texturas y de los sprites del atlas.
+    std::vector<std::string> sprites;        ///< Sprites del atlas.
+};
+
+/**
+ * @class PreloadManifest
+ * @brief Lista de recursos por escena que se cargan en paralelo al arrancar.
+ *
+ * Formato de texto, una entrada por línea; `#` inicia un comentario:
+ * @code
+ * [Race]
+ * texture Circuit.png
+ * atlas CharactersAtlas png Characters/tile000 Characters/tile001
+ * font Fonts/Arial.ttf
+ * sound Sounds/Engine.ogg
+ * shader Shaders/Glow.frag
+ * @endcode
+ */
+class PreloadManifest {
+public:
+    PreloadManifest() = default; ///< Manifiesto vacío.
+
+    /**
+     * @brief Lee un manifiesto; las líneas inválidas se avisan y se omiten.
+     * @param path Ruta del archivo.
+     * @return false si el archivo no existe.
+     */
+    bool loadFromFile(const std::string& path);
+
+    /**
+     * @brief Agrega una entrada a una escena.
+     */
+    void addEntry(const std::string& scene, const PreloadEntry& entry) { m_scenes[scene].push_back(entry); }
+
+    /**
+     * @brief Entradas de una escena (vacío si no existe).
+     */
+    const std::vector<PreloadEntry>& getScene(const std::string& scene) const;
+
+    /**
+     * @brief Indica si el manifiesto define la escena.
+     */
+    bool hasScene(const std::string& scene) const { return m_scenes.find(scene) != m_scenes.end(); }
+
+private:
+    std::unordered_map<std::string, std::vector<PreloadEntry>> m_scenes; ///< Escena -> recursos.
+};
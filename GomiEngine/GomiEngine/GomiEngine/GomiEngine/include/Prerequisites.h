@@ -46,19 +46,18 @@ enum
 // MACRO for safe release of resources 
 #define SAFE_PTR_RELEASE(x) if(x != nullptr) { delete x; x = nullptr; }
 
-#define MESSAGE(classObj, method, state)                      \
-{                                                             \
-    std::ostringstream os_;                                   \
-    os_ << classObj << "::" << method << " : "                \
-        << "[CREATION OF RESOURCE" << ": " << state << "] \n";\
-    std::cerr << os_.str();                                   \
-}                                                      
-
-#define ERROR(classObj, method, errorMSG)                   \
-{                                                           \
-  std::ostringstream os_;                                   \
-  os_ << "ERROR: " << classObj << "::" << method << " : "   \
-    << " Error in data from params [" << errorMSG << "] \n"; \
-  std::cerr << os_.str();                                   \
-  exit(1);                                                  \
-}                                
\ No newline at end of file
+// Mensaje de creacion de un recurso; se formatea en el hilo del registro (ver StructuredLog.h)
+#define MESSAGE(classObj, method, state)                                                        \
+  GOMI_LOG_INFO(classObj, "%s::%s : [CREATION OF RESOURCE: %s]", classObj, method, state)
+
+// Error fatal: queda en el registro (LogSink lo escribe antes de salir) y en la salida de errores
+#define ERROR(classObj, method, errorMSG)                                                       \
+{                                                                                               \
+  GOMI_LOG_ERROR(classObj, "%s::%s : Error in data from params [%s]", classObj, method, errorMSG); \
+  std::cerr << "ERROR: " << classObj << "::" << method << " : "                                 \
+    << " Error in data from params [" << errorMSG << "] \n";                                    \
+  exit(1);                                                                                      \
+}
+
+// Registro estructurado (GOMI_LOG); usa ConsolErrorType, declarado arriba
+#include "StructuredLog.h"
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "MathEngine.h"
+#include <cmath>
 #include "Vector3.h"
 
 class Quaternion {
@@ -29,8 +30,8 @@ public:
      */
     Quaternion(float angle, const Vector3& axis) {
         float halfAngle = angle / 2.0f;
-        float sinHalfAngle = MathEngine::sin(halfAngle);
-        w = MathEngine::cos(halfAngle);
+        float sinHalfAngle = std::sin(halfAngle);
+        w = std::cos(halfAngle);
         x = axis.x * sinHalfAngle;
         y = axis.y * sinHalfAngle;
         z = axis.z * sinHalfAngle;
@@ -66,7 +67,7 @@ public:
      * @return Magnitud del cuaternión.
      */
     float magnitude() const {
-        return MathEngine::sqrt(w * w + x * x + y * y + z * z);
+        return std::sqrt(w * w + x * x + y * y + z * z);
     }
 
     /**
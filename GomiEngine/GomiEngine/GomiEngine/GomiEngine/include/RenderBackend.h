@@ -0,0 +1,88 @@
+#pragma once
+#include "Prerequisites.h"
+
+/**
+ * @class RenderBackend
+ * @brief Destino de dibujo intercambiable: SFML en la ventana, o el rasterizador por software
+ * cuando no hay GPU ni pantalla (integración continua, pruebas de imagen, mediciones).
+ *
+ * Todo lo que dibuja el motor son listas de triángulos con color por vértice y coordenadas de
+ * textura en píxeles (ver `BatchRenderer`), así que es lo único que un backend debe implementar.
+ */
+class RenderBackend {
+public:
+    virtual ~RenderBackend() = default; ///< Destructor virtual para limpieza segura.
+
+    /**
+     * @brief Asigna la vista (cámara) con la que se transforman los siguientes dibujos.
+     */
+    virtual void setView(const sf::View& view) = 0;
+
+    /**
+     * @brief Vista actual.
+     */
+    virtual const sf::View& getView() const = 0;
+
+    /**
+     * @brief Llena el destino con un color.
+     */
+    virtual void clear(const sf::Color& color = sf::Color::Black) = 0;
+
+    /**
+     * @brief Dibuja una lista de triángulos.
+     * @param vertices Vértices, tres por triángulo.
+     * @param vertexCount Cantidad de vértices.
+     * @param states Textura, transformación y modo de mezcla.
+     */
+    virtual void drawTriangles(const sf::Vertex* vertices, size_t vertexCount,
+                               const sf::RenderStates& states) = 0;
+
+    /**
+     * @brief Dibuja un objeto de SFML que no se reduce a triángulos (p. ej. formas con contorno).
+     * Los backends que no lo admiten lo omiten y lo cuentan.
+     */
+    virtual void draw(const sf::Drawable& drawable, const sf::RenderStates& states) = 0;
+
+    /**
+     * @brief Termina el fotograma.
+     */
+    virtual void display() = 0;
+
+    /**
+     * @brief Tamaño del destino en píxeles.
+     */
+    virtual sf::Vector2u getSize() const = 0;
+};
+
+/**
+ * @class SfmlRenderBackend
+ * @brief Backend que dibuja en una ventana o textura de render de SFML.
+ */
+class SfmlRenderBackend : public RenderBackend {
+public:
+    /**
+     * @param target Destino de SFML (no se toma su propiedad).
+     */
+    explicit SfmlRenderBackend(sf::RenderTarget& target) : m_target(target) {}
+
+    void setView(const sf::View& view) override { m_target.setView(view); }
+    const sf::View& getView() const override { return m_target.getView(); }
+    void clear(const sf::Color& color = sf::Color::Black) override { m_target.clear(color); }
+
+    void
+    drawTriangles(const sf::Vertex* vertices, size_t vertexCount, const sf::RenderStates& states) override {
+        m_target.draw(vertices, vertexCount, sf::Triangles, states);
+    }
+
+    void
+    draw(const sf::Drawable& drawable, const sf::RenderStates& states) override {
+        m_target.draw(drawable, states);
+    }
+
+    // `sf::RenderTarget` no tiene `display`; las ventanas y texturas lo llaman por su cuenta.
+    void display() override {}
+    sf::Vector2u getSize() const override { return m_target.getSize(); }
+
+private:
+    sf::RenderTarget& m_target; ///< Destino de SFML.
+};
@@ -0,0 +1,117 @@
+#pragma once
+#include "Prerequisites.h"
+#include <cstdint>
+
+class BatchRenderer;
+class ShapeFactory;
+
+/**
+ * @struct RenderCommand
+ * @brief Comando de dibujo compacto: clave de orden más la forma a dibujar (16 bytes).
+ */
+struct RenderCommand {
+    uint64_t key = 0;                    ///< Clave de orden (ver RenderQueue::makeKey).
+    const ShapeFactory* shape = nullptr; ///< Forma a dibujar.
+};
+
+/**
+ * @class RenderQueue
+ * @brief Cola de comandos de dibujo ordenada por una clave de 64 bits.
+ *
+ * La clave empaqueta, de mayor a menor peso: capa (8 bits), identificador de textura (24 bits),
+ * profundidad (16 bits) y material (16 bits). Cada fotograma la cola se ordena con radix sort
+ * LSD de 8 bits por pasada, saltando las pasadas en las que todos los comandos comparten el
+ * mismo byte, y los comandos ordenados se envían al `BatchRenderer`. Los comandos viven en
+ * arreglos que se vacían sin liberar su memoria, así que después de los primeros fotogramas
+ * la cola solo reserva una entrada por textura distinta del fotograma.
+ *
+ * Los identificadores de textura valen solo dentro del fotograma: la tabla se rehace en cada
+ * `begin`, así que no crece con las texturas que la caché expulsa y vuelve a cargar, y una
+ * textura nueva en la dirección de una liberada no hereda su identificador.
+ */
+class RenderQueue {
+public:
+    static constexpr int LAYER_SHIFT = 56;    ///< Capa: bits 63-56.
+    static constexpr int TEXTURE_SHIFT = 32;  ///< Textura: bits 55-32.
+    static constexpr int DEPTH_SHIFT = 16;    ///< Profundidad: bits 31-16.
+    static constexpr uint64_t TEXTURE_MASK = 0xFFFFFF;
+
+    RenderQueue() = default; ///< Constructor por defecto.
+    ~RenderQueue() = default; ///< Destructor por defecto.
+
+    /**
+     * @brief Inicia un fotograma: vacía los comandos conservando su memoria y la tabla de texturas.
+     */
+    void
+    begin() {
+        m_commands.clear();
+        m_textureIds.clear();
+    }
+
+    /**
+     * @brief Agrega una forma a la cola.
+     * @param shape Forma a dibujar; debe seguir viva hasta `flush`.
+     * @param layer Capa de dibujo (las capas menores se dibujan primero).
+     * @param depth Profundidad dentro de la capa, en [0, 1].
+     * @param blendMode Modo de mezcla; se traduce a un identificador de material.
+     */
+    void submit(const ShapeFactory& shape, uint8_t layer, float depth = 0.0f,
+                const sf::BlendMode& blendMode = sf::BlendAlpha);
+
+    /**
+     * @brief Agrega un comando con clave ya calculada.
+     */
+    void submit(const RenderCommand& command) { m_commands.push_back(command); }
+
+    /**
+     * @brief Ordena los comandos por clave (radix sort estable).
+     */
+    void sort();
+
+    /**
+     * @brief Envía los comandos, en el orden actual, al renderizador por lotes.
+     * @param batchRenderer Renderizador que recibe las formas.
+     */
+    void flush(BatchRenderer& batchRenderer) const;
+
+    /**
+     * @brief Construye una clave de orden.
+     * @param layer Capa.
+     * @param textureId Identificador de textura (se usan 24 bits).
+     * @param depth Profundidad cuantizada a 16 bits.
+     * @param material Identificador de material.
+     */
+    static uint64_t
+    makeKey(uint8_t layer, uint32_t textureId, uint16_t depth, uint16_t material) {
+        return (static_cast<uint64_t>(layer) << LAYER_SHIFT) |
+               ((static_cast<uint64_t>(textureId) & TEXTURE_MASK) << TEXTURE_SHIFT) |
+               (static_cast<uint64_t>(depth) << DEPTH_SHIFT) |
+               static_cast<uint64_t>(material);
+    }
+
+    /**
+     * @brief Identificador de una textura dentro del fotograma (0 para formas sin textura).
+     */
+    uint32_t getTextureId(const sf::Texture* texture);
+
+    /**
+     * @brief Identificador estable de un modo de mezcla.
+     */
+    uint16_t getMaterialId(const sf::BlendMode& blendMode);
+
+    // Inspección de la cola.
+    size_t getCommandCount() const { return m_commands.size(); }
+    const RenderCommand& getCommand(size_t index) const { return m_commands[index]; }
+
+    /**
+     * @brief Pasadas de radix que se ejecutaron en el último `sort` (de 0 a 8).
+     */
+    int getSortPassCount() const { return m_sortPassCount; }
+
+private:
+    std::vector<RenderCommand> m_commands; ///< Comandos del fotograma.
+    std::vector<RenderCommand> m_scratch;  ///< Destino de cada pasada de radix.
+    std::unordered_map<const sf::Texture*, uint32_t> m_textureIds; ///< Textura -> identificador (del fotograma).
+    std::vector<sf::BlendMode> m_materials{ sf::BlendAlpha }; ///< Identificador -> modo de mezcla.
+    int m_sortPassCount = 0; ///< Pasadas del último ordenamiento.
+};
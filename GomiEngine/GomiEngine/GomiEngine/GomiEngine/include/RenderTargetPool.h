@@ -0,0 +1,71 @@
+#pragma once
+#include "Prerequisites.h"
+
+/**
+ * @class RenderTargetPool
+ * @brief Reutiliza texturas de render agrupadas por clase de tamaño.
+ *
+ * Cada pedido se redondea hacia arriba a múltiplos de `SIZE_GRANULARITY`; quien lo pide dibuja
+ * solo en la subregión que necesita (ver `RenderViewport`). Así, cambiar de tamaño dentro de la
+ * misma clase no toca la GPU, y varias vistas (Scene, Game, vistas previas) comparten las
+ * texturas que otras liberaron.
+ */
+class RenderTargetPool {
+public:
+    static constexpr unsigned int SIZE_GRANULARITY = 256; ///< Paso de las clases de tamaño en píxeles.
+    static constexpr size_t MAX_FREE_TARGETS = 2;         ///< Texturas libres que se conservan.
+
+    RenderTargetPool() = default; ///< Constructor por defecto.
+    ~RenderTargetPool() = default; ///< Destructor por defecto.
+
+    // Deshabilitar copia y asignación
+    RenderTargetPool(const RenderTargetPool&) = delete;
+    RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+    /**
+     * @brief Entrega una textura libre de la clase de tamaño pedida, o crea una nueva.
+     * @param size Tamaño mínimo en píxeles.
+     * @return Textura reservada, o nullptr si no se pudo crear.
+     */
+    sf::RenderTexture* acquire(const sf::Vector2u& size);
+
+    /**
+     * @brief Devuelve una textura al pool sin liberarla.
+     * Si quedan más de `MAX_FREE_TARGETS` libres se destruye la que lleva más tiempo libre.
+     * @param target Textura obtenida con `acquire`.
+     */
+    void release(sf::RenderTexture* target);
+
+    /**
+     * @brief Libera las texturas que nadie está usando.
+     */
+    void trim();
+
+    /**
+     * @brief Clase de tamaño (tamaño real de la textura) para un pedido.
+     */
+    static sf::Vector2u getSizeClass(const sf::Vector2u& size);
+
+    // Estadísticas.
+    size_t getAllocationCount() const { return m_allocationCount; } ///< Texturas creadas en la GPU.
+    size_t getReuseCount() const { return m_reuseCount; }           ///< Pedidos servidos sin crear.
+    size_t getTargetCount() const { return m_entries.size(); }      ///< Texturas vivas.
+    size_t getInUseCount() const;                                   ///< Texturas reservadas.
+
+private:
+    /**
+     * @struct Entry
+     * @brief Textura del pool y su estado.
+     */
+    struct Entry {
+        std::unique_ptr<sf::RenderTexture> texture; ///< Textura de render.
+        sf::Vector2u sizeClass;                     ///< Tamaño con el que se creó.
+        bool inUse = false;                         ///< Está reservada.
+        size_t releaseStamp = 0;                    ///< Orden en que se liberó.
+    };
+
+    std::vector<Entry> m_entries;  ///< Texturas del pool.
+    size_t m_allocationCount = 0;  ///< Texturas creadas.
+    size_t m_reuseCount = 0;       ///< Pedidos reutilizados.
+    size_t m_releaseCounter = 0;   ///< Contador para ordenar las liberaciones.
+};
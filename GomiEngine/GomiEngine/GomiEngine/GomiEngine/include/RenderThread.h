@@ -0,0 +1,117 @@
+#pragma once
+#include "Prerequisites.h"
+#include "BatchRenderer.h"
+#include "SceneSnapshot.h"
+#include "TripleBuffer.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+/**
+ * @class RenderThread
+ * @brief Dibuja la escena en un hilo propio a partir de instantáneas de la simulación.
+ *
+ * El hilo principal llena una `SceneSnapshot` por fotograma y la publica; el hilo de render toma
+ * siempre la más reciente, la dibuja en una de sus tres `sf::RenderTexture` y publica el
+ * resultado, que el hilo principal muestra en ImGui. Ambos intercambios usan `TripleBuffer`, así
+ * que ningún hilo espera al otro: la simulación del fotograma N+1 se ejecuta mientras se dibuja
+ * el fotograma N. ImGui y la ventana siguen en el hilo principal.
+ */
+class RenderThread {
+public:
+    RenderThread() = default; ///< Constructor por defecto.
+
+    /**
+     * @brief Detiene el hilo si sigue en ejecución.
+     */
+    ~RenderThread();
+
+    // Deshabilitar copia y asignación
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    /**
+     * @brief Crea las texturas de render y arranca el hilo.
+     * @param width Ancho de la escena en píxeles.
+     * @param height Alto de la escena en píxeles.
+     * @return `true` si las texturas se crearon y el hilo arrancó.
+     */
+    bool start(unsigned int width, unsigned int height);
+
+    /**
+     * @brief Detiene el hilo y espera a que termine el fotograma en curso.
+     */
+    void stop();
+
+    /**
+     * @brief Indica si el hilo está en ejecución.
+     */
+    bool isRunning() const { return m_running.load(); }
+
+    /**
+     * @brief Instantánea vacía que el hilo principal debe llenar (solo hilo principal).
+     */
+    SceneSnapshot& beginSnapshot();
+
+    /**
+     * @brief Publica la instantánea llenada y despierta al hilo de render (solo hilo principal).
+     */
+    void submitSnapshot();
+
+    /**
+     * @brief Espera a que la GPU termine lo que envió el hilo principal (p. ej. texturas recién
+     * subidas por `ResourceManager::processUploads`) antes de que una instantánea las use desde el
+     * contexto del hilo de render (solo hilo principal).
+     */
+    void finishUploads();
+
+    /**
+     * @brief Último fotograma terminado por el hilo de render (solo hilo principal).
+     * @return Textura del fotograma, o nullptr si todavía no hay ninguno.
+     */
+    const sf::Texture* acquireFrame();
+
+    // Mediciones (se pueden leer desde cualquier hilo).
+    float getRenderMs() const { return m_renderMs.load(); }   ///< Duración del último fotograma dibujado.
+    float getLatencyMs() const { return m_latencyMs.load(); } ///< De la publicación a la imagen terminada.
+    unsigned long long getRenderedFrameCount() const { return m_renderedFrameCount.load(); }
+    size_t getDrawCallCount() const { return m_drawCallCount.load(); } ///< Llamadas de dibujo del último fotograma.
+    size_t getItemCount() const { return m_itemCount.load(); }         ///< Formas del último fotograma.
+
+    /**
+     * @brief Instantáneas publicadas que se reemplazaron antes de dibujarse (solo hilo principal).
+     */
+    unsigned long long getDroppedSnapshotCount() const { return m_droppedSnapshotCount; }
+
+private:
+    /**
+     * @brief Bucle del hilo de render.
+     */
+    void run();
+
+    /**
+     * @brief Dibuja una instantánea ordenada por capa y textura.
+     */
+    void renderSnapshot(const SceneSnapshot& snapshot, sf::RenderTexture& target);
+
+    TripleBuffer<SceneSnapshot> m_snapshots;     ///< Simulación -> render.
+    TripleBuffer<sf::RenderTexture> m_frames;    ///< Render -> hilo principal.
+    BatchRenderer m_batchRenderer;               ///< Solo lo usa el hilo de render.
+    std::vector<uint32_t> m_drawOrder;           ///< Índices de elementos ordenados (hilo de render).
+
+    std::thread m_thread;                        ///< Hilo de render.
+    std::atomic<bool> m_running{ false };        ///< El hilo debe seguir ejecutándose.
+    std::mutex m_wakeMutex;                      ///< Solo protege la espera del hilo.
+    std::condition_variable m_wake;              ///< Despierta al hilo al publicar.
+    bool m_snapshotPending = false;              ///< Hay una instantánea sin procesar.
+
+    unsigned long long m_frameIndex = 0;         ///< Instantáneas publicadas (hilo principal).
+    unsigned long long m_droppedSnapshotCount = 0; ///< Instantáneas descartadas (hilo principal).
+    bool m_hasFrame = false;                     ///< Ya se recibió al menos un fotograma.
+
+    std::atomic<float> m_renderMs{ 0.0f };       ///< Duración del último fotograma dibujado.
+    std::atomic<float> m_latencyMs{ 0.0f };      ///< Latencia del último fotograma dibujado.
+    std::atomic<unsigned long long> m_renderedFrameCount{ 0 }; ///< Fotogramas dibujados.
+    std::atomic<size_t> m_drawCallCount{ 0 };    ///< Llamadas de dibujo del último fotograma.
+    std::atomic<size_t> m_itemCount{ 0 };        ///< Formas del último fotograma.
+};
@@ -0,0 +1,83 @@
+#pragma once
+#include "Prerequisites.h"
+#include "RenderTargetPool.h"
+
+/**
+ * @class RenderViewport
+ * @brief Vista con nombre (Scene, Game, vista previa) que dibuja en una textura del pool.
+ *
+ * La textura puede ser mayor que la vista: se dibuja en la subregión superior izquierda mediante
+ * el viewport de `sf::View` y ImGui muestra solo esa subregión. Cambiar de tamaño solo pide otra
+ * textura cuando la vista deja de caber o queda en menos de la mitad de la textura.
+ */
+class RenderViewport {
+public:
+    /**
+     * @brief Crea la vista sin textura; se reserva en el primer `resize`.
+     * @param pool Pool compartido con las demás vistas.
+     * @param name Nombre de la ventana de ImGui.
+     */
+    RenderViewport(RenderTargetPool& pool, const std::string& name)
+        : m_pool(pool), m_name(name) {}
+
+    /**
+     * @brief Devuelve la textura al pool.
+     */
+    ~RenderViewport();
+
+    // Deshabilitar copia y asignación
+    RenderViewport(const RenderViewport&) = delete;
+    RenderViewport& operator=(const RenderViewport&) = delete;
+
+    /**
+     * @brief Ajusta el tamaño visible.
+     * @param size Tamaño en píxeles.
+     * @return `true` si la vista tiene una textura válida.
+     */
+    bool resize(const sf::Vector2u& size);
+
+    /**
+     * @brief Cámara de la vista; si no se asigna, una unidad equivale a un píxel.
+     * @param view Vista de SFML (su viewport se reemplaza por la subregión).
+     */
+    void setCamera(const sf::View& view);
+
+    /**
+     * @brief Limpia la textura y aplica la cámara con la subregión.
+     * @param color Color de fondo.
+     */
+    void clear(const sf::Color& color = sf::Color::Black);
+
+    /**
+     * @brief Dibuja en la textura de la vista.
+     */
+    void draw(const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+
+    /**
+     * @brief Termina el fotograma de la textura.
+     */
+    void display();
+
+    /**
+     * @brief Muestra la subregión dibujada en una ventana de ImGui con el nombre de la vista.
+     */
+    void showInImGui();
+
+    // Acceso.
+    sf::RenderTexture* getTarget() { return m_target; }
+    const sf::Vector2u& getSize() const { return m_size; }
+    const std::string& getName() const { return m_name; }
+
+private:
+    /**
+     * @brief Cámara con el viewport limitado a la subregión visible.
+     */
+    sf::View makeView() const;
+
+    RenderTargetPool& m_pool;           ///< Pool compartido.
+    std::string m_name;                 ///< Nombre de la ventana de ImGui.
+    sf::RenderTexture* m_target = nullptr; ///< Textura reservada (propiedad del pool).
+    sf::Vector2u m_size;                ///< Tamaño visible.
+    sf::View m_camera;                  ///< Cámara asignada.
+    bool m_hasCamera = false;           ///< Se asignó una cámara.
+};
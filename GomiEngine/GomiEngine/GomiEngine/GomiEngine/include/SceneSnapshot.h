@@ -0,0 +1,66 @@
+#pragma once
+#include "Prerequisites.h"
+#include "Services/GeometryCache.h"
+#include "Texture.h"
+#include <chrono>
+#include <cstdint>
+
+class ShapeFactory;
+
+/**
+ * @struct SnapshotItem
+ * @brief Estado de dibujo de una forma, copiado desde la simulación.
+ */
+struct SnapshotItem {
+    float transform[6] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f }; ///< Matriz afín 2x3 por filas.
+    sf::Color color;          ///< Color de relleno.
+    uint32_t textureId = 0;   ///< Índice en `SceneSnapshot::textures` (0 = sin textura).
+    sf::IntRect textureRect;  ///< Región de la textura en píxeles.
+    const ShapeGeometry* geometry = nullptr; ///< Geometría compartida (inmutable, segura entre hilos).
+    uint8_t layer = 0;        ///< Capa de dibujo.
+};
+
+/**
+ * @class SceneSnapshot
+ * @brief Copia compacta de lo que se necesita para dibujar un fotograma.
+ *
+ * La simulación la llena en su hilo y el hilo de render la consume sin tocar actores ni formas;
+ * la geometría no se copia porque la caché nunca la modifica ni la libera. Las texturas de la
+ * caché se retienen con `textureRefs` mientras la instantánea esté en uso, así que
+ * `ResourceManager` no las expulsa aunque el hilo de render siga dibujando con ellas; como el
+ * contador de `TSharedPointer` no es atómico, solo el hilo principal llena y vacía instantáneas.
+ * Los arreglos se vacían sin liberar memoria, así que capturar no reserva memoria una vez que
+ * la escena se estabiliza.
+ */
+class SceneSnapshot {
+public:
+    SceneSnapshot() = default; ///< Constructor por defecto.
+    ~SceneSnapshot() = default; ///< Destructor por defecto.
+
+    /**
+     * @brief Vacía la instantánea conservando su memoria.
+     */
+    void clear();
+
+    /**
+     * @brief Copia el estado de dibujo de una forma.
+     * @param shape Componente de forma a copiar.
+     * @param layer Capa de dibujo del actor.
+     */
+    void capture(const ShapeFactory& shape, uint8_t layer);
+
+    /**
+     * @brief Reconstruye la transformación de SFML de un elemento.
+     */
+    static sf::Transform
+    getTransform(const SnapshotItem& item) {
+        const float* m = item.transform;
+        return sf::Transform(m[0], m[1], m[2], m[3], m[4], m[5], 0.0f, 0.0f, 1.0f);
+    }
+
+    std::vector<SnapshotItem> items;            ///< Formas en orden de captura.
+    std::vector<const sf::Texture*> textures{ nullptr }; ///< Identificador -> textura.
+    std::vector<EngineUtilities::TSharedPointer<Texture>> textureRefs; ///< Retienen en la caché las texturas de `textures`.
+    unsigned long long frameIndex = 0;          ///< Fotograma de simulación que la generó.
+    std::chrono::steady_clock::time_point publishTime; ///< Momento en que se publicó.
+};
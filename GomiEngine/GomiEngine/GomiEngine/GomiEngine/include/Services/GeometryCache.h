@@ -0,0 +1,154 @@
+#pragma once
+#include "Prerequisites.h"
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
+/**
+ * @struct ShapeGeometry
+ * @brief Contorno teselado de una forma en coordenadas locales, compartido entre actores.
+ */
+struct ShapeGeometry {
+  ShapeType type = ShapeType::EMPTY;  ///< Tipo de forma.
+  sf::Vector2f size;                  ///< Tamaño local (diámetro en círculos).
+  unsigned int pointCount = 0;        ///< Puntos del contorno.
+  std::vector<sf::Vector2f> points;   ///< Contorno convexo en coordenadas locales.
+  sf::FloatRect bounds;               ///< Límites locales de los puntos.
+};
+
+class
+GeometryCache {
+private:
+  /**
+   * @brief Constructor privado para evitar instancias múltiples.
+   */
+  GeometryCache() = default;
+
+  // Deshabilitar copia y asignación
+  GeometryCache(const GeometryCache&) = delete;
+  GeometryCache& operator=(const GeometryCache&) = delete;
+
+public:
+  /**
+   * @brief Accede a la instancia única de la caché de geometría.
+   * @return Referencia a la GeometryCache.
+   */
+  static
+  GeometryCache& getInstance() {
+    static GeometryCache instance;
+    return instance;
+  }
+
+  /**
+   * @brief Obtiene la geometría para un tipo, tamaño y cantidad de puntos; la crea la primera vez.
+   * Las geometrías nunca se liberan, así que el puntero es válido durante toda la ejecución
+   * y se puede leer desde cualquier hilo.
+   * @param type Tipo de forma.
+   * @param size Tamaño local de la forma.
+   * @param pointCount Puntos del contorno (se ignora en rectángulos).
+   * @return Geometría compartida.
+   */
+  const ShapeGeometry*
+  getGeometry(ShapeType type, const sf::Vector2f& size, unsigned int pointCount) {
+    if (type == ShapeType::RECTANGLE) {
+      pointCount = 4;
+    }
+    Key key{ type, size.x, size.y, pointCount };
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_geometries.find(key);
+    if (it != m_geometries.end()) {
+      return &it->second;
+    }
+
+    ShapeGeometry& geometry = m_geometries[key];
+    tessellate(type, size, pointCount, geometry);
+    return &geometry;
+  }
+
+  /**
+   * @brief Cantidad de geometrías distintas en la caché.
+   */
+  size_t
+  getGeometryCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_geometries.size();
+  }
+
+  /**
+   * @brief Bytes ocupados por las geometrías (estructuras y puntos).
+   */
+  size_t
+  getMemoryUsage() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t bytes = 0;
+    for (const auto& pair : m_geometries) {
+      bytes += sizeof(pair) + pair.second.points.capacity() * sizeof(sf::Vector2f);
+    }
+    return bytes;
+  }
+
+private:
+  /**
+   * @struct Key
+   * @brief Tipo, tamaño y cantidad de puntos de una geometría.
+   */
+  struct Key {
+    ShapeType type;
+    float width;
+    float height;
+    unsigned int pointCount;
+
+    bool
+    operator<(const Key& other) const {
+      if (type != other.type) return type < other.type;
+      if (width != other.width) return width < other.width;
+      if (height != other.height) return height < other.height;
+      return pointCount < other.pointCount;
+    }
+  };
+
+  /**
+   * @brief Genera el contorno con la misma convención que sf::CircleShape y sf::RectangleShape.
+   */
+  static void
+  tessellate(ShapeType type, const sf::Vector2f& size, unsigned int pointCount, ShapeGeometry& geometry) {
+    geometry.type = type;
+    geometry.size = size;
+    geometry.pointCount = pointCount;
+    geometry.points.resize(pointCount);
+
+    if (type == ShapeType::RECTANGLE) {
+      geometry.points[0] = sf::Vector2f(0.0f, 0.0f);
+      geometry.points[1] = sf::Vector2f(size.x, 0.0f);
+      geometry.points[2] = sf::Vector2f(size.x, size.y);
+      geometry.points[3] = sf::Vector2f(0.0f, size.y);
+    }
+    else {
+      // Elipse inscrita en `size`, empezando arriba como en sf::CircleShape.
+      const float pi = 3.141592654f;
+      sf::Vector2f radius(size.x * 0.5f, size.y * 0.5f);
+      for (unsigned int i = 0; i < pointCount; ++i) {
+        float angle = i * 2.0f * pi / pointCount - pi / 2.0f;
+        geometry.points[i] = sf::Vector2f(std::cos(angle) * radius.x + radius.x,
+                                          std::sin(angle) * radius.y + radius.y);
+      }
+    }
+
+    geometry.bounds = sf::FloatRect(0.0f, 0.0f, size.x, size.y);
+    if (!geometry.points.empty()) {
+      sf::Vector2f minimum = geometry.points[0];
+      sf::Vector2f maximum = geometry.points[0];
+      for (const sf::Vector2f& point : geometry.points) {
+        minimum.x = std::min(minimum.x, point.x);
+        minimum.y = std::min(minimum.y, point.y);
+        maximum.x = std::max(maximum.x, point.x);
+        maximum.y = std::max(maximum.y, point.y);
+      }
+      geometry.bounds = sf::FloatRect(minimum, maximum - minimum);
+    }
+  }
+
+  std::map<Key, ShapeGeometry> m_geometries; ///< Geometrías por clave (los nodos no se mueven).
+  mutable std::mutex m_mutex;                ///< Protege el mapa.
+};
@@ -0,0 +1,149 @@
+#pragma once
+#include "Prerequisites.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+class
+JobSystem {
+private:
+  /**
+   * @brief Constructor privado: crea un hilo de trabajo por núcleo (menos el hilo principal).
+   */
+  JobSystem() {
+    unsigned int cores = std::thread::hardware_concurrency();
+    unsigned int workerCount = cores > 1 ? cores - 1 : 1;
+    for (unsigned int i = 0; i < workerCount; ++i) {
+      m_workers.emplace_back([this]() { workerLoop(); });
+    }
+  }
+
+  /**
+   * @brief Detiene los hilos después de terminar los trabajos pendientes.
+   */
+  ~JobSystem() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+    }
+    m_jobAvailable.notify_all();
+    for (auto& worker : m_workers) {
+      worker.join();
+    }
+  }
+
+  // Deshabilitar copia y asignación
+  JobSystem(const JobSystem&) = delete;
+  JobSystem& operator=(const JobSystem&) = delete;
+
+public:
+  /**
+   * @brief Accede a la instancia única del sistema de trabajos.
+   * @return Referencia al JobSystem.
+   */
+  static
+  JobSystem& getInstance() {
+    static JobSystem instance;
+    return instance;
+  }
+
+  /**
+   * @brief Encola un trabajo para ejecutarse en algún hilo de trabajo.
+   * @param job Función a ejecutar.
+   */
+  void
+  submit(std::function<void()> job) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_jobs.push_back(std::move(job));
+    }
+    m_jobAvailable.notify_one();
+  }
+
+  /**
+   * @brief Ejecuta `body(i)` para cada i en [0, count) repartiendo los índices entre los hilos.
+   * El hilo que llama también trabaja y la función regresa cuando todos los índices terminaron,
+   * por lo que se puede llamar desde dentro de otro trabajo sin bloquear el sistema.
+   * @param count Cantidad de índices.
+   * @param body Función a ejecutar por índice.
+   */
+  void
+  parallelFor(size_t count, const std::function<void(size_t)>& body) {
+    if (count == 0) {
+      return;
+    }
+    if (count == 1 || m_workers.empty()) {
+      for (size_t i = 0; i < count; ++i) {
+        body(i);
+      }
+      return;
+    }
+
+    struct SharedState {
+      std::atomic<size_t> next{ 0 };
+      std::atomic<size_t> finished{ 0 };
+      std::mutex mutex;
+      std::condition_variable done;
+    };
+    auto state = std::make_shared<SharedState>();
+    const std::function<void(size_t)>* bodyPtr = &body;
+
+    // Cada ayudante toma índices hasta agotarlos; si llega tarde, sale sin tocar `body`.
+    auto drain = [state, bodyPtr, count]() {
+      for (size_t i = state->next.fetch_add(1); i < count; i = state->next.fetch_add(1)) {
+        (*bodyPtr)(i);
+        if (state->finished.fetch_add(1) + 1 == count) {
+          std::lock_guard<std::mutex> lock(state->mutex);
+          state->done.notify_all();
+        }
+      }
+    };
+
+    size_t helpers = std::min(count - 1, m_workers.size());
+    for (size_t i = 0; i < helpers; ++i) {
+      submit(drain);
+    }
+    drain();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [&]() { return state->finished.load() == count; });
+  }
+
+  /**
+   * @brief Cantidad de hilos de trabajo.
+   */
+  size_t
+  getWorkerCount() const {
+    return m_workers.size();
+  }
+
+private:
+  /**
+   * @brief Bucle de cada hilo: espera trabajos y los ejecuta hasta que el sistema se detiene.
+   */
+  void
+  workerLoop() {
+    for (;;) {
+      std::function<void()> job;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_jobAvailable.wait(lock, [this]() { return m_stopping || !m_jobs.empty(); });
+        if (m_jobs.empty()) {
+          return;
+        }
+        job = std::move(m_jobs.front());
+        m_jobs.pop_front();
+      }
+      job();
+    }
+  }
+
+  std::vector<std::thread> m_workers;         ///< Hilos de trabajo.
+  std::deque<std::function<void()>> m_jobs;   ///< Trabajos pendientes.
+  std::mutex m_mutex;                         ///< Protege la cola de trabajos.
+  std::condition_variable m_jobAvailable;     ///< Despierta a los hilos cuando hay trabajo.
+  bool m_stopping = false;                    ///< Indica que el sistema se está deteniendo.
+};
@@ -1,13 +1,34 @@
 ﻿#pragma once
 #include "Prerequisites.h"
+#include "LogHistory.h"
+#include "LogRing.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string_view>
 
+/**
+ * @class NotificationService
+ * @brief Registro de mensajes del motor.
+ *
+ * Cualquier hilo (incluidos los de `JobSystem`) puede escribir: cada mensaje se copia en un
+ * `LogRing` sin bloqueos ni reservas de memoria. El hilo principal los consume una vez por
+ * fotograma con `pump` y los pasa, sin formatear, a un historial acotado; todo lo que lee mensajes
+ * (consola, archivo) usa ese historial y solo debe llamarse desde el hilo principal. Si hay un `LogSink`
+ * corriendo, él es el único consumidor del búfer y `pump` solo recoge lo que el sink le entrega.
+ */
 class
 NotificationService {
 private:
   /**
    * @brief Constructor privado para evitar instancias múltiples.
    */
-  NotificationService() = default;
+  NotificationService()
+    : m_ring(RING_CAPACITY), m_origin(std::chrono::steady_clock::now()), m_history(HISTORY_CAPACITY) {}
 
 public:
   /**
@@ -21,22 +42,187 @@ public:
   }
 
   /**
-   * @brief Agrega un mensaje de notificación.
+   * @brief Agrega un mensaje de notificación. Se puede llamar desde cualquier hilo.
    * @param errType Tipo de error de la notificación.
    * @param message Mensaje a agregar.
    */
   void 
   addMessage(ConsolErrorType errType, const std::string& message) {
-    m_programMessages[errType] = message;
+    log(errType, "Engine", message);
   }
 
   /**
-   * @brief Muestra todos los mensajes en consola.
+   * @brief Escribe un mensaje sin bloquear ni reservar memoria; el texto se recorta a
+   * `LogRecord::MAX_TEXT - 1` bytes.
+   * @param severity Severidad.
+   * @param source Origen; debe ser una cadena estática porque solo se guarda el puntero.
+   * @param text Texto del mensaje.
+   * @return false si el mensaje se descartó porque el búfer estaba lleno.
+   */
+  bool
+  log(ConsolErrorType severity, const char* source, std::string_view text) {
+    bool stored = m_ring.push([&](LogRecord& record) {
+      fillHeader(record, severity, source);
+      record.format = nullptr;
+      record.length = static_cast<uint32_t>(std::min(text.size(), LogRecord::MAX_TEXT - 1));
+      std::memcpy(record.text, text.data(), record.length);
+      record.text[record.length] = '\0';
+    });
+    return stored;
+  }
+
+  /**
+   * @brief Como `log`, pero con formato de `printf`, escrito directamente en el búfer.
+   */
+  bool
+  logf(ConsolErrorType severity, const char* source, const char* format, ...) {
+    va_list arguments;
+    va_start(arguments, format);
+    bool stored = m_ring.push([&](LogRecord& record) {
+      fillHeader(record, severity, source);
+      record.format = nullptr;
+      int written = std::vsnprintf(record.text, LogRecord::MAX_TEXT, format, arguments);
+      record.length = static_cast<uint32_t>(std::min<size_t>(written < 0 ? 0 : written, LogRecord::MAX_TEXT - 1));
+      record.text[record.length] = '\0';
+    });
+    va_end(arguments);
+    return stored;
+  }
+
+  /**
+   * @brief Escribe un mensaje de `GOMI_LOG`: solo copia los argumentos ya codificados; el texto
+   * se arma solo cuando alguien lo lee: el archivo de texto de `LogSink` o la consola, que formatea
+   * las líneas que muestra (ver `LogLine::getText`).
+   * @param format Datos estáticos de la llamada; se le asigna su identificador en el primer uso.
+   * @param args Argumentos codificados por `LogArgWriter`.
+   * @param size Bytes de `args` (a lo sumo `LogRecord::MAX_TEXT`).
+   * @return false si el mensaje se descartó porque el búfer estaba lleno.
+   */
+  bool
+  logStructured(LogFormat& format, const uint8_t* args, size_t size) {
+    if (format.id.load(std::memory_order_relaxed) == 0) {
+      uint32_t unassigned = 0;
+      format.id.compare_exchange_strong(unassigned, m_nextFormatId.fetch_add(1, std::memory_order_relaxed));
+    }
+    bool stored = m_ring.push([&](LogRecord& record) {
+      fillHeader(record, format.severity, format.source);
+      record.format = &format;
+      record.length = static_cast<uint32_t>(std::min(size, LogRecord::MAX_TEXT));
+      std::memcpy(record.text, args, record.length);
+    });
+    return stored;
+  }
+
+  /**
+   * @brief Entrega a `consume(const LogRecord&)` los mensajes pendientes, del más antiguo al más
+   * nuevo. Solo puede haber un hilo consumiendo a la vez.
+   * @param maxCount Máximo de mensajes a consumir en esta llamada.
+   * @return Cantidad de mensajes consumidos.
+   */
+  template<typename Consume>
+  size_t
+  drain(Consume&& consume, size_t maxCount = SIZE_MAX) {
+    size_t count = 0;
+    LogRecord record;
+    while (count < maxCount && m_ring.pop(record)) {
+      consume(record);
+      ++count;
+    }
+    return count;
+  }
+
+  /**
+   * @brief Pasa los mensajes pendientes al historial. Llamar una vez por fotograma desde el hilo
+   * principal.
+   * @return Cantidad de mensajes nuevos.
+   */
+  size_t
+  pump() {
+    std::vector<LogRecord> delivered;
+    {
+      std::lock_guard<std::mutex> lock(m_deliveredMutex);
+      delivered.swap(m_delivered);
+    }
+    for (const LogRecord& record : delivered) {
+      addToHistory(record);
+    }
+    if (m_externalConsumer.load(std::memory_order_acquire)) {
+      return delivered.size();
+    }
+    return delivered.size() + drain([this](const LogRecord& record) { addToHistory(record); });
+  }
+
+  /**
+   * @brief Indica que otro hilo (el `LogSink`) consume el búfer; mientras tanto `pump` no lo toca.
+   */
+  void
+  setExternalConsumer(bool external) {
+    m_externalConsumer.store(external, std::memory_order_release);
+  }
+
+  /**
+   * @brief Entrega mensajes ya consumidos por el hilo externo (sin formatear) para el siguiente `pump`.
+   * @param records Se vacía al entregar.
+   */
+  void
+  deliver(std::vector<LogRecord>& records) {
+    std::lock_guard<std::mutex> lock(m_deliveredMutex);
+    for (const LogRecord& record : records) {
+      // Si el hilo principal no recoge, se conservan solo los más nuevos.
+      if (m_delivered.size() == DELIVERY_CAPACITY) {
+        m_delivered.erase(m_delivered.begin(), m_delivered.begin() + DELIVERY_CAPACITY / 2);
+      }
+      m_delivered.push_back(record);
+    }
+    records.clear();
+  }
+
+  /**
+   * @brief Cambia qué se descarta cuando el búfer se llena.
+   */
+  void
+  setOverflowPolicy(LogOverflow overflow) {
+    m_ring.setOverflow(overflow);
+  }
+
+  /**
+   * @brief Mensajes descartados por falta de lugar desde el inicio.
+   */
+  uint64_t
+  getDroppedCount() const {
+    return m_ring.getDroppedCount();
+  }
+
+  /**
+   * @brief Mensajes consumidos por `pump`, del más antiguo al más nuevo. Se lee sin copiar (ver
+   * `LogConsole`); solo desde el hilo principal.
+   */
+  const LogHistory&
+  getHistory() const {
+    return m_history;
+  }
+
+  /**
+   * @brief Mensajes que entraron al búfer desde el inicio; crece con cada mensaje aceptado (sirve
+   * para saber si la consola cambió). Los descartados se informan aparte en `getDroppedCount`: con
+   * DROP_NEWEST nunca entraron, con DROP_OLDEST entraron y se descartaron después, así que no se
+   * suman. Sale del búfer, así que escribir no paga otro contador atómico.
+   */
+  size_t
+  getMessageCount() const {
+    return static_cast<size_t>(m_ring.getPushedCount());
+  }
+
+  /**
+   * @brief Muestra todos los mensajes del historial en consola.
    */
   void 
-  showAllMessages() const {
-    for (const auto& pair : m_programMessages) {
-      std::cout << "Code: " << pair.first << " - Message: " << pair.second << std::endl;
+  showAllMessages() {
+    pump();
+    char buffer[LOG_MESSAGE_BYTES];
+    for (uint64_t sequence = m_history.getFirstSequence(); sequence < m_history.getEndSequence(); ++sequence) {
+      LogLine entry = m_history.at(sequence);
+      std::cout << "Code: " << entry.severity << " - Message: " << entry.getText(buffer, sizeof(buffer)) << std::endl;
     }
   }
 
@@ -46,11 +232,11 @@ public:
    */
   std::string 
   getMessage(ConsolErrorType errType) const {
-    auto it = m_programMessages.find(errType);
-    if (it != m_programMessages.end()) {
-      return it->second;
+    if (errType < 0 || errType >= SEVERITY_COUNT || !m_hasLastRecord[errType]) {
+      return "Message not found";
     }
-    return "Message not found";
+    char message[LOG_MESSAGE_BYTES];
+    return std::string(message, formatLogMessage(m_lastRecords[errType], message, sizeof(message)));
   }
 
   /**
@@ -58,7 +244,8 @@ public:
    * @param filename Nombre del archivo donde se guardarán los mensajes.
    */
   void
-  saveMessagesToFile(const std::string& filename) const {
+  saveMessagesToFile(const std::string& filename) {
+    pump();
     std::ofstream file(filename);
     if (!file.is_open()) {
       std::cerr << "No se pudo abrir el archivo para guardar los mensajes." << std::endl;
@@ -66,11 +253,14 @@ public:
     }
 
     /**
-     * @brief Para cada "m_programMessages", escribe el código de error
-     * (`pair.first`) y el mensaje correspondiente (`pair.second`).
+     * @brief Para cada mensaje del historial escribe el momento, el hilo, el origen, el código
+     * de error y el texto.
      */
-    for (const auto& pair : m_programMessages) {
-      file << "Code: " << pair.first << " - Message: " << pair.second << "\n";
+    char buffer[LOG_MESSAGE_BYTES];
+    for (uint64_t sequence = m_history.getFirstSequence(); sequence < m_history.getEndSequence(); ++sequence) {
+      LogLine entry = m_history.at(sequence);
+      file << "[" << entry.timestampNs / 1000000 << " ms] [T" << entry.threadId << "] [" << entry.source
+           << "] Code: " << entry.severity << " - Message: " << entry.getText(buffer, sizeof(buffer)) << "\n";
     }
 
     /**
@@ -81,13 +271,17 @@ public:
   }
 
   /**
-   * @brief Obtiene las notificaciones almacenadas.
+   * @brief Obtiene el último mensaje de cada tipo; se formatean al pedirlos.
    */
   std::map<ConsolErrorType, std::string>& getNotifications() {
+    for (int severity = 0; severity < SEVERITY_COUNT; ++severity) {
+      if (m_hasLastRecord[severity]) {
+        m_programMessages[static_cast<ConsolErrorType>(severity)] = getMessage(static_cast<ConsolErrorType>(severity));
+      }
+    }
     return m_programMessages;
   }
 
-private:
   /**
    * @brief Obtiene un color para la notificación dependiendo del tipo de mensaje
    */
@@ -104,6 +298,63 @@ private:
     }
   }
 
-  // Mapa para almacenar los mensajes del progeama
+private:
+  // Agrega un mensaje al historial (que descarta el más antiguo si está lleno), sin formatearlo.
+  void
+  addToHistory(const LogRecord& record) {
+    m_history.append(record.timestampNs, record.source, record.severity, record.threadId, record.format,
+                     std::string_view(record.text, record.length));
+    if (record.severity >= 0 && record.severity < SEVERITY_COUNT) {
+      m_lastRecords[record.severity] = record;
+      m_hasLastRecord[record.severity] = true;
+    }
+  }
+
+  // Completa los campos comunes de un mensaje.
+  void
+  fillHeader(LogRecord& record, ConsolErrorType severity, const char* source) const {
+    record.timestampNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - m_origin).count());
+    record.source = source != nullptr ? source : "";
+    record.severity = severity;
+    record.threadId = getThreadId();
+  }
+
+  // Identificador corto del hilo actual (1 para el primero que escribe, 2 para el siguiente...).
+  static
+  uint32_t
+  getThreadId() {
+    static std::atomic<uint32_t> nextId{ 1 };
+    thread_local uint32_t id = nextId.fetch_add(1, std::memory_order_relaxed);
+    return id;
+  }
+
+  static constexpr size_t RING_CAPACITY = 8192;       ///< Mensajes sin consumir que caben (256 bytes cada uno).
+  static constexpr size_t HISTORY_CAPACITY = 1 << 20;  ///< Mensajes que guarda el historial.
+  static constexpr size_t DELIVERY_CAPACITY = 1 << 16; ///< Entregas que esperan a `pump`.
+  static constexpr int SEVERITY_COUNT = 3;             ///< NORMAL, WARNING y ERROR.
+
+  // Búfer donde escriben todos los hilos
+  LogRing m_ring;
+
+  // Momento de creación; los mensajes guardan el tiempo desde aquí
+  std::chrono::steady_clock::time_point m_origin;
+
+  // Mensajes consumidos (solo hilo principal)
+  LogHistory m_history;
+
+  // Mensajes que entregó el consumidor externo y aún no recoge `pump`
+  std::vector<LogRecord> m_delivered;
+  std::mutex m_deliveredMutex;
+
+  // El búfer lo consume otro hilo
+  std::atomic<bool> m_externalConsumer{ false };
+
+  // Último mensaje de cada tipo sin formatear, y su texto armado por `getNotifications` (solo hilo principal)
+  LogRecord m_lastRecords[SEVERITY_COUNT];
+  bool m_hasLastRecord[SEVERITY_COUNT] = {};
   std::map<ConsolErrorType, std::string> m_programMessages;
+
+  // Siguiente identificador para los formatos de GOMI_LOG
+  std::atomic<uint32_t> m_nextFormatId{ 1 };
 };
\ No newline at end of file
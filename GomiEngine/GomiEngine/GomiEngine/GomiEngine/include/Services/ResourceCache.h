@@ -0,0 +1,255 @@
+#pragma once
+#include "Prerequisites.h"
+#include "AssetArchive.h"
+#include "OpenHashMap.h"
+#include "Services/JobSystem.h"
+#include "Services/NotificationSystem.h"
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <atomic>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string_view>
+
+/**
+ * @struct ResourceLoader
+ * @brief Cómo cargar un tipo de recurso. Cada especialización define:
+ * - `LOADS_IN_BACKGROUND`: si `load` puede correr en un hilo de trabajo.
+ * - `load(recurso, nombre, bytes)`: carga desde `bytes` si vienen de un paquete o, si no, desde
+ *   el archivo `nombre`.
+ */
+template<typename T>
+struct ResourceLoader;
+
+/**
+ * @brief Fuentes (`.ttf`, `.otf`). Desde un paquete, SFML lee los bytes mientras la fuente exista;
+ * la proyección del paquete vive mientras esté montado.
+ */
+template<>
+struct ResourceLoader<sf::Font> {
+    static constexpr bool LOADS_IN_BACKGROUND = true;
+
+    static bool load(sf::Font& font, const std::string& name, const AssetSpan& packed) {
+        return packed ? font.loadFromMemory(packed.data, packed.size) : font.loadFromFile(name);
+    }
+};
+
+/**
+ * @brief Sonidos (`.wav`, `.ogg`, `.flac`), decodificados por completo al cargar.
+ */
+template<>
+struct ResourceLoader<sf::SoundBuffer> {
+    static constexpr bool LOADS_IN_BACKGROUND = true;
+
+    static bool load(sf::SoundBuffer& sound, const std::string& name, const AssetSpan& packed) {
+        return packed ? sound.loadFromMemory(packed.data, packed.size) : sound.loadFromFile(name);
+    }
+};
+
+/**
+ * @brief Shaders. Compilar necesita el contexto de OpenGL, así que se cargan en el hilo principal.
+ * Un nombre con extensión (`.vert`, `.geom`, `.frag`) es una sola etapa; sin extensión se cargan
+ * `<nombre>.vert` y `<nombre>.frag`.
+ */
+template<>
+struct ResourceLoader<sf::Shader> {
+    static constexpr bool LOADS_IN_BACKGROUND = false;
+
+    static bool load(sf::Shader& shader, const std::string& name, const AssetSpan& packed) {
+        if (!sf::Shader::isAvailable()) {
+            return false;
+        }
+        std::string extension = std::filesystem::path(name).extension().string();
+        if (extension.empty()) {
+            return shader.loadFromFile(name + ".vert", name + ".frag");
+        }
+        sf::Shader::Type type = extension == ".vert" ? sf::Shader::Vertex
+                              : extension == ".geom" ? sf::Shader::Geometry : sf::Shader::Fragment;
+        if (packed) {
+            return shader.loadFromMemory(std::string(static_cast<const char*>(packed.data), packed.size), type);
+        }
+        return shader.loadFromFile(name, type);
+    }
+};
+
+/**
+ * @struct ResourceCacheStats
+ * @brief Consultas y cargas de una caché de recursos.
+ */
+struct ResourceCacheStats {
+    size_t hits = 0;          ///< Consultas resueltas con un recurso residente.
+    size_t misses = 0;        ///< Consultas que tuvieron que cargar.
+    size_t failedLoads = 0;   ///< Cargas que fallaron.
+    size_t pendingLoads = 0;  ///< Cargas asíncronas sin terminar.
+};
+
+/**
+ * @class ResourceCache
+ * @brief Caché de recursos de un tipo, indexada por nombre de archivo.
+ *
+ * Las consultas aceptan `std::string_view` y buscan en un `OpenHashMap`, así que un acierto no
+ * reserva memoria. Los recursos se buscan primero en los paquetes montados (mediante la función
+ * de `setAssetFinder`) y después en disco. Las cargas asíncronas corren en `JobSystem` cuando el
+ * tipo lo permite y se publican en `processPending`, en el hilo principal. Solo se usa desde el
+ * hilo principal.
+ */
+template<typename T>
+class ResourceCache {
+public:
+    using Loader = ResourceLoader<T>;
+    using Finder = std::function<AssetSpan(const std::string&)>;
+
+    ResourceCache() = default; ///< Constructor por defecto (caché vacía).
+
+    // Deshabilitar copia y asignación
+    ResourceCache(const ResourceCache&) = delete;
+    ResourceCache& operator=(const ResourceCache&) = delete;
+
+    /**
+     * @brief Función que busca un recurso en los paquetes montados.
+     */
+    void setAssetFinder(Finder finder) { m_findAsset = std::move(finder); }
+
+    /**
+     * @brief Obtiene un recurso y lo carga de forma síncrona si no está en la caché.
+     * @param name Ruta del archivo (p. ej. "Fonts/Arial.ttf").
+     * @return El recurso, o un puntero nulo si no se pudo cargar.
+     */
+    EngineUtilities::TSharedPointer<T> get(std::string_view name) {
+        if (EngineUtilities::TSharedPointer<T>* resident = m_resources.find(name)) {
+            ++m_stats.hits;
+            return *resident;
+        }
+        ++m_stats.misses;
+        std::string path(name);
+        auto resource = EngineUtilities::MakeShared<T>();
+        if (!Loader::load(*resource, path, findAsset(path))) {
+            reportFailure(path);
+            return EngineUtilities::TSharedPointer<T>();
+        }
+        m_resources.insert(name, resource);
+        return resource;
+    }
+
+    /**
+     * @brief Busca un recurso residente sin cargarlo.
+     * @return El recurso, o un puntero nulo.
+     */
+    EngineUtilities::TSharedPointer<T> find(std::string_view name) const {
+        const EngineUtilities::TSharedPointer<T>* resident = m_resources.find(name);
+        return resident ? *resident : EngineUtilities::TSharedPointer<T>();
+    }
+
+    /**
+     * @brief Solicita un recurso sin bloquear. Los tipos que no se pueden cargar en segundo plano
+     * se cargan en el siguiente `processPending`.
+     * @param onReady Se llama en el hilo principal cuando el recurso está listo (no se llama si falla).
+     */
+    void loadAsync(std::string_view name, std::function<void(T&)> onReady = nullptr) {
+        if (EngineUtilities::TSharedPointer<T>* resident = m_resources.find(name)) {
+            ++m_stats.hits;
+            if (onReady) {
+                onReady(**resident);
+            }
+            return;
+        }
+        for (const auto& pending : m_pending) {
+            if (pending->name == name) {
+                if (onReady) {
+                    pending->onReady.push_back(std::move(onReady));
+                }
+                return;
+            }
+        }
+
+        ++m_stats.misses;
+        auto job = std::make_shared<LoadJob>();
+        job->name = std::string(name);
+        job->packed = findAsset(job->name);
+        if (onReady) {
+            job->onReady.push_back(std::move(onReady));
+        }
+        m_pending.push_back(job);
+        if (Loader::LOADS_IN_BACKGROUND) {
+            JobSystem::getInstance().submit([job]() {
+                job->resource = std::make_unique<T>();
+                job->succeeded = Loader::load(*job->resource, job->name, job->packed);
+                job->done.store(true, std::memory_order_release);
+            });
+        }
+        m_stats.pendingLoads = m_pending.size();
+    }
+
+    /**
+     * @brief Publica las cargas asíncronas que terminaron. Llamar una vez por fotograma.
+     * @return Cantidad de recursos publicados.
+     */
+    size_t processPending() {
+        size_t published = 0;
+        for (auto it = m_pending.begin(); it != m_pending.end();) {
+            LoadJob& job = **it;
+            if (!Loader::LOADS_IN_BACKGROUND) {
+                job.resource = std::make_unique<T>();
+                job.succeeded = Loader::load(*job.resource, job.name, job.packed);
+            }
+            else if (!job.done.load(std::memory_order_acquire)) {
+                ++it;
+                continue;
+            }
+
+            if (job.succeeded) {
+                // TSharedPointer no es atómico: se crea aquí, en el hilo principal.
+                EngineUtilities::TSharedPointer<T> resource(job.resource.release());
+                m_resources.insert(job.name, resource);
+                for (auto& callback : job.onReady) {
+                    callback(*resource);
+                }
+                ++published;
+            }
+            else {
+                reportFailure(job.name);
+            }
+            it = m_pending.erase(it);
+        }
+        m_stats.pendingLoads = m_pending.size();
+        return published;
+    }
+
+    /**
+     * @brief Quita un recurso de la caché; quien aún lo tenga lo sigue usando.
+     */
+    bool unload(std::string_view name) { return m_resources.erase(name); }
+
+    bool contains(std::string_view name) const { return m_resources.contains(name); } ///< Está residente.
+    size_t size() const { return m_resources.size(); }                              ///< Recursos residentes.
+    const ResourceCacheStats& getStats() const { return m_stats; }                  ///< Estadísticas.
+
+private:
+    /**
+     * @struct LoadJob
+     * @brief Carga asíncrona; el hilo de trabajo solo toca `resource`, `succeeded` y `done`.
+     */
+    struct LoadJob {
+        std::string name;                                 ///< Ruta del recurso.
+        AssetSpan packed;                                 ///< Bytes dentro de un paquete (o vacío).
+        std::unique_ptr<T> resource;                      ///< Recurso cargado.
+        bool succeeded = false;                           ///< La carga funcionó.
+        std::atomic<bool> done{ false };                  ///< Publica los campos anteriores.
+        std::vector<std::function<void(T&)>> onReady;     ///< Avisos pendientes (hilo principal).
+    };
+
+    AssetSpan findAsset(const std::string& name) const {
+        return m_findAsset ? m_findAsset(name) : AssetSpan();
+    }
+
+    void reportFailure(const std::string& name) {
+        ++m_stats.failedLoads;
+        NotificationService::getInstance().addMessage(ConsolErrorType::ERROR, "Failed to load resource: " + name);
+    }
+
+    EngineUtilities::OpenHashMap<EngineUtilities::TSharedPointer<T>> m_resources; ///< Recursos por nombre.
+    std::deque<std::shared_ptr<LoadJob>> m_pending;  ///< Cargas asíncronas en orden de solicitud.
+    Finder m_findAsset;                              ///< Búsqueda en los paquetes montados.
+    ResourceCacheStats m_stats;                      ///< Estadísticas.
+};
@@ -1,10 +1,180 @@
 #pragma once
 #include "Prerequisites.h"
 #include "Texture.h"
+#include "TextureAtlas.h"
+#include "AssetArchive.h"
+#include "FileWatcher.h"
+#include "OpenHashMap.h"
+#include "PreloadManifest.h"
+#include "Services/JobSystem.h"
+#include "Services/ResourceCache.h"
+#include "Services/NotificationSystem.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <list>
+#include <memory>
 
+/**
+ * @struct SpriteRegion
+ * @brief Textura y regin en pxeles donde se encuentra un sprite.
+ */
+struct SpriteRegion {
+    EngineUtilities::TSharedPointer<Texture> texture; ///< Textura del atlas (o la textura suelta).
+    sf::IntRect rect;                                 ///< Regin del sprite dentro de la textura.
+};
+
+/**
+ * @struct TextureLoadStats
+ * @brief Mtricas de las cargas asncronas de texturas.
+ */
+struct TextureLoadStats {
+    size_t pendingDecodes = 0;      ///< Solicitudes esperando un hilo o decodificndose.
+    size_t pendingUploads = 0;      ///< Imgenes decodificadas que esperan subir a la GPU.
+    size_t completedLoads = 0;      ///< Texturas cargadas.
+    size_t failedLoads = 0;         ///< Archivos que no se pudieron decodificar.
+    size_t lastFrameUploads = 0;    ///< Texturas subidas en el ltimo `processUploads`.
+    float lastFrameUploadMs = 0.0f; ///< Duracin del ltimo `processUploads`.
+    float averageDecodeMs = 0.0f;   ///< Solicitud -> imagen decodificada, en promedio.
+    float averageLatencyMs = 0.0f;  ///< Solicitud -> textura disponible, en promedio.
+    float maxLatencyMs = 0.0f;      ///< Peor latencia observada.
+    size_t hotReloads = 0;          ///< Texturas reemplazadas porque su archivo cambi.
+    size_t pendingReloads = 0;      ///< Recargas decodificndose.
+
+    /**
+     * @brief Cargas sin terminar (decodificando o esperando subir).
+     */
+    size_t getQueueDepth() const { return pendingDecodes + pendingUploads; }
+};
+
+/**
+ * @struct TextureCacheStats
+ * @brief Ocupacin y eficacia de la cach de texturas.
+ */
+struct TextureCacheStats {
+    size_t residentBytes = 0;    ///< Bytes estimados de las texturas en memoria.
+    size_t residentCount = 0;    ///< Texturas en memoria.
+    size_t budgetBytes = 0;      ///< Presupuesto configurado.
+    size_t hits = 0;             ///< Consultas resueltas con una textura residente.
+    size_t misses = 0;           ///< Consultas que tuvieron que cargar (o recargar) la textura.
+    size_t evictions = 0;        ///< Texturas expulsadas para respetar el presupuesto.
+    size_t reloads = 0;          ///< Texturas expulsadas que se volvieron a cargar.
+
+    /**
+     * @brief Fraccin de consultas resueltas sin cargar nada.
+     */
+    float getHitRate() const {
+        size_t total = hits + misses;
+        return total > 0 ? static_cast<float>(hits) / static_cast<float>(total) : 1.0f;
+    }
+};
+
+/**
+ * @struct TextureDecodeJob
+ * @brief Parte de una carga que toca el hilo de trabajo: solo datos de SFML y de la STL, sin
+ * punteros compartidos del motor (su conteo de referencias no es atmico).
+ */
+struct TextureDecodeJob {
+    std::string path;                                  ///< Archivo a decodificar.
+    std::string cookedPath;                            ///< Versin cocinada (`.gtex`) del archivo.
+    std::shared_ptr<AssetArchive> archive;             ///< Paquete que contiene el archivo (o nulo).
+    AssetSpan span;                                    ///< Bytes dentro del paquete.
+    bool isCooked = false;                             ///< Se usa la versin cocinada.
+    std::shared_ptr<MappedFile> cookedFile;            ///< Proyeccin del `.gtex` suelto.
+    CookedImage cooked;                                ///< Niveles cocinados (si `isCooked`).
+    sf::Image image;                                   ///< Resultado (vlido cuando `done` es true).
+    bool succeeded = false;                            ///< La decodificacin funcion.
+    float decodeMs = 0.0f;                             ///< Solicitud -> fin de la decodificacin.
+    std::chrono::steady_clock::time_point requestTime; ///< Momento de la solicitud.
+    std::atomic<bool> done{ false };                   ///< Publica los campos anteriores.
+
+    /**
+     * @brief Trabajo del hilo: si hay una versin cocinada solo se valida su encabezado; si no,
+     * se decodifica la imagen.
+     */
+    void run() {
+        if (archive) {
+            succeeded = isCooked ? cooked.parse(span.data, span.size)
+                                 : image.loadFromMemory(span.data, span.size);
+            return;
+        }
+        auto file = std::make_shared<MappedFile>();
+        if (file->open(cookedPath) && cooked.parse(file->data(), file->size())) {
+            isCooked = true;
+            cookedFile = std::move(file);
+            succeeded = true;
+            return;
+        }
+        succeeded = image.loadFromFile(path);
+    }
+};
+
+/**
+ * @struct TextureRequest
+ * @brief Estado de una carga asncrona en el hilo principal, compartido por sus handles.
+ */
+struct TextureRequest {
+    std::string name;                                       ///< Nombre de la textura.
+    std::shared_ptr<TextureDecodeJob> job;                  ///< Decodificacin en curso (nula si ya termin).
+    EngineUtilities::TSharedPointer<Texture> texture;       ///< Textura final (nula mientras carga).
+    EngineUtilities::TSharedPointer<Texture> fallback;      ///< Textura "Default" que se usa mientras tanto.
+    bool failed = false;                                    ///< El archivo no se pudo cargar.
+    std::vector<std::function<void(Texture&)>> onReady;     ///< Avisos pendientes.
+};
+
+/**
+ * @class TextureHandle
+ * @brief Referencia a una textura que se carga en segundo plano; mientras no est lista se
+ * resuelve a la textura "Default". Solo se usa desde el hilo principal.
+ */
+class TextureHandle {
+public:
+    TextureHandle() = default;
+
+    explicit TextureHandle(std::shared_ptr<TextureRequest> request) : m_request(std::move(request)) {}
+
+    /**
+     * @brief Textura cargada, o "Default" mientras carga o si la carga fall.
+     */
+    EngineUtilities::TSharedPointer<Texture> get() const {
+        if (!m_request) {
+            return EngineUtilities::TSharedPointer<Texture>();
+        }
+        return m_request->texture ? m_request->texture : m_request->fallback;
+    }
+
+    bool isReady() const { return m_request && m_request->texture; }     ///< La carga termin.
+    bool hasFailed() const { return m_request && m_request->failed; }    ///< Termin con error.
+
+private:
+    std::shared_ptr<TextureRequest> m_request; ///< Estado compartido de la carga.
+};
+
+/**
+ * @class ResourceManager
+ * @brief Cach de texturas y atlas compartida por todo el motor.
+ *
+ * Cada textura cuenta sus bytes (ancho * alto * 4). Cuando el total pasa del presupuesto se
+ * expulsan, de la menos a la ms recientemente usada, las texturas que nadie ms referencia: un
+ * `TSharedPointer`, un `TextureHandle` o un `SpriteRegion` vivos las mantienen en memoria. Quien
+ * guarde un `sf::Texture*` crudo debe conservar tambin uno de esos objetos. Una textura
+ * expulsada se vuelve a cargar sola la prxima vez que se pida por nombre.
+ */
 class ResourceManager {
 private:
-    ResourceManager() = default;
+    /**
+     * @brief Las cachs de los dems tipos buscan primero en los paquetes montados.
+     */
+    ResourceManager() {
+        auto finder = [this](const std::string& name) { return findAsset(name); };
+        m_fonts.setAssetFinder(finder);
+        m_sounds.setAssetFinder(finder);
+        m_shaders.setAssetFinder(finder);
+    }
 
     ~ResourceManager() = default;
 
@@ -13,6 +183,8 @@ private:
     ResourceManager& operator=(const ResourceManager&) = delete; /**< Operador de asignacin eliminado. */
 
 public:
+    static constexpr size_t DEFAULT_TEXTURE_BUDGET = 256u << 20; ///< Presupuesto inicial (256 MB).
+
     /**
      * @brief Obtiene la instancia nica del ResourceManager.
      * Referencia al Singleton ResourceManager.
@@ -30,13 +202,14 @@ public:
      */
     bool loadTexture(const std::string& fileName, const std::string& extension) {
         // Verificar si la textura ya est cargada
-        if (m_textures.find(fileName) != m_textures.end()) {
+        if (!findResident(fileName).isNull()) {
             return true; // La textura ya existe
         }
         // Crear y cargar la textura
-        EngineUtilities::TSharedPointer<Texture> texture = 
-            EngineUtilities::MakeShared<Texture>(fileName, extension);
-        m_textures[fileName] = texture; // Almacenar la textura
+        ++m_cacheStats.misses;
+        EngineUtilities::TSharedPointer<Texture> texture = createTexture(fileName, extension);
+        m_sources[fileName] = { extension, {} };
+        addResident(fileName, texture); // Almacenar la textura
         return true; // Retornar xito
     }
 
@@ -44,24 +217,645 @@ public:
      * @brief Obtiene una textura por su nombre. Si no existe, se retorna una textura por defecto.
      * Un puntero compartido a la textura solicitada o a una textura por defecto.
      */
-    EngineUtilities::TSharedPointer<Texture> getTexture(const std::string& fileName) {
-        // Verificar si la textura existe en el mapa
-        auto it = m_textures.find(fileName);
-        if (it != m_textures.end()) {
-            return it->second; // Devolver la textura existente
+    EngineUtilities::TSharedPointer<Texture> getTexture(std::string_view name) {
+        // Verificar si la textura existe en el mapa (sin copiar el nombre)
+        EngineUtilities::TSharedPointer<Texture> resident = findResident(name);
+        if (!resident.isNull()) {
+            return resident; // Devolver la textura existente
+        }
+        const std::string fileName(name);
+
+        // Expulsada por el presupuesto: se vuelve a cargar de su origen.
+        auto source = m_sources.find(fileName);
+        if (source != m_sources.end() && m_pendingByName.find(fileName) == m_pendingByName.end()) {
+            ++m_cacheStats.reloads;
+            bool reloaded = source->second.atlasSprites.empty()
+                ? loadTexture(fileName, source->second.extension)
+                : loadAtlas(fileName, source->second.atlasSprites, source->second.extension);
+            TextureEntry* reloadedEntry = m_textures.find(fileName);
+            if (reloaded && reloadedEntry != nullptr) {
+                return reloadedEntry->texture;
+            }
+        }
+
+        // Una carga asncrona en curso usa la textura por defecto sin avisar.
+        if (m_pendingByName.find(fileName) == m_pendingByName.end()) {
+            std::cout << "Texture not found: " << fileName << std::endl;
+        }
+        return getDefaultTexture();
+    }
+
+    /**
+     * @brief Textura residente que contiene una `sf::Texture`, sin tocar la LRU ni las mtricas.
+     * Sirve para retener texturas que solo se conocen por puntero (p. ej. las de una instantnea
+     * del hilo de render): mientras se conserve el resultado, la cach no la expulsa.
+     * @return Puntero nulo si la textura no pertenece a la cach.
+     */
+    EngineUtilities::TSharedPointer<Texture> findOwner(const sf::Texture* texture) const {
+        for (const auto& entry : m_textures) {
+            if (&entry.value.texture->getTexture() == texture) {
+                return entry.value.texture;
+            }
+        }
+        return EngineUtilities::TSharedPointer<Texture>();
+    }
+
+    /**
+     * @brief Solicita una textura sin bloquear: el archivo se decodifica en `JobSystem` y la
+     * subida a la GPU ocurre despus en `processUploads`, en el hilo principal.
+     * @param fileName Nombre del archivo de la textura.
+     * @param extension Extensin del archivo de textura.
+     * @param onReady Se llama en el hilo principal cuando la textura (o "Default", si falla) est lista.
+     * @return Handle que se resuelve a "Default" hasta que la textura est lista.
+     */
+    TextureHandle loadTextureAsync(const std::string& fileName, const std::string& extension,
+                                   std::function<void(Texture&)> onReady = nullptr) {
+        // Ya cargada: el handle queda resuelto de inmediato.
+        EngineUtilities::TSharedPointer<Texture> loaded = findResident(fileName);
+        if (!loaded.isNull()) {
+            auto request = std::make_shared<TextureRequest>();
+            request->name = fileName;
+            request->texture = loaded;
+            if (onReady) {
+                onReady(*request->texture);
+            }
+            return TextureHandle(request);
+        }
+
+        // Ya solicitada: se comparte la misma carga.
+        auto pending = m_pendingByName.find(fileName);
+        if (pending != m_pendingByName.end()) {
+            if (onReady) {
+                pending->second->onReady.push_back(std::move(onReady));
+            }
+            return TextureHandle(pending->second);
+        }
+
+        if (m_sources.find(fileName) != m_sources.end()) {
+            ++m_cacheStats.reloads;
+        }
+        ++m_cacheStats.misses;
+        m_sources[fileName] = { extension, {} };
+
+        auto request = std::make_shared<TextureRequest>();
+        request->name = fileName;
+        request->fallback = getDefaultTexture();
+        if (onReady) {
+            request->onReady.push_back(std::move(onReady));
+        }
+        request->job = std::make_shared<TextureDecodeJob>();
+        request->job->path = fileName + "." + extension;
+        request->job->cookedPath = fileName + ".gtex";
+        request->job->archive = findArchive(request->job->cookedPath, request->job->span);
+        request->job->isCooked = request->job->archive != nullptr;
+        if (!request->job->archive) {
+            request->job->archive = findArchive(request->job->path, request->job->span);
+        }
+        request->job->requestTime = std::chrono::steady_clock::now();
+        m_pendingByName[fileName] = request;
+        m_pendingLoads.push_back(request);
+        ++m_loadStats.pendingDecodes;
+
+        std::shared_ptr<TextureDecodeJob> job = request->job;
+        JobSystem::getInstance().submit([job]() {
+            job->run();
+            job->decodeMs = std::chrono::duration<float, std::milli>(
+                std::chrono::steady_clock::now() - job->requestTime).count();
+            job->done.store(true, std::memory_order_release);
+        });
+        return TextureHandle(request);
+    }
+
+    /**
+     * @brief Sube a la GPU las texturas ya decodificadas, en orden de solicitud, hasta agotar el
+     * presupuesto. Siempre sube al menos una para que la cola avance. Llamar una vez por fotograma.
+     * Tambin publica las cargas terminadas de fuentes, sonidos y shaders.
+     * @param budgetMs Tiempo mximo aproximado en milisegundos.
+     * @return Cantidad de texturas subidas.
+     */
+    size_t processUploads(float budgetMs = 2.0f) {
+        auto start = std::chrono::steady_clock::now();
+        auto elapsedMs = [&start]() {
+            return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        };
+
+        m_loadStats.lastFrameUploads = 0;
+        processHotReloads();
+        m_fonts.processPending();
+        m_sounds.processPending();
+        m_shaders.processPending();
+        for (auto it = m_pendingLoads.begin(); it != m_pendingLoads.end();) {
+            TextureRequest& request = **it;
+            if (!request.job->done.load(std::memory_order_acquire)) {
+                ++it;
+                continue;
+            }
+            if (request.job->succeeded && m_loadStats.lastFrameUploads > 0 && elapsedMs() >= budgetMs) {
+                break;
+            }
+            finishLoad(request);
+            it = m_pendingLoads.erase(it);
+        }
+        m_loadStats.lastFrameUploadMs = elapsedMs();
+
+        m_loadStats.pendingDecodes = 0;
+        m_loadStats.pendingUploads = 0;
+        for (const auto& request : m_pendingLoads) {
+            if (request->job->done.load(std::memory_order_acquire)) {
+                ++m_loadStats.pendingUploads;
+            }
+            else {
+                ++m_loadStats.pendingDecodes;
+            }
+        }
+        return m_loadStats.lastFrameUploads;
+    }
+
+    /**
+     * @brief Fuentes, por ruta de archivo (p. ej. "Fonts/Arial.ttf").
+     */
+    ResourceCache<sf::Font>& getFonts() { return m_fonts; }
+
+    /**
+     * @brief Sonidos, por ruta de archivo (p. ej. "Sounds/Engine.ogg").
+     */
+    ResourceCache<sf::SoundBuffer>& getSounds() { return m_sounds; }
+
+    /**
+     * @brief Shaders, por ruta de archivo o por nombre base del par `.vert`/`.frag`.
+     */
+    ResourceCache<sf::Shader>& getShaders() { return m_shaders; }
+
+    /**
+     * @brief Vigila directorios y, cuando cambia el archivo de una textura residente, la vuelve a
+     * decodificar en segundo plano y reemplaza su contenido en `processUploads`, sin cambiar los
+     * `TSharedPointer<Texture>` que ya la usan. Las texturas de un atlas no se recargan.
+     * @param directories Directorios con las texturas (rutas relativas al directorio de trabajo).
+     * @return true si se vigila al menos un directorio.
+     */
+    bool enableHotReload(const std::vector<std::string>& directories) {
+        auto watcher = std::make_unique<FileWatcher>();
+        bool watching = false;
+        for (const std::string& directory : directories) {
+            watching = watcher->addDirectory(directory) || watching;
         }
+        if (!watching || !watcher->start()) {
+            return false;
+        }
+        m_fileWatcher = std::move(watcher);
+        return true;
+    }
 
-        // Log de advertencia: textura no encontrada
-        std::cout << "Texture not found: " << fileName << std::endl;
+    /**
+     * @brief Deja de vigilar los directorios; las recargas en curso se descartan.
+     */
+    void disableHotReload() {
+        m_fileWatcher.reset();
+        m_pendingReloads.clear();
+        m_loadStats.pendingReloads = 0;
+    }
 
-        // Crear y cargar una textura por defecto
-        EngineUtilities::TSharedPointer<Texture> texture = 
-            EngineUtilities::MakeShared<Texture>("Default", "png");
-        m_textures["Default"] = texture; // Almacenar la textura por defecto
-        return texture; // Devolver la textura por defecto
+    /**
+     * @brief Solicita todos los recursos de una escena sin esperar: las texturas, fuentes y
+     * sonidos se leen y decodifican en paralelo en `JobSystem`; los atlas (que casi siempre salen
+     * de su cach en disco) se cargan aqu mismo, mientras los hilos de trabajo decodifican.
+     * Despus se completa con `finishPendingLoads` o con `processUploads` en cada fotograma.
+     * @param entries Entradas de la escena (ver `PreloadManifest`).
+     * @return Handles de las texturas; mientras se conserven, la cach no las expulsa.
+     */
+    std::vector<TextureHandle> preload(const std::vector<PreloadEntry>& entries) {
+        std::vector<TextureHandle> handles;
+        for (const PreloadEntry& entry : entries) {
+            switch (entry.type) {
+            case PreloadType::TEXTURE:
+                handles.push_back(loadTextureAsync(entry.name, entry.extension));
+                break;
+            case PreloadType::FONT:
+                m_fonts.loadAsync(entry.name);
+                break;
+            case PreloadType::SOUND:
+                m_sounds.loadAsync(entry.name);
+                break;
+            case PreloadType::SHADER:
+                m_shaders.loadAsync(entry.name);
+                break;
+            default:
+                break;
+            }
+        }
+        for (const PreloadEntry& entry : entries) {
+            if (entry.type == PreloadType::ATLAS &&
+                !loadAtlas(entry.name, entry.sprites, entry.extension.empty() ? "png" : entry.extension)) {
+                NotificationService::getInstance().addMessage(ConsolErrorType::ERROR,
+                    "Failed to load atlas: " + entry.name);
+            }
+        }
+        return handles;
     }
 
+    /**
+     * @brief Cargas asncronas sin publicar, de todos los tipos.
+     */
+    size_t getPendingLoadCount() const {
+        return m_pendingLoads.size() + m_fonts.getStats().pendingLoads + m_sounds.getStats().pendingLoads +
+               m_shaders.getStats().pendingLoads;
+    }
+
+    /**
+     * @brief Espera las cargas asncronas y sube todas las texturas sin presupuesto por
+     * fotograma. Pensado para el arranque, antes del primer fotograma.
+     */
+    void finishPendingLoads() {
+        while (getPendingLoadCount() > 0) {
+            if (processUploads(std::numeric_limits<float>::max()) == 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        }
+    }
+
+    /**
+     * @brief Mtricas de las cargas asncronas (profundidad de la cola y latencias).
+     */
+    const TextureLoadStats& getTextureLoadStats() const { return m_loadStats; }
+
+    /**
+     * @brief Carga un atlas con los sprites indicados, reutilizando la cach en disco si sigue vigente.
+     * La cach se guarda como `<atlasName>.png` y `<atlasName>.atlas`.
+     * @param atlasName Nombre del atlas (tambin ruta base de la cach).
+     * @param spriteNames Nombres de los sprites; el archivo de cada uno es `<nombre>.<extension>`.
+     * @param extension Extensin de los archivos de los sprites.
+     * @return `true` si el atlas ya estaba cargado o se carg correctamente.
+     */
+    bool loadAtlas(const std::string& atlasName,
+                   const std::vector<std::string>& spriteNames,
+                   const std::string& extension = "png") {
+        if (!findResident(atlasName).isNull()) {
+            return true; // El atlas ya existe
+        }
+        ++m_cacheStats.misses;
+
+        TextureAtlas atlas;
+        for (const auto& spriteName : spriteNames) {
+            atlas.addImage(spriteName, spriteName + "." + extension);
+        }
+        if (!atlas.loadOrBuild(atlasName)) {
+            return false;
+        }
+
+        m_sources[atlasName] = { extension, spriteNames };
+        addResident(atlasName, EngineUtilities::MakeShared<Texture>(atlasName, atlas.getImage()));
+        for (const auto& region : atlas.getRegions()) {
+            m_sprites[region.first] = { atlasName, region.second };
+        }
+        return true;
+    }
+
+    /**
+     * @brief Resuelve un sprite a su textura de atlas y regin.
+     * Si el sprite no pertenece a ningn atlas se usa la textura suelta con ese nombre completa.
+     * @param spriteName Nombre del sprite (p. ej. "Characters/tile000").
+     * @return Textura y regin del sprite.
+     */
+    SpriteRegion getSprite(const std::string& spriteName) {
+        auto it = m_sprites.find(spriteName);
+        if (it != m_sprites.end()) {
+            return { getTexture(it->second.first), it->second.second };
+        }
+
+        EngineUtilities::TSharedPointer<Texture> texture = getTexture(spriteName);
+        sf::Vector2u size = texture->getTexture().getSize();
+        return { texture, sf::IntRect(0, 0, static_cast<int>(size.x), static_cast<int>(size.y)) };
+    }
+
+    /**
+     * @brief Monta un paquete de recursos. Los archivos que contiene se decodifican desde la
+     * proyeccin en memoria en lugar de abrirse sueltos; el ltimo paquete montado tiene prioridad.
+     * @param path Ruta del paquete `.gpak`.
+     * @return true si el paquete es vlido.
+     */
+    bool mountArchive(const std::string& path) {
+        auto archive = std::make_shared<AssetArchive>();
+        if (!archive->open(path)) {
+            return false;
+        }
+        m_archives.push_back(archive);
+        return true;
+    }
+
+    /**
+     * @brief Bytes de un recurso en los paquetes montados, sin copiarlos.
+     * @param name Nombre del recurso con extensin (p. ej. "Circuit.png").
+     * @return Span vaco si ningn paquete lo contiene.
+     */
+    AssetSpan findAsset(const std::string& name) const {
+        AssetSpan span;
+        findArchive(name, span);
+        return span;
+    }
+
+    /**
+     * @brief Cambia el presupuesto de memoria de las texturas y expulsa lo que sobre.
+     * @param bytes Bytes mximos (0 = sin lmite).
+     */
+    void setTextureBudget(size_t bytes) {
+        m_cacheStats.budgetBytes = bytes;
+        evictToBudget();
+    }
+
+    /**
+     * @brief Ocupacin de la cach, tasa de aciertos y expulsiones.
+     */
+    const TextureCacheStats& getTextureCacheStats() const { return m_cacheStats; }
+
 private:
+    /**
+     * @struct TextureEntry
+     * @brief Textura residente con su tamao y su posicin en la lista LRU.
+     */
+    struct TextureEntry {
+        EngineUtilities::TSharedPointer<Texture> texture; ///< Textura en memoria.
+        size_t bytes = 0;                                 ///< Bytes estimados.
+        std::list<std::string>::iterator lruPosition;     ///< Posicin en `m_lru`.
+    };
+
+    /**
+     * @struct TextureSource
+     * @brief Cmo volver a cargar una textura expulsada.
+     */
+    struct TextureSource {
+        std::string extension;                 ///< Extensin del archivo (o de los sprites del atlas).
+        std::vector<std::string> atlasSprites; ///< Sprites del atlas (vaco para texturas sueltas).
+    };
+
+    /**
+     * @brief Paquete montado ms reciente que contiene un recurso.
+     * @param span Recibe los bytes del recurso.
+     */
+    std::shared_ptr<AssetArchive> findArchive(const std::string& name, AssetSpan& span) const {
+        for (auto it = m_archives.rbegin(); it != m_archives.rend(); ++it) {
+            span = (*it)->find(name);
+            if (span) {
+                return *it;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Crea una textura desde los paquetes montados o, si no est empaquetada, desde su archivo.
+     * Se prefiere la versin cocinada (`.gtex`), que se sube sin decodificar.
+     */
+    EngineUtilities::TSharedPointer<Texture> createTexture(const std::string& name, const std::string& extension) {
+        CookedImage cooked;
+        AssetSpan cookedSpan = findAsset(name + ".gtex");
+        if (cookedSpan && cooked.parse(cookedSpan.data, cookedSpan.size)) {
+            return EngineUtilities::MakeShared<Texture>(name, cooked);
+        }
+        MappedFile cookedFile;
+        if (cookedFile.open(name + ".gtex") && cooked.parse(cookedFile.data(), cookedFile.size())) {
+            return EngineUtilities::MakeShared<Texture>(name, cooked);
+        }
+
+        AssetSpan span = findAsset(name + "." + extension);
+        sf::Image image;
+        if (span && image.loadFromMemory(span.data, span.size)) {
+            return EngineUtilities::MakeShared<Texture>(name, image);
+        }
+        return EngineUtilities::MakeShared<Texture>(name, extension);
+    }
+
+    /**
+     * @brief Busca una textura residente y la marca como la ms reciente.
+     * @return La textura, o un puntero nulo si no est en memoria.
+     */
+    EngineUtilities::TSharedPointer<Texture> findResident(std::string_view name) {
+        TextureEntry* entry = m_textures.find(name);
+        if (entry == nullptr) {
+            return EngineUtilities::TSharedPointer<Texture>();
+        }
+        m_lru.splice(m_lru.begin(), m_lru, entry->lruPosition);
+        ++m_cacheStats.hits;
+        return entry->texture;
+    }
+
+    /**
+     * @brief Guarda una textura como la ms reciente, cuenta sus bytes y respeta el presupuesto.
+     */
+    void addResident(const std::string& name, const EngineUtilities::TSharedPointer<Texture>& texture) {
+        auto inserted = m_textures.tryEmplace(name);
+        TextureEntry& entry = *inserted.first;
+        if (inserted.second) {
+            m_lru.push_front(name);
+            entry.lruPosition = m_lru.begin();
+            ++m_cacheStats.residentCount;
+        }
+        else {
+            m_cacheStats.residentBytes -= entry.bytes;
+            m_lru.splice(m_lru.begin(), m_lru, entry.lruPosition);
+        }
+
+        sf::Vector2u size = texture->getTexture().getSize();
+        entry.texture = texture;
+        entry.bytes = static_cast<size_t>(size.x) * size.y * 4;
+        m_cacheStats.residentBytes += entry.bytes;
+        evictToBudget();
+    }
+
+    /**
+     * @brief Expulsa, desde la menos usada, las texturas que solo la cach referencia hasta
+     * quedar dentro del presupuesto. "Default" nunca se expulsa porque es el respaldo de todo.
+     */
+    void evictToBudget() {
+        if (m_cacheStats.budgetBytes == 0) {
+            return;
+        }
+        auto position = m_lru.end();
+        while (m_cacheStats.residentBytes > m_cacheStats.budgetBytes && position != m_lru.begin()) {
+            --position;
+            TextureEntry* entry = m_textures.find(*position);
+            if (*position == "Default" || entry->texture.useCount() > 1) {
+                continue;
+            }
+            m_cacheStats.residentBytes -= entry->bytes;
+            --m_cacheStats.residentCount;
+            ++m_cacheStats.evictions;
+            m_textures.erase(*position);
+            position = m_lru.erase(position);
+        }
+    }
+
+    /**
+     * @brief Textura "Default", cargada una sola vez.
+     */
+    EngineUtilities::TSharedPointer<Texture> getDefaultTexture() {
+        if (TextureEntry* entry = m_textures.find("Default")) {
+            return entry->texture;
+        }
+        EngineUtilities::TSharedPointer<Texture> texture = createTexture("Default", "png");
+        addResident("Default", texture);
+        return texture;
+    }
+
+    /**
+     * @brief Encola la decodificacin de las texturas residentes cuyo archivo cambi y reemplaza
+     * las que ya terminaron. Corre en el hilo principal entre fotogramas, as que el reemplazo no
+     * se ve a medias; no lee archivos.
+     */
+    void processHotReloads() {
+        if (!m_fileWatcher) {
+            return;
+        }
+
+        m_changedFiles.clear();
+        m_fileWatcher->poll(m_changedFiles);
+        for (const std::string& path : m_changedFiles) {
+            std::filesystem::path file(path);
+            std::string extension = file.extension().string();
+            std::string name = (file.parent_path() / file.stem()).generic_string();
+            auto source = m_sources.find(name);
+            if (extension.empty() || source == m_sources.end() || !source->second.atlasSprites.empty() ||
+                !m_textures.contains(name)) {
+                continue;
+            }
+            extension.erase(0, 1);
+            if (extension != source->second.extension && extension != "gtex") {
+                continue;
+            }
+
+            // Un cambio nuevo reemplaza la recarga anterior; esa termina en su hilo y se descarta.
+            auto job = std::make_shared<TextureDecodeJob>();
+            job->path = path;
+            job->cookedPath = extension == "gtex" ? path : std::string();
+            job->requestTime = std::chrono::steady_clock::now();
+            m_pendingReloads[name] = job;
+            JobSystem::getInstance().submit([job]() {
+                job->run();
+                job->done.store(true, std::memory_order_release);
+            });
+        }
+
+        for (auto it = m_pendingReloads.begin(); it != m_pendingReloads.end();) {
+            TextureDecodeJob& job = *it->second;
+            if (!job.done.load(std::memory_order_acquire)) {
+                ++it;
+                continue;
+            }
+            TextureEntry* entry = m_textures.find(it->first);
+            if (job.succeeded && entry != nullptr) {
+                swapTextureContents(*entry, job);
+                ++m_loadStats.hotReloads;
+                NotificationService::getInstance().addMessage(ConsolErrorType::NORMAL,
+                    "Reloaded texture: " + job.path);
+            }
+            else if (!job.succeeded) {
+                NotificationService::getInstance().addMessage(ConsolErrorType::WARNING,
+                    "Hot reload failed, keeping previous texture: " + job.path);
+            }
+            it = m_pendingReloads.erase(it);
+        }
+        m_loadStats.pendingReloads = m_pendingReloads.size();
+    }
+
+    /**
+     * @brief Sube la nueva imagen a una textura aparte y la intercambia con la residente, de modo
+     * que los punteros a `sf::Texture` siguen siendo vlidos y nunca ven una textura incompleta.
+     */
+    void swapTextureContents(TextureEntry& entry, TextureDecodeJob& job) {
+        sf::Texture& current = entry.texture->getTexture();
+        sf::Texture replacement;
+        bool uploaded = job.isCooked ? uploadCookedTexture(replacement, job.cooked)
+                                     : replacement.loadFromImage(job.image);
+        if (!uploaded) {
+            return;
+        }
+        if (!job.isCooked) {
+            replacement.setSmooth(current.isSmooth());
+        }
+        replacement.setRepeated(current.isRepeated());
+        current.swap(replacement);
+
+        sf::Vector2u size = current.getSize();
+        m_cacheStats.residentBytes -= entry.bytes;
+        entry.bytes = static_cast<size_t>(size.x) * size.y * 4;
+        m_cacheStats.residentBytes += entry.bytes;
+        evictToBudget();
+    }
+
+    /**
+     * @brief Completa una carga decodificada: sube la imagen, actualiza mtricas y avisa.
+     */
+    void finishLoad(TextureRequest& request) {
+        TextureDecodeJob& job = *request.job;
+        if (job.succeeded) {
+            // Si mientras tanto se carg de forma sncrona, se reutiliza esa textura.
+            if (TextureEntry* loaded = m_textures.find(request.name)) {
+                request.texture = loaded->texture;
+            }
+            else {
+                request.texture = job.isCooked ? EngineUtilities::MakeShared<Texture>(request.name, job.cooked)
+                                               : EngineUtilities::MakeShared<Texture>(request.name, job.image);
+                addResident(request.name, request.texture);
+                ++m_loadStats.lastFrameUploads;
+            }
+
+            float latencyMs = std::chrono::duration<float, std::milli>(
+                std::chrono::steady_clock::now() - job.requestTime).count();
+            ++m_loadStats.completedLoads;
+            m_decodeMsTotal += job.decodeMs;
+            m_latencyMsTotal += latencyMs;
+            m_loadStats.averageDecodeMs = m_decodeMsTotal / static_cast<float>(m_loadStats.completedLoads);
+            m_loadStats.averageLatencyMs = m_latencyMsTotal / static_cast<float>(m_loadStats.completedLoads);
+            m_loadStats.maxLatencyMs = std::max(m_loadStats.maxLatencyMs, latencyMs);
+        }
+        else {
+            request.failed = true;
+            request.texture = request.fallback;
+            ++m_loadStats.failedLoads;
+            NotificationService::getInstance().addMessage(ConsolErrorType::ERROR,
+                "Failed to load texture: " + job.path);
+        }
+
+        request.job.reset();
+        m_pendingByName.erase(request.name);
+        std::vector<std::function<void(Texture&)>> callbacks;
+        callbacks.swap(request.onReady);
+        for (auto& callback : callbacks) {
+            callback(*request.texture);
+        }
+    }
+
     // Almacena todas las texturas cargadas con sus nombres como claves.
-    std::unordered_map<std::string, EngineUtilities::TSharedPointer<Texture>> m_textures;
+    EngineUtilities::OpenHashMap<TextureEntry> m_textures;
+
+    // Nombres de las texturas residentes, de la ms a la menos recientemente usada.
+    std::list<std::string> m_lru;
+
+    // Origen de cada textura cargada alguna vez, para recargarla si se expulsa.
+    std::unordered_map<std::string, TextureSource> m_sources;
+
+    // Paquetes montados, del ms antiguo al ms reciente.
+    std::vector<std::shared_ptr<AssetArchive>> m_archives;
+
+    TextureCacheStats m_cacheStats{ 0, 0, DEFAULT_TEXTURE_BUDGET }; ///< Estadsticas de la cach.
+
+    // Sprite -> (nombre del atlas, regin dentro del atlas).
+    std::unordered_map<std::string, std::pair<std::string, sf::IntRect>> m_sprites;
+
+    // Cargas asncronas en orden de solicitud, y por nombre para no repetirlas.
+    std::deque<std::shared_ptr<TextureRequest>> m_pendingLoads;
+    std::unordered_map<std::string, std::shared_ptr<TextureRequest>> m_pendingByName;
+
+    TextureLoadStats m_loadStats;  ///< Mtricas de las cargas asncronas.
+    float m_decodeMsTotal = 0.0f;  ///< Suma de los tiempos de decodificacin.
+    float m_latencyMsTotal = 0.0f; ///< Suma de las latencias completas.
+
+    // Cachs de los dems tipos de recurso.
+    ResourceCache<sf::Font> m_fonts;
+    ResourceCache<sf::SoundBuffer> m_sounds;
+    ResourceCache<sf::Shader> m_shaders;
+
+    // Recarga en caliente: vigilante, recargas en curso por nombre y bfer de rutas reutilizado.
+    std::unique_ptr<FileWatcher> m_fileWatcher;
+    std::unordered_map<std::string, std::shared_ptr<TextureDecodeJob>> m_pendingReloads;
+    std::vector<std::string> m_changedFiles;
 };
@@ -3,8 +3,17 @@
 #include "Prerequisites.h"
 #include "Component.h"
 #include "Window.h"
+#include "Services/GeometryCache.h"
 #include <SFML/Graphics.hpp>
 
+/**
+ * @class ShapeFactory
+ * @brief Componente de forma: referencia una geometría compartida más los datos de su instancia.
+ *
+ * El contorno teselado vive en `GeometryCache` y se comparte entre todos los actores con el mismo
+ * tipo, tamaño y cantidad de puntos; cada componente solo guarda su transformación, color y
+ * textura. Las formas no tienen contorno (outline).
+ */
 class ShapeFactory : public Component {
 public:
     /**
@@ -12,24 +21,21 @@ public:
      * Inicializa el ShapeFactory sin una forma específica.
      */
     ShapeFactory()
-        : m_shape(nullptr),
-        m_ShapeType(ShapeType::EMPTY),
-        Component(ComponentType::SHAPE) {}
+        : Component(ComponentType::SHAPE),
+        m_ShapeType(ShapeType::EMPTY) {}
 
     /**
      * @brief Destructor por defecto.
-     * Libera recursos asociados con la forma gráfica si corresponde.
+     * La geometría pertenece a la caché, así que no hay nada que liberar.
      */
-    virtual ~ShapeFactory() {
-        delete m_shape;
-    }
+    virtual ~ShapeFactory() = default;
 
     /**
-     * @brief Crea una nueva forma basada en el tipo especificado.
+     * @brief Asigna la geometría compartida del tipo especificado.
      * @param shapeType Tipo de forma a crear.
-     * @return Puntero a la forma gráfica creada.
+     * @return Geometría asignada, o nullptr si el tipo no tiene forma.
      */
-    sf::Shape* createShape(ShapeType shapeType);
+    const ShapeGeometry* createShape(ShapeType shapeType);
 
     /**
      * @brief Actualiza el componente de malla.
@@ -75,14 +81,80 @@ public:
     void setScale(const Vector2& scale);
 
     /**
-     * @brief Obtiene un puntero a la forma actual.
-     * @return Puntero a la forma gráfica creada.
+     * @brief Asigna la textura de la forma, como `sf::Shape::setTexture`.
+     * @param texture Textura (puede ser nula).
+     * @param resetRect Si es `true`, la región pasa a ser la textura completa.
+     */
+    void setTexture(const sf::Texture* texture, bool resetRect = false);
+
+    /**
+     * @brief Asigna la región de la textura que se muestra.
+     * @param rect Región en píxeles.
+     */
+    void setTextureRect(const sf::IntRect& rect);
+
+    /**
+     * @brief Elige la cantidad de puntos de un círculo según su radio proyectado en pantalla.
+     * Cada nivel usa una teselación de la caché; para cambiar de nivel el radio debe pasar el
+     * umbral con un margen (histéresis), así una forma en el límite no alterna cada fotograma.
+     * Las formas que no son círculos no cambian.
+     * @param pixelsPerUnit Píxeles por unidad de mundo de la vista actual.
+     * @return `true` si la geometría cambió.
+     */
+    bool updateLevelOfDetail(float pixelsPerUnit);
+
+    /**
+     * @brief Contador que aumenta cada vez que cambia algo que afecta al dibujo
+     * (geometría, transformación, color o textura). Asignar el mismo valor no lo cambia, así
+     * que la sincronización con `Transform` en cada fotograma solo cuenta si hubo movimiento.
+     */
+    uint32_t getVersion() const {
+        return m_version;
+    }
+
+    /**
+     * @brief Nivel de detalle actual (0 es el más simple).
+     */
+    int getLevelOfDetail() const {
+        return m_lodLevel;
+    }
+
+    /**
+     * @brief Obtiene la geometría compartida de la forma.
+     * @return Geometría, o nullptr si todavía no se creó la forma.
+     */
+    const ShapeGeometry* getGeometry() const {
+        return m_geometry;
+    }
+
+    /**
+     * @brief Transformación local a mundo (posición, rotación y escala).
+     */
+    sf::Transform getTransform() const;
+
+    // Datos de la instancia.
+    const sf::Color& getFillColor() const { return m_fillColor; }
+    const sf::Texture* getTexture() const { return m_texture; }
+    const sf::IntRect& getTextureRect() const { return m_textureRect; }
+
+    /**
+     * @brief Obtiene la caja envolvente de la forma en coordenadas de mundo.
+     * Incluye la posición, rotación y escala sincronizadas desde `Transform`.
+     * @return Caja envolvente global, o una caja vacía si no hay forma creada.
      */
-    sf::Shape* getShape() {
-        return m_shape;
+    sf::FloatRect getBounds() const {
+        return m_geometry ? getTransform().transformRect(m_geometry->bounds) : sf::FloatRect();
     }
 
 private:
-    sf::Shape* m_shape;       // Puntero a la forma gráfica actual.
+    const ShapeGeometry* m_geometry = nullptr;    // Contorno compartido (propiedad de GeometryCache).
+    sf::Vector2f m_position;                      // Posición en mundo.
+    float m_rotation = 0.0f;                      // Rotación en grados.
+    sf::Vector2f m_scale{ 1.0f, 1.0f };           // Escala.
+    sf::Color m_fillColor = sf::Color::White;     // Color de relleno.
+    const sf::Texture* m_texture = nullptr;       // Textura (puede ser nula).
+    sf::IntRect m_textureRect;                    // Región de la textura en píxeles.
     ShapeType m_ShapeType;    // Tipo de forma que se está gestionando.
+    uint8_t m_lodLevel = 0;   // Nivel de detalle del círculo (índice en la tabla de puntos).
+    uint32_t m_version = 0;   // Cambios de dibujo (ver getVersion).
 };
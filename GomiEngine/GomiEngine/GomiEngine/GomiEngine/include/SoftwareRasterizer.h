@@ -0,0 +1,148 @@
+#pragma once
+#include "Prerequisites.h"
+#include "RenderBackend.h"
+#include <cstdint>
+
+/**
+ * @class SoftwareRasterizer
+ * @brief Backend que rasteriza en CPU sobre una imagen RGBA en memoria, sin ventana ni GPU.
+ *
+ * Los triángulos se transforman a píxeles al enviarlos y se reparten en mosaicos de
+ * `TILE_SIZE` x `TILE_SIZE` según su caja envolvente; `display` rasteriza los mosaicos en
+ * paralelo con `JobSystem`. Cada mosaico recorre sus triángulos en el orden de envío y solo
+ * escribe sus propios píxeles, así que el resultado no depende de la cantidad de hilos.
+ *
+ * La cobertura usa funciones de arista evaluadas de cuatro en cuatro píxeles con SSE2 (con
+ * versión escalar equivalente) y la regla superior-izquierda, como las GPU. Color y
+ * coordenadas de textura se interpolan linealmente; la textura se muestrea sin filtrar y se
+ * multiplica por el color del vértice, igual que en SFML. Como `sf::Texture` vive en la GPU,
+ * cada textura se asocia con su `sf::Image` mediante `setTextureImage`.
+ */
+class SoftwareRasterizer : public RenderBackend {
+public:
+    static constexpr unsigned int TILE_SIZE = 64; ///< Lado de los mosaicos en píxeles.
+
+    /**
+     * @brief Crea la imagen de destino con la vista por defecto (un píxel por unidad).
+     * @param width Ancho en píxeles.
+     * @param height Alto en píxeles.
+     */
+    SoftwareRasterizer(unsigned int width, unsigned int height);
+
+    ~SoftwareRasterizer() override = default; ///< Destructor por defecto.
+
+    // Deshabilitar copia y asignación
+    SoftwareRasterizer(const SoftwareRasterizer&) = delete;
+    SoftwareRasterizer& operator=(const SoftwareRasterizer&) = delete;
+
+    void setView(const sf::View& view) override { m_view = view; }
+    const sf::View& getView() const override { return m_view; }
+
+    /**
+     * @brief Llena la imagen; los triángulos pendientes se descartan porque quedarían debajo.
+     */
+    void clear(const sf::Color& color = sf::Color::Black) override;
+
+    /**
+     * @brief Transforma los triángulos a píxeles y los reparte en los mosaicos que tocan.
+     */
+    void drawTriangles(const sf::Vertex* vertices, size_t vertexCount,
+                       const sf::RenderStates& states) override;
+
+    /**
+     * @brief Los objetos de SFML arbitrarios no se pueden rasterizar aquí: solo se cuentan.
+     */
+    void draw(const sf::Drawable& drawable, const sf::RenderStates& states) override;
+
+    /**
+     * @brief Rasteriza todos los triángulos pendientes.
+     */
+    void display() override;
+
+    sf::Vector2u getSize() const override { return sf::Vector2u(m_width, m_height); }
+
+    /**
+     * @brief Asocia una textura con la imagen que se muestrea en su lugar.
+     * @param texture Textura usada en los estados de dibujo (solo como clave).
+     * @param image Imagen en CPU, o nullptr para quitar la asociación.
+     */
+    void setTextureImage(const sf::Texture* texture, const sf::Image* image);
+
+    /**
+     * @brief Reparte los mosaicos entre los hilos de `JobSystem` (activado por defecto).
+     */
+    void setMultithreaded(bool enabled) { m_multithreaded = enabled; }
+
+    /**
+     * @brief Usa la versión SSE2 de las funciones de arista si está disponible.
+     */
+    void setSimdEnabled(bool enabled) { m_simdEnabled = enabled && isSimdAvailable(); }
+
+    /**
+     * @brief Indica si el ejecutable se compiló con SSE2.
+     */
+    static bool isSimdAvailable();
+
+    /**
+     * @brief Píxeles RGBA de 8 bits por canal, fila por fila.
+     */
+    const uint8_t* getPixels() const { return m_pixels.data(); }
+
+    /**
+     * @brief Copia la imagen (p. ej. para guardarla o compararla con una imagen de referencia).
+     */
+    sf::Image copyToImage() const;
+
+    // Estadísticas del último `display`.
+    size_t getTriangleCount() const { return m_lastTriangleCount; }  ///< Triángulos rasterizados.
+    size_t getBinEntryCount() const { return m_lastBinEntryCount; }  ///< Pares triángulo-mosaico.
+    size_t getUnsupportedDrawCount() const { return m_unsupportedDrawCount; } ///< Dibujos omitidos.
+
+private:
+    /**
+     * @struct RasterTriangle
+     * @brief Triángulo en píxeles, con área positiva, listo para rasterizar.
+     */
+    struct RasterTriangle {
+        sf::Vector2f position[3];        ///< Vértices en píxeles.
+        float color[3][4];               ///< Color de cada vértice, normalizado a [0, 1].
+        sf::Vector2f texCoords[3];       ///< Coordenadas de textura en píxeles.
+        const sf::Image* image = nullptr; ///< Imagen a muestrear (nula = sin textura).
+        sf::BlendMode blendMode;         ///< Modo de mezcla.
+        bool alphaBlend = true;          ///< Es `sf::BlendAlpha` (camino rápido).
+    };
+
+    /**
+     * @brief Rasteriza los triángulos de un mosaico en orden.
+     */
+    void rasterizeTile(size_t tileIndex);
+
+    /**
+     * @brief Rasteriza un triángulo dentro del rectángulo [minX, maxX) x [minY, maxY).
+     */
+    void rasterizeTriangle(const RasterTriangle& triangle, int minX, int minY, int maxX, int maxY);
+
+    /**
+     * @brief Calcula el color de un píxel cubierto y lo mezcla con el destino.
+     * @param weights Coordenadas baricéntricas del píxel.
+     */
+    void shadePixel(const RasterTriangle& triangle, int x, int y, const float weights[3]);
+
+    unsigned int m_width;                ///< Ancho de la imagen.
+    unsigned int m_height;               ///< Alto de la imagen.
+    unsigned int m_tilesX;               ///< Mosaicos por fila.
+    unsigned int m_tilesY;               ///< Filas de mosaicos.
+    std::vector<uint8_t> m_pixels;       ///< Imagen RGBA.
+    sf::View m_view;                     ///< Cámara actual.
+
+    std::vector<RasterTriangle> m_triangles;         ///< Triángulos pendientes.
+    std::vector<std::vector<uint32_t>> m_tileBins;   ///< Índices de triángulos por mosaico.
+    std::unordered_map<const sf::Texture*, const sf::Image*> m_textureImages; ///< Textura -> imagen.
+
+    bool m_multithreaded = true;         ///< Rasterizar mosaicos en paralelo.
+    bool m_simdEnabled = isSimdAvailable(); ///< Usar SSE2.
+    size_t m_binEntryCount = 0;          ///< Pares triángulo-mosaico pendientes.
+    size_t m_lastTriangleCount = 0;      ///< Triángulos del último `display`.
+    size_t m_lastBinEntryCount = 0;      ///< Pares del último `display`.
+    size_t m_unsupportedDrawCount = 0;   ///< Dibujos de SFML omitidos.
+};
@@ -0,0 +1,207 @@
+#pragma once
+#include "Prerequisites.h"
+#include "Matrix4.h"
+#include <cstdint>
+#include <functional>
+
+/**
+ * @struct Vertex3D
+ * @brief Vértice de la tubería 3D: posición local y color.
+ */
+struct Vertex3D {
+    Vector3 position;                    ///< Posición en coordenadas del modelo.
+    sf::Color color = sf::Color::White;  ///< Color del vértice.
+};
+
+/**
+ * @class SoftwareRenderer3D
+ * @brief Tubería 3D en CPU: transformación modelo-vista-proyección, recorte, rasterización con
+ * corrección de perspectiva y búfer de profundidad.
+ *
+ * `render` trabaja en dos etapas paralelas con `JobSystem`:
+ * 1. Los triángulos enviados se reparten en bloques de `TRIANGLES_PER_CHUNK`; cada bloque los
+ *    transforma, los recorta contra el plano cercano, descarta los que quedan fuera o de espaldas
+ *    y los clasifica en los mosaicos que toca, en listas propias del bloque (sin bloqueos).
+ * 2. Cada mosaico recorre las listas de todos los bloques en orden y rasteriza con prueba de
+ *    profundidad sobre su parte del búfer.
+ *
+ * Color y profundidad se guardan por mosaicos (cada mosaico es contiguo en memoria), así que un
+ * hilo solo toca su mosaico y el resultado no depende de la cantidad de hilos. La imagen se
+ * obtiene en orden lineal con `copyPixels` o `copyToImage`.
+ */
+class SoftwareRenderer3D {
+public:
+    static constexpr unsigned int TILE_SIZE = 64;        ///< Lado de los mosaicos en píxeles.
+    static constexpr size_t TRIANGLES_PER_CHUNK = 1024;  ///< Triángulos por bloque de clasificación.
+
+    /**
+     * @brief Crea los búferes de color y profundidad.
+     * @param width Ancho en píxeles.
+     * @param height Alto en píxeles.
+     */
+    SoftwareRenderer3D(unsigned int width, unsigned int height);
+
+    ~SoftwareRenderer3D() = default; ///< Destructor por defecto.
+
+    // Deshabilitar copia y asignación
+    SoftwareRenderer3D(const SoftwareRenderer3D&) = delete;
+    SoftwareRenderer3D& operator=(const SoftwareRenderer3D&) = delete;
+
+    /**
+     * @brief Asigna la cámara para los siguientes envíos.
+     * @param view Matriz de vista (mundo a cámara).
+     * @param projection Matriz de proyección (ver `Matrix4::perspective`).
+     */
+    void setCamera(const Matrix4& view, const Matrix4& projection);
+
+    /**
+     * @brief Limpia el color y la profundidad, y descarta los triángulos pendientes.
+     */
+    void clear(const sf::Color& color = sf::Color::Black);
+
+    /**
+     * @brief Envía una lista de triángulos.
+     * @param vertices Vértices, tres por triángulo (los frontales en sentido antihorario).
+     * @param vertexCount Cantidad de vértices.
+     * @param model Transformación del modelo al mundo.
+     */
+    void submit(const Vertex3D* vertices, size_t vertexCount, const Matrix4& model);
+
+    /**
+     * @brief Clasifica y rasteriza todos los triángulos pendientes.
+     */
+    void render();
+
+    /**
+     * @brief Hilos a usar (0 = todos los de `JobSystem` más el que llama).
+     */
+    void setThreadCount(unsigned int count) { m_threadCount = count; }
+
+    /**
+     * @brief Descarta los triángulos que se ven de espaldas (activado por defecto).
+     */
+    void setBackfaceCulling(bool enabled) { m_backfaceCulling = enabled; }
+
+    /**
+     * @brief Copia la imagen en orden lineal (RGBA, fila por fila).
+     * @param out Destino de ancho * alto * 4 bytes.
+     */
+    void copyPixels(uint8_t* out) const;
+
+    /**
+     * @brief Copia la imagen a una `sf::Image` (no necesita contexto de OpenGL).
+     */
+    sf::Image copyToImage() const;
+
+    /**
+     * @brief Agrega un cubo con un color por cara (para demostraciones y mediciones).
+     * @param out Lista de vértices a la que se agregan 36 vértices.
+     * @param halfSize Mitad del lado.
+     */
+    static void appendCube(std::vector<Vertex3D>& out, float halfSize);
+
+    sf::Vector2u getSize() const { return sf::Vector2u(m_width, m_height); }
+
+    // Estadísticas del último `render`.
+    size_t getSubmittedTriangleCount() const { return m_stats.submitted; } ///< Triángulos enviados.
+    size_t getCulledTriangleCount() const { return m_stats.culled; }       ///< Fuera de la vista o de espaldas.
+    size_t getClippedTriangleCount() const { return m_stats.clipped; }     ///< Cortados por el plano cercano.
+    size_t getRasterizedTriangleCount() const { return m_stats.rasterized; } ///< Triángulos en pantalla.
+    size_t getBinEntryCount() const { return m_stats.binEntries; }         ///< Pares triángulo-mosaico.
+
+private:
+    /**
+     * @struct ScreenVertex
+     * @brief Vértice proyectado: posición en píxeles, profundidad en [0, 1] y atributos divididos
+     * entre w para interpolarlos con corrección de perspectiva.
+     */
+    struct ScreenVertex {
+        float x, y;          ///< Posición en píxeles.
+        float depth;         ///< Profundidad en [0, 1].
+        float inverseW;      ///< 1 / w.
+        float color[4];      ///< Color (en [0, 1]) multiplicado por 1 / w.
+    };
+
+    /**
+     * @struct ScreenTriangle
+     * @brief Triángulo proyectado con área positiva.
+     */
+    struct ScreenTriangle {
+        ScreenVertex vertex[3];
+    };
+
+    /**
+     * @struct ClipVertex
+     * @brief Vértice en coordenadas de recorte, antes de dividir entre w.
+     */
+    struct ClipVertex {
+        Vector4 position;
+        float color[4];
+    };
+
+    /**
+     * @struct Stats
+     * @brief Contadores de un bloque o del fotograma.
+     */
+    struct Stats {
+        size_t submitted = 0;
+        size_t culled = 0;
+        size_t clipped = 0;
+        size_t rasterized = 0;
+        size_t binEntries = 0;
+    };
+
+    /**
+     * @struct Chunk
+     * @brief Resultado de la clasificación de un bloque de triángulos.
+     */
+    struct Chunk {
+        std::vector<ScreenTriangle> triangles;        ///< Triángulos proyectados del bloque.
+        std::vector<std::vector<uint32_t>> tileBins;  ///< Índices en `triangles` por mosaico.
+        Stats stats;                                  ///< Contadores del bloque.
+    };
+
+    /**
+     * @brief Reparte `count` índices entre los hilos configurados.
+     */
+    void parallelFor(size_t count, const std::function<void(size_t)>& body);
+
+    /**
+     * @brief Transforma, recorta y clasifica un bloque de triángulos.
+     */
+    void processChunk(size_t chunkIndex);
+
+    /**
+     * @brief Proyecta un triángulo ya recortado y lo agrega a los mosaicos del bloque.
+     */
+    void emitTriangle(Chunk& chunk, const ClipVertex& a, const ClipVertex& b, const ClipVertex& c);
+
+    /**
+     * @brief Rasteriza todos los triángulos que tocan un mosaico.
+     */
+    void rasterizeTile(size_t tileIndex);
+
+    /**
+     * @brief Rasteriza un triángulo dentro de un mosaico con prueba de profundidad.
+     */
+    void rasterizeTriangle(const ScreenTriangle& triangle, size_t tileIndex,
+                           int minX, int minY, int maxX, int maxY);
+
+    unsigned int m_width;            ///< Ancho de la imagen.
+    unsigned int m_height;           ///< Alto de la imagen.
+    unsigned int m_tilesX;           ///< Mosaicos por fila.
+    unsigned int m_tilesY;           ///< Filas de mosaicos.
+    std::vector<uint8_t> m_color;    ///< Color RGBA por mosaicos (TILE_SIZE x TILE_SIZE contiguos).
+    std::vector<float> m_depth;      ///< Profundidad por mosaicos.
+
+    Matrix4 m_viewProjection;                ///< Proyección * vista.
+    std::vector<Vertex3D> m_vertices;        ///< Vértices enviados.
+    std::vector<uint32_t> m_triangleDraws;   ///< Envío al que pertenece cada triángulo.
+    std::vector<Matrix4> m_drawTransforms;   ///< Modelo-vista-proyección de cada envío.
+    std::vector<Chunk> m_chunks;             ///< Bloques reutilizados entre fotogramas.
+    size_t m_chunkCount = 0;                 ///< Bloques usados en el último `render`.
+
+    unsigned int m_threadCount = 0;  ///< Hilos a usar (0 = todos).
+    bool m_backfaceCulling = true;   ///< Descartar caras de espaldas.
+    Stats m_stats;                   ///< Contadores del último `render`.
+};
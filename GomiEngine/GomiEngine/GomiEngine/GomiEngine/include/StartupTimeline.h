@@ -0,0 +1,75 @@
+#pragma once
+#include "Prerequisites.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+/**
+ * @struct StartupPhase
+ * @brief Intervalo del arranque, en milisegundos desde el inicio de la aplicación.
+ */
+struct StartupPhase {
+    std::string name;     ///< Nombre de la fase.
+    float startMs = 0.0f; ///< Inicio.
+    float endMs = -1.0f;  ///< Fin (negativo mientras sigue abierta).
+};
+
+/**
+ * @class StartupTimeline
+ * @brief Registra las fases del arranque hasta el primer fotograma. Las fases pueden solaparse
+ * (p. ej. la decodificación en segundo plano mientras se crean los actores).
+ */
+class StartupTimeline {
+public:
+    StartupTimeline() : m_origin(std::chrono::steady_clock::now()) {} ///< El origen es el momento de construcción.
+
+    /**
+     * @brief Abre una fase.
+     * @return Índice para cerrarla con `end`.
+     */
+    size_t begin(const std::string& name) {
+        m_phases.push_back({ name, elapsedMs(), -1.0f });
+        return m_phases.size() - 1;
+    }
+
+    /**
+     * @brief Cierra una fase abierta con `begin`.
+     */
+    void end(size_t phase) {
+        if (phase < m_phases.size()) {
+            m_phases[phase].endMs = elapsedMs();
+        }
+    }
+
+    /**
+     * @brief Marca el primer fotograma dibujado (solo cuenta la primera llamada).
+     */
+    void markFirstFrame() {
+        if (m_firstFrameMs < 0.0f) {
+            m_firstFrameMs = elapsedMs();
+        }
+    }
+
+    float getTimeToFirstFrameMs() const { return m_firstFrameMs; }          ///< Negativo si aún no hay fotograma.
+    const std::vector<StartupPhase>& getPhases() const { return m_phases; } ///< Fases en orden de inicio.
+
+    /**
+     * @brief Envía las fases y el tiempo hasta el primer fotograma al registro del motor.
+     */
+    void log() const {
+        for (const StartupPhase& phase : m_phases) {
+            GOMI_LOG_INFO("Startup", "%s: %.1f -> %.1f ms (%.1f ms)", phase.name, phase.startMs, phase.endMs,
+                          phase.endMs - phase.startMs);
+        }
+        GOMI_LOG_INFO("Startup", "First frame: %.1f ms", m_firstFrameMs);
+    }
+
+private:
+    float elapsedMs() const {
+        return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - m_origin).count();
+    }
+
+    std::chrono::steady_clock::time_point m_origin; ///< Inicio de la aplicación.
+    std::vector<StartupPhase> m_phases;             ///< Fases registradas.
+    float m_firstFrameMs = -1.0f;                   ///< Primer fotograma (negativo si no hubo).
+};
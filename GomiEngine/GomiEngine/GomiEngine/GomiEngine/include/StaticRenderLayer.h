@@ -0,0 +1,100 @@
+#pragma once
+#include "Prerequisites.h"
+#include "Actor.h"
+
+class Window;
+
+/**
+ * @class StaticRenderLayer
+ * @brief Hornea una sola vez la geometría de los actores marcados como estáticos.
+ *
+ * Los triángulos de los actores estáticos se agrupan en rachas por textura y cada racha se sube a
+ * un `sf::VertexBuffer` con uso `Static`; si la tarjeta no admite VBO se conserva un
+ * `sf::VertexArray` equivalente. En cada fotograma solo se calcula una firma por actor
+ * (geometría, transformación, color, textura y región); el horneado se repite únicamente cuando
+ * la firma de algún actor estático cambia o cuando cambia el conjunto de actores estáticos.
+ */
+class StaticRenderLayer {
+public:
+    StaticRenderLayer() = default; ///< Constructor por defecto.
+    ~StaticRenderLayer() = default; ///< Destructor por defecto.
+
+    /**
+     * @brief Revisa los actores estáticos y vuelve a hornear si alguno cambió. Llamar una vez por
+     * fotograma, antes de dibujar (reinicia el conteo de llamadas de dibujo).
+     * @param actors Actores de la escena; se consideran los que tienen `isStatic()`.
+     * @return `true` si la capa se volvió a hornear en esta llamada.
+     */
+    bool update(const std::vector<EngineUtilities::TSharedPointer<Actor>>& actors);
+
+    /**
+     * @brief Dibuja la geometría horneada, una llamada por textura.
+     * @param window Ventana donde se dibuja.
+     */
+    void draw(Window& window);
+
+    /**
+     * @brief Dibuja la geometría horneada en un destino de SFML (p. ej. una vista previa).
+     * @param target Ventana o textura de render donde se dibuja.
+     */
+    void draw(sf::RenderTarget& target);
+
+    /**
+     * @brief Obliga a hornear de nuevo en la próxima actualización.
+     */
+    void invalidate() { m_signature = 0; }
+
+    /**
+     * @brief Vértices guardados en la capa estática.
+     */
+    size_t getStaticVertexCount() const { return m_vertexCount; }
+
+    /**
+     * @brief Formas estáticas encontradas en el último `update`.
+     */
+    size_t getStaticShapeCount() const { return m_shapes.size(); }
+
+    /**
+     * @brief Llamadas de dibujo emitidas desde el último `update` (una por racha y destino).
+     */
+    size_t getDrawCallCount() const { return m_drawCallCount; }
+
+    /**
+     * @brief Veces que la capa se ha horneado desde su creación.
+     */
+    size_t getBakeCount() const { return m_bakeCount; }
+
+    /**
+     * @brief Indica si la geometría está en memoria de video.
+     */
+    bool usesVertexBuffer() const { return m_useVertexBuffer; }
+
+    /**
+     * @struct Range
+     * @brief Racha de triángulos que comparten textura.
+     */
+    struct Range {
+        const sf::Texture* texture = nullptr;       ///< Textura de la racha (puede ser nula).
+        sf::VertexBuffer buffer{ sf::Triangles, sf::VertexBuffer::Static }; ///< Copia en GPU.
+        sf::VertexArray vertices{ sf::Triangles };  ///< Copia en CPU, usada si no hay VBO.
+    };
+
+private:
+    /**
+     * @brief Firma de una forma: cambia si cambia algo de lo que se hornea.
+     */
+    static unsigned long long computeSignature(const ShapeFactory& shape, unsigned long long hash);
+
+    /**
+     * @brief Regenera las rachas a partir de las formas estáticas.
+     */
+    void bake(const std::vector<const ShapeFactory*>& shapes);
+
+    std::vector<Range> m_ranges;           ///< Rachas horneadas en orden de dibujo.
+    std::vector<const ShapeFactory*> m_shapes; ///< Formas estáticas del fotograma (se reutiliza).
+    unsigned long long m_signature = 0;    ///< Firma combinada del último horneado.
+    size_t m_vertexCount = 0;              ///< Vértices horneados.
+    size_t m_bakeCount = 0;                ///< Horneados realizados.
+    size_t m_drawCallCount = 0;            ///< Llamadas de dibujo desde el último `update`.
+    bool m_useVertexBuffer = sf::VertexBuffer::isAvailable(); ///< Se decide una vez por capa.
+};
@@ -0,0 +1,225 @@
+#pragma once
+#include "Prerequisites.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+struct LogRecord;
+
+/**
+ * @brief Bytes de texto de un `LogRecord`; en los mensajes estructurados guardan los argumentos.
+ */
+constexpr size_t LOG_RECORD_TEXT_BYTES = 212;
+
+/**
+ * @brief Texto máximo de un mensaje ya formateado (los estructurados pueden crecer al formatear).
+ */
+constexpr size_t LOG_MESSAGE_BYTES = 1024;
+
+/**
+ * @brief Severidad mínima que se compila en `GOMI_LOG` (0 = todo, 1 = WARNING y ERROR, 2 = solo
+ * ERROR, 3 = nada). Las llamadas por debajo desaparecen: ni sus argumentos se evalúan.
+ */
+#ifndef GOMI_LOG_MIN_LEVEL
+#define GOMI_LOG_MIN_LEVEL 0
+#endif
+
+/**
+ * @struct LogFormat
+ * @brief Datos fijos de una llamada a `GOMI_LOG`: viven en una variable estática por llamada, así
+ * que el mensaje solo guarda un puntero a ellos y los argumentos sin formatear.
+ */
+struct LogFormat {
+    ConsolErrorType severity;          ///< Severidad.
+    const char* source;                ///< Origen del mensaje.
+    const char* format;                ///< Formato estilo `printf`.
+    const char* file;                  ///< Archivo de la llamada.
+    int line;                          ///< Línea de la llamada.
+    std::atomic<uint32_t> id{ 0 };     ///< Identificador en el registro binario (0 hasta el primer uso).
+};
+
+/**
+ * @enum LogArgType
+ * @brief Etiqueta de cada argumento guardado. Los enteros se guardan en 64 bits y al formatear se
+ * usa el tipo que pide el formato, así que `%d` con un `size_t` no lee memoria de más.
+ */
+enum class LogArgType : uint8_t {
+    INT = 1, ///< Entero con signo (8 bytes).
+    UINT,    ///< Entero sin signo (8 bytes).
+    DOUBLE,  ///< Punto flotante (8 bytes).
+    STRING,  ///< Texto copiado: longitud de 2 bytes y los caracteres.
+    POINTER  ///< Dirección (8 bytes).
+};
+
+/**
+ * @class LogArgWriter
+ * @brief Escribe los argumentos de un mensaje en un búfer fijo; lo que no cabe se omite.
+ */
+class LogArgWriter {
+public:
+    LogArgWriter(uint8_t* data, size_t capacity) : m_data(data), m_capacity(capacity) {}
+
+    void putInt(int64_t value) { putValue(LogArgType::INT, &value); }
+    void putUInt(uint64_t value) { putValue(LogArgType::UINT, &value); }
+    void putDouble(double value) { putValue(LogArgType::DOUBLE, &value); }
+    void putPointer(const void* value) {
+        uint64_t address = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value));
+        putValue(LogArgType::POINTER, &address);
+    }
+
+    /**
+     * @brief Copia el texto (recortado a lo que quepa).
+     */
+    void putString(std::string_view text) {
+        if (m_size + 3 > m_capacity) {
+            m_size = m_capacity;
+            return;
+        }
+        uint16_t length = static_cast<uint16_t>(std::min(text.size(), m_capacity - m_size - 3));
+        m_data[m_size] = static_cast<uint8_t>(LogArgType::STRING);
+        std::memcpy(m_data + m_size + 1, &length, sizeof(length));
+        std::memcpy(m_data + m_size + 3, text.data(), length);
+        m_size += 3 + length;
+    }
+
+    size_t size() const { return m_size; } ///< Bytes escritos.
+
+private:
+    void putValue(LogArgType type, const void* value) {
+        if (m_size + 9 > m_capacity) {
+            m_size = m_capacity;
+            return;
+        }
+        m_data[m_size] = static_cast<uint8_t>(type);
+        std::memcpy(m_data + m_size + 1, value, 8);
+        m_size += 9;
+    }
+
+    uint8_t* m_data;
+    size_t m_capacity;
+    size_t m_size = 0;
+};
+
+/**
+ * @brief Guarda un argumento según su tipo. Los textos (`const char*`, `std::string`, literales)
+ * se copian porque se formatean más tarde, en otro hilo o en otro proceso.
+ */
+template<typename T>
+void
+encodeLogArg(LogArgWriter& writer, const T& value) {
+    using Type = std::decay_t<T>;
+    if constexpr (std::is_same_v<Type, const char*> || std::is_same_v<Type, char*>) {
+        writer.putString(value != nullptr ? std::string_view(value) : std::string_view("(null)"));
+    }
+    else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+        writer.putString(std::string_view(value));
+    }
+    else if constexpr (std::is_enum_v<Type>) {
+        writer.putInt(static_cast<int64_t>(value));
+    }
+    else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
+        writer.putInt(static_cast<int64_t>(value));
+    }
+    else if constexpr (std::is_integral_v<Type>) {
+        writer.putUInt(static_cast<uint64_t>(value));
+    }
+    else if constexpr (std::is_floating_point_v<Type>) {
+        writer.putDouble(static_cast<double>(value));
+    }
+    else {
+        static_assert(std::is_pointer_v<Type>, "GOMI_LOG: tipo de argumento no soportado");
+        writer.putPointer(value);
+    }
+}
+
+/**
+ * @brief Escribe un mensaje estructurado en el registro (ver `NotificationService::logStructured`).
+ */
+void
+submitStructuredLog(LogFormat& format, const uint8_t* args, size_t size);
+
+/**
+ * @brief Guarda los argumentos de una llamada a `GOMI_LOG` y la envía al registro.
+ */
+template<typename... Args>
+void
+writeStructuredLog(LogFormat& format, const Args&... args) {
+    uint8_t data[LOG_RECORD_TEXT_BYTES];
+    LogArgWriter writer(data, sizeof(data));
+    (encodeLogArg(writer, args), ...);
+    submitStructuredLog(format, data, writer.size());
+}
+
+/**
+ * @brief Formatea un mensaje estructurado: recorre `format` y aplica cada especificador de
+ * `printf` al siguiente argumento guardado.
+ * @return Bytes escritos en `out` (sin el terminador).
+ */
+size_t
+formatStructuredMessage(const char* format, const uint8_t* args, size_t size, char* out, size_t capacity);
+
+/**
+ * @brief Texto de un mensaje del búfer, formateando los estructurados.
+ * @return Bytes escritos en `out` (sin el terminador).
+ */
+size_t
+formatLogMessage(const LogRecord& record, char* out, size_t capacity);
+
+/**
+ * @brief Línea de texto de un mensaje, igual en `LogSink` y en el decodificador.
+ * @return Bytes escritos en `out` (sin el terminador), recortada a `capacity`.
+ */
+size_t
+formatLogLine(char* out, size_t capacity, uint64_t timestampNs, uint32_t threadId, const char* source,
+              ConsolErrorType severity, const char* message);
+
+/**
+ * @brief Convierte un registro binario (`.glog`) a texto.
+ * @param path Archivo binario.
+ * @param out Destino del texto.
+ * @param recordCount Recibe la cantidad de mensajes decodificados.
+ * @return false si el archivo no existe, no es un registro binario o está cortado (lo anterior al
+ * corte sí se escribe).
+ */
+bool
+decodeBinaryLog(const std::string& path, std::FILE* out, size_t& recordCount);
+
+/**
+ * @brief Registro binario (`.glog`), en el orden de bytes de la máquina que lo escribió:
+ * encabezado `GLOG` + versión (4 bytes), y después entradas que empiezan con su tipo (1 byte).
+ * - FORMAT: id (4), severidad (4), línea (4), longitudes de origen, archivo y formato (2 cada una)
+ *   y los tres textos. Cada archivo incluye los formatos que usa antes de su primer mensaje.
+ * - RECORD: tiempo en ns (8), hilo (4), severidad (1), id de formato (4; 0 = texto ya formateado),
+ *   bytes de datos (2); si es texto, longitud del origen (2) y el origen; al final los datos.
+ */
+namespace BinaryLog {
+    constexpr char MAGIC[4] = { 'G', 'L', 'O', 'G' };
+    constexpr uint32_t VERSION = 1;
+    constexpr uint8_t ENTRY_FORMAT = 1;
+    constexpr uint8_t ENTRY_RECORD = 2;
+}
+
+/**
+ * @brief Mensaje estructurado: guarda el formato (una sola vez por llamada, en una variable
+ * estática) y los argumentos; el texto se arma solo al leerlo: en `LogSink` si escribe texto, en la
+ * consola para las líneas que muestra o en `--decode-log`.
+ * @code
+ * GOMI_LOG(ConsolErrorType::WARNING, "ResourceManager", "Texture %s is %zu KB", name, bytes / 1024);
+ * @endcode
+ */
+#define GOMI_LOG(severity, source, format, ...)                                                     \
+    do {                                                                                            \
+        if constexpr (static_cast<int>(severity) >= GOMI_LOG_MIN_LEVEL) {                           \
+            static LogFormat gomiLogFormat_{ severity, source, format, __FILE__, __LINE__ };        \
+            writeStructuredLog(gomiLogFormat_, ##__VA_ARGS__);                                      \
+        }                                                                                           \
+    } while (0)
+
+#define GOMI_LOG_INFO(source, format, ...) GOMI_LOG(ConsolErrorType::NORMAL, source, format, ##__VA_ARGS__)
+#define GOMI_LOG_WARNING(source, format, ...) GOMI_LOG(ConsolErrorType::WARNING, source, format, ##__VA_ARGS__)
+#define GOMI_LOG_ERROR(source, format, ...) GOMI_LOG(ConsolErrorType::ERROR, source, format, ##__VA_ARGS__)
@@ -0,0 +1,168 @@
+#pragma once
+#include "Prerequisites.h"
+#include <unordered_set>
+
+/**
+ * @class SweepAndPrune
+ * @brief Broadphase incremental de barrido y poda (sweep-and-prune) en dos ejes.
+ *
+ * Mantiene por cada eje un arreglo ordenado de extremos (min/max) de las cajas
+ * envolventes. Como los actores se mueven poco entre fotogramas, los arreglos
+ * se reordenan con insertion sort y cada intercambio entre un min y un max
+ * indica exactamente cuándo un par empieza o deja de traslaparse. Los pares
+ * activos se guardan en una caché persistente que genera eventos de inicio y
+ * fin de traslape.
+ */
+class SweepAndPrune {
+public:
+    /// Identificador inválido de proxy.
+    static constexpr unsigned int INVALID_PROXY = 0xFFFFFFFFu;
+
+    /**
+     * @struct OverlapEvent
+     * @brief Evento de cambio de traslape entre dos proxies.
+     */
+    struct OverlapEvent {
+        unsigned int proxyA; ///< Proxy con el identificador menor.
+        unsigned int proxyB; ///< Proxy con el identificador mayor.
+        bool begin;          ///< `true` si el par empezó a traslaparse, `false` si terminó.
+    };
+
+    SweepAndPrune() = default; ///< Constructor por defecto.
+    ~SweepAndPrune() = default; ///< Destructor por defecto.
+
+    /**
+     * @brief Registra una caja envolvente en el broadphase.
+     * Los traslapes que ya existan con otros proxies se reportan como eventos de inicio.
+     * @param bounds Caja envolvente en coordenadas de mundo.
+     * @param userData Dato opaco asociado al proxy (por ejemplo, el actor).
+     * @return Identificador del proxy creado.
+     */
+    unsigned int createProxy(const sf::FloatRect& bounds, void* userData);
+
+    /**
+     * @brief Elimina un proxy. Sus pares activos se reportan como eventos de fin.
+     * @param proxyId Identificador del proxy a eliminar.
+     */
+    void destroyProxy(unsigned int proxyId);
+
+    /**
+     * @brief Actualiza la caja envolvente de un proxy y reordena sus extremos.
+     * El costo es proporcional a la cantidad de extremos que el proxy cruza.
+     * @param proxyId Identificador del proxy.
+     * @param bounds Nueva caja envolvente en coordenadas de mundo.
+     */
+    void moveProxy(unsigned int proxyId, const sf::FloatRect& bounds);
+
+    /**
+     * @brief Obtiene el dato de usuario asociado a un proxy.
+     * @param proxyId Identificador del proxy.
+     * @return Dato opaco registrado en `createProxy`.
+     */
+    void* getUserData(unsigned int proxyId) const;
+
+    /**
+     * @brief Obtiene la caja envolvente registrada para un proxy.
+     * @param proxyId Identificador del proxy.
+     * @return Caja envolvente actual del proxy.
+     */
+    const sf::FloatRect& getBounds(unsigned int proxyId) const;
+
+    /**
+     * @brief Indica si dos proxies forman actualmente un par traslapado.
+     * @param proxyA Primer proxy.
+     * @param proxyB Segundo proxy.
+     * @return `true` si el par está en la caché.
+     */
+    bool isOverlapping(unsigned int proxyA, unsigned int proxyB) const;
+
+    /**
+     * @brief Eventos de inicio/fin de traslape acumulados desde el último `clearEvents`.
+     * Si un par se toca y se separa dentro del mismo fotograma se reportan ambos eventos en orden.
+     */
+    const std::vector<OverlapEvent>& getEvents() const { return m_events; }
+
+    /**
+     * @brief Descarta los eventos acumulados. Se llama una vez por fotograma tras consumirlos.
+     */
+    void clearEvents() { m_events.clear(); }
+
+    /**
+     * @brief Cantidad de pares traslapados en la caché persistente.
+     */
+    size_t getPairCount() const { return m_pairs.size(); }
+
+    /**
+     * @brief Cantidad de proxies activos.
+     */
+    size_t getProxyCount() const { return m_endpoints[0].size() / 2; }
+
+    /**
+     * @brief Intercambios de insertion sort realizados desde el último `resetStats`.
+     * Sirve para verificar que el costo por fotograma sigue la coherencia temporal.
+     */
+    size_t getSwapCount() const { return m_swapCount; }
+
+    /**
+     * @brief Reinicia los contadores de estadísticas.
+     */
+    void resetStats() { m_swapCount = 0; }
+
+private:
+    /**
+     * @struct Endpoint
+     * @brief Extremo de una caja en un eje: valor y proxy dueño (el bit bajo indica si es max).
+     */
+    struct Endpoint {
+        float value;
+        unsigned int data;
+
+        unsigned int proxyId() const { return data >> 1; }
+        bool isMax() const { return (data & 1u) != 0; }
+    };
+
+    /**
+     * @struct Proxy
+     * @brief Estado interno de una caja registrada.
+     */
+    struct Proxy {
+        sf::FloatRect bounds;
+        unsigned int minIndex[2] = { 0, 0 };
+        unsigned int maxIndex[2] = { 0, 0 };
+        void* userData = nullptr;
+        unsigned int nextFree = INVALID_PROXY;
+        bool active = false;
+    };
+
+    // Orden de los extremos: a igual valor, el max va antes que el min (cajas que solo se tocan no se traslapan).
+    static bool endpointLess(const Endpoint& a, const Endpoint& b) {
+        return a.value < b.value || (a.value == b.value && a.isMax() && !b.isMax());
+    }
+
+    static float minOf(const sf::FloatRect& r, int axis) { return axis == 0 ? r.left : r.top; }
+    static float maxOf(const sf::FloatRect& r, int axis) { return axis == 0 ? r.left + r.width : r.top + r.height; }
+
+    static unsigned long long pairKey(unsigned int a, unsigned int b) {
+        if (a > b) {
+            std::swap(a, b);
+        }
+        return (static_cast<unsigned long long>(a) << 32) | b;
+    }
+
+    bool testOverlap(unsigned int proxyA, unsigned int proxyB) const;
+    void addPair(unsigned int proxyA, unsigned int proxyB);
+    void removePair(unsigned int proxyA, unsigned int proxyB);
+    void setIndex(int axis, unsigned int index);
+
+    void sortMinDown(int axis, unsigned int index, bool updatePairs);
+    void sortMinUp(int axis, unsigned int index, bool updatePairs);
+    void sortMaxDown(int axis, unsigned int index, bool updatePairs);
+    void sortMaxUp(int axis, unsigned int index, bool updatePairs);
+
+    std::vector<Endpoint> m_endpoints[2];          ///< Extremos ordenados por eje (X, Y).
+    std::vector<Proxy> m_proxies;                  ///< Proxies indexados por identificador.
+    unsigned int m_freeList = INVALID_PROXY;       ///< Primer identificador libre para reutilizar.
+    std::unordered_set<unsigned long long> m_pairs; ///< Caché persistente de pares traslapados.
+    std::vector<OverlapEvent> m_events;            ///< Eventos pendientes de consumir.
+    size_t m_swapCount = 0;                        ///< Intercambios realizados (estadística).
+};
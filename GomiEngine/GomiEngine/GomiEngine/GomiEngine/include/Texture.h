@@ -1,6 +1,7 @@
 #pragma once
 #include "Prerequisites.h"
 #include "Component.h"
+#include "TextureCooker.h"
 #include <SFML/Graphics.hpp>
 #include <iostream>
 
@@ -32,6 +33,35 @@ public:
         }
     }
 
+    /**
+     * @brief Constructor que crea la textura a partir de una imagen ya decodificada (por ejemplo, un atlas).
+     * @param textureName Nombre con el que se identifica la textura.
+     * @param image Imagen a subir a la GPU.
+     */
+    Texture(const std::string& textureName, const sf::Image& image)
+        : m_textureName(textureName),
+        m_extension(""),
+        Component(ComponentType::TEXTURE) {
+        if (!m_texture.loadFromImage(image)) {
+            std::cerr << "Error al crear textura desde imagen: " << m_textureName << std::endl;
+        }
+    }
+
+    /**
+     * @brief Constructor que sube una textura cocinada (`.gtex`) sin decodificar, con sus mips.
+     * @param textureName Nombre con el que se identifica la textura.
+     * @param image Textura cocinada (ver `TextureCooker`).
+     */
+    Texture(const std::string& textureName, const CookedImage& image)
+        : m_textureName(textureName),
+        m_extension("gtex"),
+        m_premultiplied(image.premultiplied),
+        Component(ComponentType::TEXTURE) {
+        if (!uploadCookedTexture(m_texture, image)) {
+            std::cerr << "Error al subir textura cocinada: " << m_textureName << std::endl;
+        }
+    }
+
     /**
      * @brief Destructor por defecto.
      * Libera recursos asociados con la textura.
@@ -46,6 +76,14 @@ public:
         return m_texture;
     }
 
+    /**
+     * @brief Indica si el color viene multiplicado por alfa (hay que dibujarla con
+     * `sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha)`).
+     */
+    bool isPremultiplied() const {
+        return m_premultiplied;
+    }
+
     /**
      * @brief Actualiza el componente de textura (actualmente vaco).
      * @param deltaTime Tiempo transcurrido desde la ltima actualizacin.
@@ -62,4 +100,5 @@ private:
     std::string m_textureName; ///< Nombre del archivo de la textura (sin extensin).
     std::string m_extension;   ///< Extensin del archivo de la textura.
     sf::Texture m_texture;     ///< Instancia de la textura SFML.
+    bool m_premultiplied = false; ///< Color premultiplicado por alfa.
 };
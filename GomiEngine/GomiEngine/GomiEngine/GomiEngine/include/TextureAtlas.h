@@ -0,0 +1,86 @@
+#pragma once
+#include "Prerequisites.h"
+
+/**
+ * @class TextureAtlas
+ * @brief Empaqueta varias imágenes en una sola con `imstb_rectpack` y genera su tabla de regiones.
+ *
+ * La decodificación y la copia de píxeles se reparten en el `JobSystem`. El empaquetado es
+ * determinista: las imágenes se ordenan por nombre y el ordenamiento interno de stb es estable,
+ * así que las mismas entradas producen siempre el mismo atlas. El atlas se guarda como
+ * `<base>.png` más la tabla `<base>.atlas`, que incluye un hash de las fuentes para reutilizar
+ * el resultado entre ejecuciones mientras ningún archivo cambie.
+ */
+class TextureAtlas {
+public:
+    TextureAtlas() = default; ///< Constructor por defecto.
+    ~TextureAtlas() = default; ///< Destructor por defecto.
+
+    /**
+     * @brief Agrega una imagen al atlas.
+     * @param spriteName Nombre con el que se consultará la región (p. ej. "Characters/tile000").
+     * @param filePath Ruta del archivo de imagen.
+     */
+    void addImage(const std::string& spriteName, const std::string& filePath);
+
+    /**
+     * @brief Decodifica las imágenes y las empaqueta en el atlas más pequeño posible.
+     * @param maxSize Lado máximo del atlas en píxeles.
+     * @param padding Separación en píxeles entre regiones.
+     * @return `true` si todas las imágenes cupieron.
+     */
+    bool build(unsigned int maxSize = 4096, unsigned int padding = 1);
+
+    /**
+     * @brief Guarda la imagen del atlas y su tabla de regiones.
+     * @param basePath Ruta base sin extensión.
+     * @return `true` si ambos archivos se escribieron.
+     */
+    bool saveToFiles(const std::string& basePath) const;
+
+    /**
+     * @brief Carga un atlas guardado si su hash coincide con las fuentes registradas.
+     * @param basePath Ruta base sin extensión.
+     * @return `true` si el atlas en disco sigue vigente y se cargó.
+     */
+    bool loadFromFiles(const std::string& basePath);
+
+    /**
+     * @brief Reutiliza el atlas en disco si sigue vigente; si no, lo construye y lo guarda.
+     * @param basePath Ruta base sin extensión.
+     * @return `true` si el atlas quedó disponible.
+     */
+    bool loadOrBuild(const std::string& basePath);
+
+    /**
+     * @brief Busca la región en píxeles de un sprite.
+     * @param spriteName Nombre del sprite.
+     * @param rect Región encontrada.
+     * @return `true` si el sprite está en el atlas.
+     */
+    bool findRegion(const std::string& spriteName, sf::IntRect& rect) const;
+
+    /**
+     * @brief Hash de las fuentes (nombre, tamaño y fecha de modificación de cada archivo).
+     */
+    unsigned long long computeSourceHash() const;
+
+    // Acceso al resultado.
+    const sf::Image& getImage() const { return m_image; }
+    const std::unordered_map<std::string, sf::IntRect>& getRegions() const { return m_regions; }
+
+private:
+    /**
+     * @struct Source
+     * @brief Imagen de entrada y su ruta.
+     */
+    struct Source {
+        std::string name;
+        std::string path;
+        sf::Image image;
+    };
+
+    std::vector<Source> m_sources;                          ///< Imágenes registradas.
+    sf::Image m_image;                                      ///< Imagen del atlas.
+    std::unordered_map<std::string, sf::IntRect> m_regions; ///< Nombre del sprite -> región en píxeles.
+};
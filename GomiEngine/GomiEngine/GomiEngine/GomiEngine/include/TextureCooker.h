@@ -0,0 +1,102 @@
+#pragma once
+#include <SFML/Graphics/Texture.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct CookedImage
+ * @brief Vista de una textura cocinada (`.gtex`): apunta a los datos, no los copia.
+ */
+struct CookedImage {
+    static constexpr uint32_t MAX_LEVELS = 16; ///< Niveles máximos (suficiente para 32768 px).
+
+    uint32_t width = 0;                        ///< Ancho del nivel 0.
+    uint32_t height = 0;                       ///< Alto del nivel 0.
+    uint32_t levelCount = 0;                   ///< Niveles de mip (1 = sin mips).
+    bool premultiplied = false;                ///< El color está multiplicado por alfa.
+    uint64_t sourceHash = 0;                   ///< Hash del archivo de origen y de las opciones.
+    const uint8_t* levels[MAX_LEVELS] = {};    ///< Píxeles RGBA8 de cada nivel.
+
+    /**
+     * @brief Lee el encabezado y ubica los niveles.
+     * @param data Contenido del archivo `.gtex`.
+     * @param size Tamaño en bytes.
+     * @return true si el formato es válido y el archivo está completo.
+     */
+    bool parse(const void* data, size_t size);
+};
+
+/**
+ * @brief Sube una textura cocinada: crea la textura con el nivel 0 sin decodificar nada y, si hay
+ * un contexto de OpenGL activo, sube también los mips ya generados.
+ * Vive en su propio archivo .cpp porque los encabezados de OpenGL incluyen `windows.h`, que choca
+ * con `ERROR` de Prerequisites.h.
+ * @return true si la textura se creó.
+ */
+bool uploadCookedTexture(sf::Texture& texture, const CookedImage& image);
+
+/**
+ * @class TextureCooker
+ * @brief Herramienta offline que convierte imágenes (PNG, JPG, BMP, TGA) al formato `.gtex`.
+ *
+ * El formato es un encabezado de `HEADER_SIZE` bytes seguido de los niveles RGBA8 sin
+ * comprimir, del más grande al más chico, así que cargarlo es solo copiar memoria a la GPU. Los
+ * mips se reducen con un filtro de caja 2x2 ponderado por alfa. El encabezado guarda el hash del
+ * contenido del archivo de origen junto con las opciones, y solo se vuelve a cocinar lo que cambió.
+ */
+class TextureCooker {
+public:
+    static constexpr uint32_t MAGIC = 0x58455447;  ///< "GTEX" en little-endian.
+    static constexpr uint32_t VERSION = 1;         ///< Versión del formato.
+    static constexpr size_t HEADER_SIZE = 64;      ///< Bytes del encabezado.
+    static constexpr uint32_t FLAG_PREMULTIPLIED = 1u << 0; ///< Bandera de color premultiplicado.
+
+    /**
+     * @brief Multiplica el color por alfa (desactivado por defecto: el motor dibuja con
+     * `sf::BlendAlpha`, que espera alfa sin premultiplicar).
+     */
+    void setPremultiply(bool enabled) { m_premultiply = enabled; }
+
+    /**
+     * @brief Genera la cadena completa de mips (activado por defecto).
+     */
+    void setGenerateMips(bool enabled) { m_generateMips = enabled; }
+
+    /**
+     * @brief Cocina una imagen si la salida no existe o su hash no coincide.
+     * @param sourcePath Imagen de origen.
+     * @param outputPath Archivo `.gtex` de salida.
+     * @param cooked Recibe true si se cocinó, false si ya estaba al día.
+     * @return false si hubo un error.
+     */
+    bool cookFile(const std::string& sourcePath, const std::string& outputPath, bool& cooked) const;
+
+    /**
+     * @brief Cocina en paralelo con `JobSystem` todas las imágenes de un directorio (recursivo).
+     * Cada `<ruta>.png` produce `<ruta>.gtex` en el directorio de salida.
+     * @param sourceDirectory Directorio de origen.
+     * @param outputDirectory Directorio de salida (puede ser el mismo).
+     * @return true si no hubo errores.
+     */
+    bool cookDirectory(const std::string& sourceDirectory, const std::string& outputDirectory);
+
+    // Estadísticas del último `cookDirectory`.
+    size_t getCookedCount() const { return m_cookedCount; }   ///< Imágenes cocinadas.
+    size_t getSkippedCount() const { return m_skippedCount; } ///< Imágenes al día.
+    size_t getFailedCount() const { return m_failedFiles.size(); } ///< Imágenes con error.
+    const std::vector<std::string>& getFailedFiles() const { return m_failedFiles; } ///< Rutas con error.
+
+private:
+    /**
+     * @brief Hash del contenido de origen combinado con las opciones de cocinado.
+     */
+    uint64_t computeHash(const void* data, size_t size) const;
+
+    bool m_premultiply = false;   ///< Premultiplicar el color.
+    bool m_generateMips = true;   ///< Generar mips.
+    size_t m_cookedCount = 0;     ///< Imágenes cocinadas.
+    size_t m_skippedCount = 0;    ///< Imágenes al día.
+    std::vector<std::string> m_failedFiles; ///< Imágenes con error.
+};
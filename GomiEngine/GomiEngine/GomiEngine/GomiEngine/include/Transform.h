@@ -65,10 +65,10 @@ public:
      */
     void Seek(const Vector2& targetPosition, float speed, float deltaTime, float range) {
         Vector2 direction = targetPosition - position;
-        float length = direction.length();  // Suponiendo que `Vector2` tenga un método `length()`
+        float length = direction.magnitude();
 
         if (length > range) {
-            direction.normalize();  // Normaliza el vector
+            direction.normalizeInPlace();  // Normaliza el vector
             position += direction * speed * deltaTime;
         }
     }
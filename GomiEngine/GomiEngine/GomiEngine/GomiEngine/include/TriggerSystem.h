@@ -0,0 +1,113 @@
+#pragma once
+#include "Prerequisites.h"
+#include "Actor.h"
+#include "TriggerVolume.h"
+#include "SweepAndPrune.h"
+
+/**
+ * @class TriggerSystem
+ * @brief Genera eventos de entrada/permanencia/salida de los `TriggerVolume` a partir del broadphase.
+ *
+ * Los volúmenes y los cuerpos (actores con `ShapeFactory`) se registran como proxies de
+ * `SweepAndPrune`. Cada fotograma solo se actualizan los proxies cuya caja cambió, y los
+ * eventos de traslape se acumulan en una cola del fotograma que se despacha en un solo lote.
+ * El trabajo es proporcional a los cruces, no a (cuerpos x volúmenes).
+ */
+class TriggerSystem {
+public:
+    TriggerSystem() = default; ///< Constructor por defecto.
+    ~TriggerSystem() = default; ///< Destructor por defecto.
+
+    /**
+     * @brief Registra un actor que contiene un `TriggerVolume`.
+     * @param actor Actor con el componente de volumen.
+     */
+    void addTrigger(EngineUtilities::TSharedPointer<Actor> actor);
+
+    /**
+     * @brief Registra un actor cuya forma puede entrar a los volúmenes.
+     * @param actor Actor con `ShapeFactory` y `Transform`.
+     */
+    void addBody(EngineUtilities::TSharedPointer<Actor> actor);
+
+    /**
+     * @brief Quita un actor del sistema. Sus traslapes activos generan eventos de salida.
+     * @param actor Actor a quitar.
+     */
+    void removeActor(const Actor* actor);
+
+    /**
+     * @brief Sincroniza los proxies con las posiciones actuales y encola los eventos del fotograma.
+     */
+    void update();
+
+    /**
+     * @brief Despacha en lote los eventos encolados y vacía la cola.
+     */
+    void dispatchEvents();
+
+    /**
+     * @brief Cantidad de eventos pendientes en la cola del fotograma.
+     */
+    size_t getQueuedEventCount() const { return m_eventQueue.size(); }
+
+    /**
+     * @brief Cantidad de eventos despachados en el último `dispatchEvents`.
+     */
+    size_t getDispatchedEventCount() const { return m_dispatchedCount; }
+
+    /**
+     * @brief Acceso de solo lectura al broadphase (estadísticas y depuración).
+     */
+    const SweepAndPrune& getBroadphase() const { return m_broadphase; }
+
+private:
+    /**
+     * @struct Entry
+     * @brief Actor registrado y su proxy en el broadphase.
+     */
+    struct Entry {
+        EngineUtilities::TSharedPointer<Actor> actor;
+        EngineUtilities::TSharedPointer<TriggerVolume> trigger; ///< Nulo para cuerpos.
+        unsigned int proxyId = SweepAndPrune::INVALID_PROXY;
+        sf::FloatRect bounds;
+    };
+
+    /**
+     * @struct ActiveOverlap
+     * @brief Par volumen/cuerpo actualmente traslapado.
+     */
+    struct ActiveOverlap {
+        size_t triggerEntry;
+        size_t bodyEntry;
+    };
+
+    /**
+     * @struct QueuedEvent
+     * @brief Evento encolado; mantiene vivos al volumen y a ambos actores hasta despacharlo.
+     */
+    struct QueuedEvent {
+        TriggerEvent event;
+        EngineUtilities::TSharedPointer<TriggerVolume> trigger;
+        EngineUtilities::TSharedPointer<Actor> triggerActor;
+        EngineUtilities::TSharedPointer<Actor> otherActor;
+    };
+
+    static constexpr size_t INVALID_ENTRY = static_cast<size_t>(-1);
+
+    void addEntry(EngineUtilities::TSharedPointer<Actor> actor,
+                  EngineUtilities::TSharedPointer<TriggerVolume> trigger);
+    sf::FloatRect computeBounds(const Entry& entry) const;
+    void collectBroadphaseEvents();
+    void enqueue(TriggerEventType type, size_t triggerEntry, size_t bodyEntry);
+
+    SweepAndPrune m_broadphase;                  ///< Broadphase compartido por volúmenes y cuerpos.
+    std::vector<Entry> m_entries;                ///< Actores registrados.
+    std::vector<size_t> m_freeEntries;           ///< Entradas libres para reutilizar.
+    std::vector<size_t> m_proxyEntries;          ///< Proxy del broadphase -> índice de entrada.
+    std::vector<ActiveOverlap> m_activeOverlaps; ///< Traslapes activos (para eventos de permanencia).
+    std::unordered_map<unsigned long long, size_t> m_overlapIndex; ///< Par -> índice en `m_activeOverlaps`.
+    std::vector<QueuedEvent> m_eventQueue;       ///< Eventos del fotograma pendientes de despachar.
+    std::vector<QueuedEvent> m_dispatchBuffer;   ///< Lote en despacho (permite encolar desde los callbacks).
+    size_t m_dispatchedCount = 0;                ///< Eventos despachados en el último lote.
+};
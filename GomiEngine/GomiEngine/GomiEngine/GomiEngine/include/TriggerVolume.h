@@ -0,0 +1,113 @@
+#pragma once
+#include "Prerequisites.h"
+#include "Component.h"
+#include <functional>
+
+class Actor;
+
+/**
+ * @enum TriggerEventType
+ * @brief Tipos de eventos que genera un volumen de disparo.
+ */
+enum
+    TriggerEventType {
+    TRIGGER_ENTER = 0,
+    TRIGGER_STAY = 1,
+    TRIGGER_EXIT = 2
+};
+
+/**
+ * @struct TriggerEvent
+ * @brief Evento de traslape entre un volumen de disparo y otro actor.
+ */
+struct TriggerEvent {
+    TriggerEventType type; ///< Entrada, permanencia o salida.
+    Actor* trigger;        ///< Actor dueño del `TriggerVolume`.
+    Actor* other;          ///< Actor que entró, permanece o salió del volumen.
+};
+
+class TriggerVolume : public Component {
+public:
+    using Callback = std::function<void(const TriggerEvent&)>;
+
+    /**
+     * @brief Constructor por defecto.
+     * Crea un volumen de 20x20 centrado en la posición del actor.
+     */
+    TriggerVolume()
+        : Component(ComponentType::TRIGGER),
+        m_size(20.0f, 20.0f) {}
+
+    /**
+     * @brief Constructor que define el tamaño del volumen.
+     * @param size Ancho y alto del volumen, centrado en la posición del actor.
+     */
+    explicit TriggerVolume(const Vector2& size)
+        : Component(ComponentType::TRIGGER),
+        m_size(size) {}
+
+    virtual ~TriggerVolume() = default;
+
+    /**
+     * @brief Actualiza el componente (los eventos los genera `TriggerSystem`).
+     * @param deltaTime Tiempo transcurrido desde la última actualización.
+     */
+    void update(float deltaTime) override {}
+
+    /**
+     * @brief Renderiza el componente (el volumen es invisible).
+     * @param window Ventana donde se renderizaría el componente.
+     */
+    void render(Window& window) override {}
+
+    // Métodos para configurar el tamaño del volumen.
+    void setSize(const Vector2& size) { m_size = size; }
+    Vector2 getSize() const { return m_size; }
+
+    /**
+     * @brief Calcula la caja del volumen en coordenadas de mundo.
+     * @param position Posición del actor (centro del volumen).
+     * @return Caja envolvente del volumen.
+     */
+    sf::FloatRect computeBounds(const Vector2& position) const {
+        return sf::FloatRect(position.x - m_size.x * 0.5f,
+                             position.y - m_size.y * 0.5f,
+                             m_size.x,
+                             m_size.y);
+    }
+
+    // Métodos para registrar las funciones que reciben los eventos.
+    void setOnEnter(const Callback& callback) { m_onEnter = callback; }
+    void setOnStay(const Callback& callback) { m_onStay = callback; }
+    void setOnExit(const Callback& callback) { m_onExit = callback; }
+
+    /**
+     * @brief Indica si el volumen quiere eventos de permanencia.
+     * Solo los volúmenes con callback de permanencia pagan el costo por fotograma de esos eventos.
+     */
+    bool wantsStayEvents() const { return static_cast<bool>(m_onStay); }
+
+    /**
+     * @brief Entrega un evento al callback correspondiente.
+     * @param event Evento a despachar.
+     */
+    void dispatch(const TriggerEvent& event) const {
+        switch (event.type) {
+        case TRIGGER_ENTER:
+            if (m_onEnter) m_onEnter(event);
+            break;
+        case TRIGGER_STAY:
+            if (m_onStay) m_onStay(event);
+            break;
+        case TRIGGER_EXIT:
+            if (m_onExit) m_onExit(event);
+            break;
+        }
+    }
+
+private:
+    Vector2 m_size;    // Ancho y alto del volumen.
+    Callback m_onEnter; // Callback de entrada.
+    Callback m_onStay;  // Callback de permanencia.
+    Callback m_onExit;  // Callback de salida.
+};
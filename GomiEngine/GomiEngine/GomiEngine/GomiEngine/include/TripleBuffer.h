@@ -0,0 +1,77 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class TripleBuffer
+ * @brief Intercambio sin bloqueos entre un productor y un consumidor.
+ *
+ * Hay tres copias de `T`: el productor escribe en una, el consumidor lee otra y la tercera
+ * guarda la última publicada. Publicar y adquirir son un solo `exchange` atómico sobre el
+ * índice compartido, así que ninguno de los dos hilos espera al otro. El consumidor siempre
+ * recibe la publicación más reciente (las intermedias se descartan), por lo que la latencia
+ * queda acotada a un fotograma del productor más lo que tarde el consumidor.
+ *
+ * Solo admite un hilo productor y un hilo consumidor.
+ */
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() = default; ///< Constructor por defecto.
+    ~TripleBuffer() = default; ///< Destructor por defecto.
+
+    // Deshabilitar copia y asignación
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    /**
+     * @brief Copia en la que escribe el productor.
+     */
+    T& getWriteBuffer() { return m_buffers[m_writeIndex]; }
+
+    /**
+     * @brief Publica la copia escrita y toma la que estaba en espera para el siguiente fotograma.
+     * @return `true` si la publicación anterior no llegó a leerse y se descartó.
+     */
+    bool
+    publish() {
+        uint8_t previous = m_shared.exchange(static_cast<uint8_t>(m_writeIndex | FRESH_BIT),
+                                             std::memory_order_acq_rel);
+        m_writeIndex = previous & INDEX_MASK;
+        return (previous & FRESH_BIT) != 0;
+    }
+
+    /**
+     * @brief Toma la publicación más reciente, si hay una nueva.
+     * @return `true` si la copia de lectura cambió.
+     */
+    bool
+    acquire() {
+        if ((m_shared.load(std::memory_order_relaxed) & FRESH_BIT) == 0) {
+            return false;
+        }
+        uint8_t previous = m_shared.exchange(m_readIndex, std::memory_order_acq_rel);
+        m_readIndex = previous & INDEX_MASK;
+        return true;
+    }
+
+    /**
+     * @brief Copia que lee el consumidor (válida hasta el siguiente `acquire`).
+     */
+    T& getReadBuffer() { return m_buffers[m_readIndex]; }
+    const T& getReadBuffer() const { return m_buffers[m_readIndex]; }
+
+    /**
+     * @brief Acceso directo a las tres copias, para prepararlas antes de arrancar los hilos.
+     */
+    T& getBuffer(int index) { return m_buffers[index]; }
+
+private:
+    static constexpr uint8_t INDEX_MASK = 0x3; ///< Bits del índice de la copia en espera.
+    static constexpr uint8_t FRESH_BIT = 0x4;  ///< La copia en espera aún no se ha leído.
+
+    T m_buffers[3];                   ///< Copias de escritura, espera y lectura.
+    std::atomic<uint8_t> m_shared{ 1 }; ///< Índice de la copia en espera más el bit de nueva.
+    uint8_t m_writeIndex = 0;         ///< Solo lo toca el productor.
+    uint8_t m_readIndex = 2;          ///< Solo lo toca el consumidor.
+};
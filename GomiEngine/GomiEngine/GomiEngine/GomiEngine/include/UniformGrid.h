@@ -0,0 +1,105 @@
+#pragma once
+#include "Prerequisites.h"
+
+/**
+ * @class UniformGrid
+ * @brief Broadphase de rejilla uniforme que recalcula los pares en cada consulta.
+ *
+ * Cada proxy se registra en todas las celdas que toca su caja. `findPairs` ordena las entradas
+ * (celda, proxy) por celda y prueba los proxies de cada celda entre sí; un par que comparte
+ * varias celdas solo se reporta en la celda que contiene la esquina mínima de su intersección,
+ * así que no hace falta una caché para quitar duplicados. Mover un proxy solo guarda su caja.
+ * Funciona bien cuando las cajas son de tamaño parecido a la celda.
+ */
+class UniformGrid {
+public:
+    /// Identificador inválido de proxy.
+    static constexpr unsigned int INVALID_PROXY = 0xFFFFFFFFu;
+
+    /**
+     * @struct ProxyPair
+     * @brief Par de proxies traslapados (el identificador menor primero).
+     */
+    struct ProxyPair {
+        unsigned int proxyA;
+        unsigned int proxyB;
+    };
+
+    /**
+     * @brief Crea una rejilla vacía.
+     * @param cellSize Lado de cada celda en unidades de mundo.
+     */
+    explicit UniformGrid(float cellSize = 32.0f) : m_cellSize(cellSize) {}
+    ~UniformGrid() = default; ///< Destructor por defecto.
+
+    /**
+     * @brief Registra una caja envolvente en la rejilla.
+     * @param bounds Caja envolvente en coordenadas de mundo.
+     * @param userData Dato opaco asociado al proxy (por ejemplo, el actor).
+     * @return Identificador del proxy creado.
+     */
+    unsigned int createProxy(const sf::FloatRect& bounds, void* userData);
+
+    /**
+     * @brief Elimina un proxy y libera su identificador.
+     */
+    void destroyProxy(unsigned int proxyId);
+
+    /**
+     * @brief Actualiza la caja envolvente de un proxy (se usa en el siguiente `findPairs`).
+     */
+    void moveProxy(unsigned int proxyId, const sf::FloatRect& bounds);
+
+    /**
+     * @brief Calcula todos los pares traslapados (cajas que solo se tocan no cuentan).
+     * @param pairs Se vacía y se llena con los pares, sin duplicados.
+     */
+    void findPairs(std::vector<ProxyPair>& pairs);
+
+    /**
+     * @brief Obtiene el dato de usuario asociado a un proxy.
+     */
+    void* getUserData(unsigned int proxyId) const;
+
+    /**
+     * @brief Cantidad de proxies activos.
+     */
+    size_t getProxyCount() const { return m_proxyCount; }
+
+    /**
+     * @brief Entradas (celda, proxy) de la última consulta.
+     */
+    size_t getCellEntryCount() const { return m_entries.size(); }
+
+private:
+    /**
+     * @struct Proxy
+     * @brief Estado interno de una caja registrada.
+     */
+    struct Proxy {
+        sf::FloatRect bounds;
+        void* userData = nullptr;
+        unsigned int nextFree = INVALID_PROXY;
+        bool active = false;
+    };
+
+    /**
+     * @struct CellEntry
+     * @brief Proxy registrado en una celda; la clave empaca las coordenadas de la celda.
+     */
+    struct CellEntry {
+        unsigned long long cell;
+        unsigned int proxyId;
+    };
+
+    int cellCoordinate(float value) const;
+    static unsigned long long cellKey(int x, int y) {
+        return (static_cast<unsigned long long>(static_cast<unsigned int>(x)) << 32) | static_cast<unsigned int>(y);
+    }
+
+    float m_cellSize;                       ///< Lado de cada celda.
+    std::vector<Proxy> m_proxies;           ///< Proxies indexados por identificador.
+    unsigned int m_freeList = INVALID_PROXY; ///< Primer identificador libre para reutilizar.
+    size_t m_proxyCount = 0;                ///< Proxies activos.
+    std::vector<CellEntry> m_entries;       ///< Entradas de la última consulta (se reutiliza).
+};
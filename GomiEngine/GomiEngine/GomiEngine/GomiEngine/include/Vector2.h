@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "MathEngine.h"
+#include <cmath>
 
 class Vector2 {
 public:
@@ -68,7 +69,7 @@ public:
      * La magnitud se calcula como la raíz cuadrada de la suma de los cuadrados de sus componentes.
      */
     float magnitude() const {
-        return MathEngine::sqrt(x * x + y * y);
+        return std::sqrt(x * x + y * y);
     }
 
     /**
@@ -1,5 +1,6 @@
 #pragma once
 #include "MathEngine.h"
+#include <cmath>
 
 class Vector3 {
 public:
@@ -47,7 +48,7 @@ public:
      * La magnitud se calcula como la raz cuadrada de la suma de los cuadrados de sus componentes.
      */
     float magnitude() const {
-        return MathEngine::sqrt(x * x + y * y + z * z);
+        return std::sqrt(x * x + y * y + z * z);
     }
 
     /**
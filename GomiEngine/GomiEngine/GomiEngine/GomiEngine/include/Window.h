@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Prerequisites.h"
+#include "RenderViewport.h"
 
 class Window {
 public:
@@ -27,6 +28,13 @@ public:
      */
     void draw(const sf::Drawable& drawable);
 
+    /**
+     * @brief Dibuja un objeto con estados de render explícitos (textura, mezcla, transformación).
+     * @param drawable Referencia a un objeto SFML que puede ser dibujado.
+     * @param states Estados de render a aplicar.
+     */
+    void draw(const sf::Drawable& drawable, const sf::RenderStates& states);
+
     /**
      * @brief Obtiene el objeto interno SFML RenderWindow.
      * @return Un puntero al objeto interno SFML RenderWindow.
@@ -51,92 +59,48 @@ public:
     // Muestra el contenido de la ventana en ImGui.
     void showInImGui();
 
+    /**
+     * @brief Muestra una textura ya dibujada (p. ej. por el hilo de render) como la escena en ImGui.
+     * @param texture Textura de la escena.
+     */
+    void showInImGui(const sf::Texture& texture);
+
     // Ajusta la vista de la ventana.
     void setView(const sf::View& view);
 
     // Devuelve el tiempo transcurrido entre frames.
     sf::Time getDeltaTime() const;
 
+    /**
+     * @brief Pool de texturas de render compartido por todas las vistas de la ventana.
+     */
+    RenderTargetPool& getTargetPool() { return m_targetPool; }
+
+    /**
+     * @brief Vista donde se dibuja la escena.
+     */
+    RenderViewport& getSceneViewport() { return m_sceneViewport; }
+
+    // Eventos de cambio de tamaño recibidos y cambios aplicados (uno por fotograma como máximo).
+    size_t getResizeEventCount() const { return m_resizeEventCount; }
+    size_t getAppliedResizeCount() const { return m_appliedResizeCount; }
+
+    // Eventos de la ventana recibidos en total (teclado, ratón, foco, tamaño...).
+    size_t getEventCount() const { return m_eventCount; }
+
 private:
-    sf::RenderWindow* m_window; // Puntero al objeto `RenderWindow` de SFML.
+    sf::RenderWindow* m_window = nullptr; // Puntero al objeto `RenderWindow` de SFML.
     sf::View m_view; // Vista de la ventana para manejar la perspectiva de visualización.
 
+    RenderTargetPool m_targetPool; // Texturas de render reutilizadas por clase de tamaño.
+    RenderViewport m_sceneViewport{ m_targetPool, "Scene" }; // Vista de la escena en ImGui.
+    sf::Vector2u m_pendingSize; // Último tamaño recibido en el fotograma.
+    bool m_resizePending = false; // Hay un cambio de tamaño por aplicar.
+    size_t m_resizeEventCount = 0; // Eventos de cambio de tamaño recibidos.
+    size_t m_appliedResizeCount = 0; // Cambios de tamaño aplicados.
+    size_t m_eventCount = 0; // Eventos recibidos.
+
 public:
-    sf::RenderTexture m_renderTexture; // Textura para renderizar el contenido.
     sf::Time deltaTime; // Tiempo transcurrido entre frames.
     sf::Clock clock; // Reloj para calcular el tiempo transcurrido entre frames.
 };
-
-// Constructor parametrizado
-Window::Window(int width, int height, const std::string& title) {
-    init(width, height, title);
-}
-
-// Destructor
-Window::~Window() {
-    destroy();
-}
-
-void Window::init(int width, int height, const std::string& title) {
-    m_window = new sf::RenderWindow(sf::VideoMode(width, height), title);
-}
-
-void Window::handleEvents() {
-    sf::Event event;
-    while (m_window->pollEvent(event)) {
-        if (event.type == sf::Event::Closed) {
-            m_window->close();
-        }
-    }
-}
-
-void Window::clear() {
-    m_window->clear();
-}
-
-void Window::display() {
-    m_window->display();
-}
-
-bool Window::isOpen() const {
-    return m_window->isOpen();
-}
-
-void Window::draw(const sf::Drawable& drawable) {
-    m_window->draw(drawable);
-}
-
-sf::RenderWindow* Window::getWindow() {
-    return m_window;
-}
-
-void Window::update() {
-    deltaTime = clock.restart();
-}
-
-void Window::render() {
-    // Aquí puedes hacer el renderizado específico que desees.
-}
-
-void Window::destroy() {
-    if (m_window) {
-        delete m_window;
-        m_window = nullptr;
-    }
-}
-
-void Window::renderToTexture() {
-    // Implementar renderizado a textura
-}
-
-void Window::showInImGui() {
-    // Implementar muestra en ImGui
-}
-
-void Window::setView(const sf::View& view) {
-    m_window->setView(view);
-}
-
-sf::Time Window::getDeltaTime() const {
-    return deltaTime;
-}
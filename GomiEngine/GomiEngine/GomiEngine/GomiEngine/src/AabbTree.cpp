@@ -0,0 +1,217 @@
+#include "AabbTree.h"
+#include <algorithm>
+
+// Registra una caja nueva y la inserta agrandada como hoja.
+unsigned int
+AabbTree::createProxy(const sf::FloatRect& bounds, void* userData) {
+    unsigned int proxyId;
+    if (m_freeList != INVALID_PROXY) {
+        proxyId = m_freeList;
+        m_freeList = m_proxies[proxyId].nextFree;
+    }
+    else {
+        proxyId = static_cast<unsigned int>(m_proxies.size());
+        m_proxies.emplace_back();
+    }
+
+    unsigned int leaf = allocateNode();
+    m_nodes[leaf].box = fatten(toBox(bounds));
+    m_nodes[leaf].proxyId = proxyId;
+    insertLeaf(leaf);
+
+    Proxy& proxy = m_proxies[proxyId];
+    proxy.bounds = toBox(bounds);
+    proxy.leaf = leaf;
+    proxy.userData = userData;
+    proxy.nextFree = INVALID_PROXY;
+    proxy.active = true;
+    ++m_proxyCount;
+    return proxyId;
+}
+
+// Quita la hoja del árbol y libera el identificador.
+void
+AabbTree::destroyProxy(unsigned int proxyId) {
+    if (proxyId >= m_proxies.size() || !m_proxies[proxyId].active) {
+        return;
+    }
+    Proxy& proxy = m_proxies[proxyId];
+    removeLeaf(proxy.leaf);
+    freeNode(proxy.leaf);
+
+    proxy.leaf = INVALID_PROXY;
+    proxy.active = false;
+    proxy.userData = nullptr;
+    proxy.nextFree = m_freeList;
+    m_freeList = proxyId;
+    --m_proxyCount;
+}
+
+// Mientras la caja quepa en la agrandada, el árbol no cambia.
+void
+AabbTree::moveProxy(unsigned int proxyId, const sf::FloatRect& bounds) {
+    if (proxyId >= m_proxies.size() || !m_proxies[proxyId].active) {
+        return;
+    }
+    Proxy& proxy = m_proxies[proxyId];
+    proxy.bounds = toBox(bounds);
+    if (contains(m_nodes[proxy.leaf].box, proxy.bounds)) {
+        return;
+    }
+
+    removeLeaf(proxy.leaf);
+    m_nodes[proxy.leaf].box = fatten(proxy.bounds);
+    insertLeaf(proxy.leaf);
+    ++m_reinsertCount;
+}
+
+// Cada proxy consulta el árbol con su caja exacta; solo se reporta el par desde el menor.
+void
+AabbTree::findPairs(std::vector<ProxyPair>& pairs) {
+    pairs.clear();
+    if (m_root == INVALID_PROXY) {
+        return;
+    }
+
+    for (unsigned int proxyId = 0; proxyId < m_proxies.size(); ++proxyId) {
+        const Proxy& proxy = m_proxies[proxyId];
+        if (!proxy.active) {
+            continue;
+        }
+        m_stack.clear();
+        m_stack.push_back(m_root);
+        while (!m_stack.empty()) {
+            const Node& node = m_nodes[m_stack.back()];
+            m_stack.pop_back();
+            if (!overlaps(node.box, proxy.bounds)) {
+                continue;
+            }
+            if (node.isLeaf()) {
+                if (node.proxyId > proxyId && overlaps(m_proxies[node.proxyId].bounds, proxy.bounds)) {
+                    pairs.push_back({ proxyId, node.proxyId });
+                }
+            }
+            else {
+                m_stack.push_back(node.children[0]);
+                m_stack.push_back(node.children[1]);
+            }
+        }
+    }
+}
+
+// Devuelve el dato de usuario del proxy o nullptr si no existe.
+void*
+AabbTree::getUserData(unsigned int proxyId) const {
+    if (proxyId >= m_proxies.size()) {
+        return nullptr;
+    }
+    return m_proxies[proxyId].userData;
+}
+
+unsigned int
+AabbTree::allocateNode() {
+    unsigned int node;
+    if (m_freeNode != INVALID_PROXY) {
+        node = m_freeNode;
+        m_freeNode = m_nodes[node].parent;
+    }
+    else {
+        node = static_cast<unsigned int>(m_nodes.size());
+        m_nodes.emplace_back();
+    }
+    m_nodes[node] = Node();
+    return node;
+}
+
+void
+AabbTree::freeNode(unsigned int node) {
+    m_nodes[node].parent = m_freeNode;
+    m_freeNode = node;
+}
+
+// Baja por el hijo cuyo perímetro crece menos, cuelga la hoja junto al nodo elegido y
+// reajusta las cajas de los ancestros.
+void
+AabbTree::insertLeaf(unsigned int leaf) {
+    if (m_root == INVALID_PROXY) {
+        m_root = leaf;
+        m_nodes[leaf].parent = INVALID_PROXY;
+        return;
+    }
+
+    Box leafBox = m_nodes[leaf].box;
+    unsigned int sibling = m_root;
+    while (!m_nodes[sibling].isLeaf()) {
+        const Node& node = m_nodes[sibling];
+        float combined = perimeter(merge(node.box, leafBox));
+        // Colgar la hoja aquí crea un padre nuevo; bajar reparte el crecimiento entre los ancestros.
+        float costHere = 2.0f * combined;
+        float inheritance = 2.0f * (combined - perimeter(node.box));
+
+        float childCost[2];
+        for (int i = 0; i < 2; ++i) {
+            const Node& child = m_nodes[node.children[i]];
+            float merged = perimeter(merge(child.box, leafBox));
+            childCost[i] = (child.isLeaf() ? merged : merged - perimeter(child.box)) + inheritance;
+        }
+        if (costHere < childCost[0] && costHere < childCost[1]) {
+            break;
+        }
+        sibling = node.children[childCost[0] <= childCost[1] ? 0 : 1];
+    }
+
+    unsigned int oldParent = m_nodes[sibling].parent;
+    unsigned int newParent = allocateNode();
+    m_nodes[newParent].parent = oldParent;
+    m_nodes[newParent].box = merge(leafBox, m_nodes[sibling].box);
+    m_nodes[newParent].children[0] = sibling;
+    m_nodes[newParent].children[1] = leaf;
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent = newParent;
+
+    if (oldParent == INVALID_PROXY) {
+        m_root = newParent;
+    }
+    else {
+        Node& parent = m_nodes[oldParent];
+        parent.children[parent.children[0] == sibling ? 0 : 1] = newParent;
+    }
+
+    for (unsigned int node = oldParent; node != INVALID_PROXY; node = m_nodes[node].parent) {
+        m_nodes[node].box = merge(m_nodes[m_nodes[node].children[0]].box, m_nodes[m_nodes[node].children[1]].box);
+    }
+}
+
+// El hermano de la hoja ocupa el lugar de su padre, que se libera.
+void
+AabbTree::removeLeaf(unsigned int leaf) {
+    if (leaf == m_root) {
+        m_root = INVALID_PROXY;
+        return;
+    }
+
+    unsigned int parent = m_nodes[leaf].parent;
+    unsigned int grandParent = m_nodes[parent].parent;
+    unsigned int sibling = m_nodes[parent].children[m_nodes[parent].children[0] == leaf ? 1 : 0];
+
+    if (grandParent == INVALID_PROXY) {
+        m_root = sibling;
+        m_nodes[sibling].parent = INVALID_PROXY;
+    }
+    else {
+        Node& node = m_nodes[grandParent];
+        node.children[node.children[0] == parent ? 0 : 1] = sibling;
+        m_nodes[sibling].parent = grandParent;
+        for (unsigned int ancestor = grandParent; ancestor != INVALID_PROXY; ancestor = m_nodes[ancestor].parent) {
+            m_nodes[ancestor].box = merge(m_nodes[m_nodes[ancestor].children[0]].box,
+                                          m_nodes[m_nodes[ancestor].children[1]].box);
+        }
+    }
+    freeNode(parent);
+    m_nodes[leaf].parent = INVALID_PROXY;
+}
+
+AabbTree::Box
+AabbTree::fatten(const Box& box) const {
+    return { box.minX - m_margin, box.minY - m_margin, box.maxX + m_margin, box.maxY + m_margin };
+}
@@ -1,8 +1,8 @@
 #include "Actor.h"
 
-Actor::Actor(std::string actorName) {
+Actor::Actor(const std::string& actorName) {
     // Setup Actor Name 
-    m_name = actorName;
+    m_actorName = actorName;
 
     // Setup Shape 
     auto shape = EngineUtilities::MakeShared<ShapeFactory>();
@@ -40,8 +40,8 @@ void Actor::update(float deltaTime) {
  */
 void Actor::render(Window& window) {
     for (const auto& component : components) {
-        if (auto shape = std::dynamic_pointer_cast<ShapeFactory>(component)) {
-            window.draw(*shape->getShape());
+        if (auto shape = component.template dynamic_pointer_cast<ShapeFactory>()) {
+            shape->render(window);
         }
     }
 }
@@ -56,10 +56,10 @@ void Actor::destroy() {
 
 // Obtiene el nombre del actor.
 std::string Actor::getName() const {
-    return m_name;
+    return m_actorName;
 }
 
 // Agrega el nombre del actor.
 void Actor::setName(const std::string& newName) {
-    m_name = newName;
+    m_actorName = newName;
 }
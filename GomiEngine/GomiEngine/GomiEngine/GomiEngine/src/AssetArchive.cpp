@@ -0,0 +1,232 @@
+#include "AssetArchive.h"
+#include "Hash.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace {
+
+/**
+ * @brief Encabezado del paquete tal como está en el archivo.
+ */
+struct ArchiveHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t alignment;
+    uint64_t tocOffset;
+    uint64_t namesOffset;
+};
+
+static_assert(sizeof(ArchiveHeader) == 32, "Unexpected archive header size");
+
+inline char
+normalizeSeparator(char c) {
+    return c == '\\' ? '/' : c;
+}
+
+inline uint64_t
+alignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+// Hash FNV-1a byte por byte, tratando '\' como '/'.
+uint64_t
+AssetArchive::hashName(const char* name, size_t length) {
+    unsigned long long hash = EngineUtilities::FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < length; ++i) {
+        char c = normalizeSeparator(name[i]);
+        hash = EngineUtilities::hashFNV1a(&c, 1, hash);
+    }
+    return hash;
+}
+
+// Proyecta el archivo y revisa que el índice no apunte fuera de él.
+bool
+AssetArchive::open(const std::string& path) {
+    m_entries = nullptr;
+    m_names = nullptr;
+    m_entryCount = 0;
+    m_path.clear();
+    if (!m_file.open(path) || m_file.size() < sizeof(ArchiveHeader)) {
+        m_file.close();
+        return false;
+    }
+
+    ArchiveHeader header;
+    std::memcpy(&header, m_file.data(), sizeof(header));
+    const uint64_t fileSize = m_file.size();
+    if (header.magic != MAGIC || header.version != VERSION || header.tocOffset % alignof(Entry) != 0 ||
+        header.tocOffset + static_cast<uint64_t>(header.entryCount) * sizeof(Entry) > fileSize ||
+        header.namesOffset > fileSize) {
+        m_file.close();
+        return false;
+    }
+
+    const Entry* entries = reinterpret_cast<const Entry*>(m_file.data() + header.tocOffset);
+    for (uint32_t i = 0; i < header.entryCount; ++i) {
+        const Entry& entry = entries[i];
+        if (header.namesOffset + entry.nameOffset + entry.nameLength > fileSize ||
+            entry.dataOffset > fileSize || entry.dataSize > fileSize - entry.dataOffset) {
+            m_file.close();
+            return false;
+        }
+    }
+
+    m_entries = entries;
+    m_names = m_file.data() + header.namesOffset;
+    m_entryCount = header.entryCount;
+    m_path = path;
+    return true;
+}
+
+// Búsqueda binaria por hash; los nombres solo se comparan entre entradas con el mismo hash.
+AssetSpan
+AssetArchive::find(const std::string& name) const {
+    AssetSpan span;
+    if (m_entries == nullptr) {
+        return span;
+    }
+    const uint64_t hash = hashName(name.data(), name.size());
+    const Entry* end = m_entries + m_entryCount;
+    const Entry* it = std::lower_bound(m_entries, end, hash,
+        [](const Entry& entry, uint64_t value) { return entry.nameHash < value; });
+    for (; it != end && it->nameHash == hash; ++it) {
+        if (it->nameLength != name.size()) {
+            continue;
+        }
+        const char* stored = m_names + it->nameOffset;
+        bool equal = true;
+        for (size_t i = 0; i < name.size() && equal; ++i) {
+            equal = stored[i] == normalizeSeparator(name[i]);
+        }
+        if (equal) {
+            span.data = m_file.data() + it->dataOffset;
+            span.size = static_cast<size_t>(it->dataSize);
+            return span;
+        }
+    }
+    return span;
+}
+
+// Ordena las entradas, calcula la disposición y copia cada archivo en su lugar alineado.
+bool
+AssetArchive::build(const std::string& outputPath,
+                    const std::vector<std::pair<std::string, std::string>>& files,
+                    std::string& error) {
+    struct PendingEntry {
+        std::string name;
+        std::string path;
+        Entry entry;
+    };
+
+    std::vector<PendingEntry> pending;
+    pending.reserve(files.size());
+    for (const auto& file : files) {
+        PendingEntry item;
+        item.name = file.first;
+        std::replace(item.name.begin(), item.name.end(), '\\', '/');
+        item.path = file.second;
+        std::error_code fileError;
+        item.entry.dataSize = std::filesystem::file_size(item.path, fileError);
+        if (fileError) {
+            error = "Archive: cannot read " + item.path;
+            return false;
+        }
+        item.entry.nameHash = hashName(item.name.data(), item.name.size());
+        pending.push_back(std::move(item));
+    }
+
+    std::sort(pending.begin(), pending.end(), [](const PendingEntry& a, const PendingEntry& b) {
+        return a.entry.nameHash != b.entry.nameHash ? a.entry.nameHash < b.entry.nameHash : a.name < b.name;
+    });
+    for (size_t i = 1; i < pending.size(); ++i) {
+        if (pending[i].name == pending[i - 1].name) {
+            error = "Archive: duplicate entry " + pending[i].name;
+            return false;
+        }
+    }
+
+    // Disposición: encabezado, índice, nombres y datos alineados.
+    ArchiveHeader header = {};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.entryCount = static_cast<uint32_t>(pending.size());
+    header.alignment = DATA_ALIGNMENT;
+    header.tocOffset = sizeof(ArchiveHeader);
+    header.namesOffset = header.tocOffset + pending.size() * sizeof(Entry);
+
+    std::string names;
+    for (PendingEntry& item : pending) {
+        item.entry.nameOffset = static_cast<uint32_t>(names.size());
+        item.entry.nameLength = static_cast<uint32_t>(item.name.size());
+        names += item.name;
+    }
+    uint64_t offset = alignUp(header.namesOffset + names.size(), DATA_ALIGNMENT);
+    for (PendingEntry& item : pending) {
+        item.entry.dataOffset = offset;
+        offset = alignUp(offset + item.entry.dataSize, DATA_ALIGNMENT);
+    }
+
+    std::ofstream output(outputPath, std::ios::binary | std::ios::trunc);
+    if (!output) {
+        error = "Archive: cannot create " + outputPath;
+        return false;
+    }
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const PendingEntry& item : pending) {
+        output.write(reinterpret_cast<const char*>(&item.entry), sizeof(Entry));
+    }
+    output.write(names.data(), static_cast<std::streamsize>(names.size()));
+
+    const char padding[DATA_ALIGNMENT] = {};
+    std::vector<char> buffer;
+    for (const PendingEntry& item : pending) {
+        uint64_t position = static_cast<uint64_t>(output.tellp());
+        output.write(padding, static_cast<std::streamsize>(item.entry.dataOffset - position));
+
+        std::ifstream input(item.path, std::ios::binary);
+        buffer.resize(static_cast<size_t>(item.entry.dataSize));
+        if (!input.read(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+            error = "Archive: cannot read " + item.path;
+            return false;
+        }
+        output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+    uint64_t position = static_cast<uint64_t>(output.tellp());
+    output.write(padding, static_cast<std::streamsize>(alignUp(position, DATA_ALIGNMENT) - position));
+
+    if (!output) {
+        error = "Archive: write failed for " + outputPath;
+        return false;
+    }
+    return true;
+}
+
+// Recorre el directorio y nombra cada archivo por su ruta relativa con '/'.
+bool
+AssetArchive::buildFromDirectory(const std::string& outputPath, const std::string& directory,
+                                 std::string& error) {
+    std::error_code walkError;
+    std::filesystem::path output = std::filesystem::absolute(outputPath, walkError);
+    std::vector<std::pair<std::string, std::string>> files;
+    for (std::filesystem::recursive_directory_iterator it(directory, walkError), end; it != end && !walkError;
+         it.increment(walkError)) {
+        if (!it->is_regular_file()) {
+            continue;
+        }
+        if (std::filesystem::absolute(it->path(), walkError) == output) {
+            continue;
+        }
+        std::string name = std::filesystem::relative(it->path(), directory, walkError).generic_string();
+        files.emplace_back(name, it->path().string());
+    }
+    if (walkError) {
+        error = "Archive: cannot scan " + directory;
+        return false;
+    }
+    return build(outputPath, files, error);
+}
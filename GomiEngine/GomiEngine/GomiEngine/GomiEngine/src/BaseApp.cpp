@@ -1,9 +1,16 @@
 ﻿#include "BaseApp.h"
+#include <algorithm>
 #include <cmath>
+#include <cstdio>
 
 BaseApp::~BaseApp()
 {
-    NotificationService::getInstance().saveMessagesToFile("LogData.txt");
+    if (m_logSink.isRunning()) {
+        m_logSink.stop();
+    }
+    else {
+        NotificationService::getInstance().saveMessagesToFile(LOG_FILE);
+    }
 }
 
 /**
@@ -12,24 +19,77 @@ BaseApp::~BaseApp()
 int BaseApp::run() {
     NotificationService& notifier = NotificationService::getInstance();
 
+    // El registro se escribe mientras corre; si no se puede, se guarda al salir.
+    const char* logFile = m_binaryLog ? BINARY_LOG_FILE : LOG_FILE;
+    if (!m_logSink.start(logFile, LOG_FILE_MAX_BYTES, LOG_FILE_COUNT,
+                         m_binaryLog ? LogFileFormat::BINARY : LogFileFormat::TEXT)) {
+        notifier.addMessage(ConsolErrorType::WARNING, std::string("Could not open ") + logFile + ", the log is saved on exit");
+    }
+
     if (!initialize()) {
         notifier.addMessage(ConsolErrorType::ERROR, "Initialization failed, check method validations");
-        notifier.saveMessagesToFile("LogData.txt");
+        if (m_logSink.isRunning()) {
+            m_logSink.flush();
+        }
+        else {
+            notifier.saveMessagesToFile(LOG_FILE);
+        }
         ERROR("BaseApp", "run", "Initialization failed");
     }
     else {
         notifier.addMessage(ConsolErrorType::NORMAL, "All components initialized successfully");
     }
 
-    m_GUI.init();
+    m_GUI.initialize();
+
+    if (m_threadedRendering) {
+        sf::Vector2u size = m_window->getWindow()->getSize();
+        if (!m_renderThread.start(size.x, size.y)) {
+            notifier.addMessage(ConsolErrorType::WARNING, "Render thread unavailable, rendering on the main thread");
+            m_threadedRendering = false;
+        }
+    }
+
+    if (m_hotReload) {
+        if (m_threadedRendering) {
+            notifier.addMessage(ConsolErrorType::WARNING, "Texture hot reload is unavailable with the render thread");
+        }
+        else if (ResourceManager::getInstance().enableHotReload({ "." })) {
+            notifier.addMessage(ConsolErrorType::NORMAL, "Watching textures for changes");
+        }
+        else {
+            notifier.addMessage(ConsolErrorType::WARNING, "Could not watch the working directory for texture changes");
+        }
+    }
 
+    sf::Clock frameClock;
     while (m_window->isOpen()) {
         m_window->handleEvents();
         deltaTime = clock.restart();
+
+        sf::Clock stageClock;
         update();
+        m_simulationMs = stageClock.getElapsedTime().asSeconds() * 1000.0f;
+
+        // Sin cambios: se cierra el fotograma de ImGui sin dibujarlo y se cede el núcleo.
+        if (m_onDemandRendering && !needsRedraw()) {
+            ImGui::EndFrame();
+            ++m_skippedFrameCount;
+            sf::sleep(sf::milliseconds(8));
+            continue;
+        }
+
         render();
+        ++m_renderedFrameCount;
+        if (m_renderedFrameCount == 1) {
+            m_startupTimeline.markFirstFrame();
+            m_startupTimeline.log();
+        }
+        m_idleClock.restart();
+        m_frameMs = frameClock.restart().asSeconds() * 1000.0f;
     }
 
+    m_renderThread.stop();
     cleanup();
     return 0;
 }
@@ -38,11 +98,49 @@ bool BaseApp::initialize() {
     NotificationService& notifier = NotificationService::getInstance();
     ResourceManager& resourceManager = ResourceManager::getInstance();
 
+    // Con un paquete de recursos, las texturas se decodifican desde él en lugar de archivos sueltos.
+    size_t phase = m_startupTimeline.begin("Mount archives");
+    if (resourceManager.mountArchive("Assets.gpak")) {
+        notifier.addMessage(ConsolErrorType::NORMAL, "Mounted Assets.gpak");
+    }
+    m_startupTimeline.end(phase);
+
+    // Los recursos de la escena se leen y decodifican en paralelo mientras se crean la ventana y
+    // los actores; antes del primer fotograma se espera lo que falte.
+    size_t preloadPhase = m_startupTimeline.begin("Preload (background)");
+    phase = m_startupTimeline.begin("Preload requests");
+    PreloadManifest manifest;
+    if (!manifest.loadFromFile(PRELOAD_MANIFEST) || !manifest.hasScene(PRELOAD_SCENE)) {
+        manifest.addEntry(PRELOAD_SCENE, { PreloadType::TEXTURE, "Circuit", "png", {} });
+        manifest.addEntry(PRELOAD_SCENE, { PreloadType::ATLAS, "CharactersAtlas", "png", { "Characters/tile000" } });
+    }
+    m_preloadedTextures = resourceManager.preload(manifest.getScene(PRELOAD_SCENE));
+    m_startupTimeline.end(phase);
+
+    phase = m_startupTimeline.begin("Create window");
     m_window = std::make_unique<Window>(1920, 1080, "Patas Engine");
     if (!m_window) {
         notifier.addMessage(ConsolErrorType::ERROR, "Error creating window");
         return false;
     }
+    m_startupTimeline.end(phase);
+
+    // Vista previa que sigue al jugador; su textura sale del mismo pool que la escena.
+    m_previewViewport = std::make_unique<RenderViewport>(m_window->getTargetPool(), "Player Preview");
+    m_previewViewport->resize(sf::Vector2u(320, 180));
+
+    // Escena 3D en CPU: se dibuja en memoria y se sube a una textura cada fotograma.
+    if (m_show3DView) {
+        m_renderer3D = std::make_unique<SoftwareRenderer3D>(480, 270);
+        SoftwareRenderer3D::appendCube(m_cubeMesh, 1.0f);
+        m_view3DPixels.resize(480 * 270 * 4);
+        if (!m_view3DTexture.create(480, 270)) {
+            notifier.addMessage(ConsolErrorType::WARNING, "Could not create the 3D view texture");
+            m_renderer3D.reset();
+        }
+    }
+
+    phase = m_startupTimeline.begin("Build actors");
 
     // Setup waypoints for actors (example: Circle)
     points[0] = Vector2(720.0f, 350.0f);
@@ -60,15 +158,18 @@ bool BaseApp::initialize() {
     if (!Track.isNull()) {
         Track->getComponent<ShapeFactory>()->createShape(ShapeType::RECTANGLE);
         Track->getComponent<Transform>()->setTransform(Vector2(0.0f, 0.0f), Vector2(0.0f, 0.0f), Vector2(11.0f, 12.0f));
-        if (!resourceManager.loadTexture("Circuit", "png")) {
-            notifier.addMessage(ConsolErrorType::ERROR, "Failed to load texture: Circuit");
-        }
-
-        auto trackTexture = resourceManager.getTexture("Circuit");
-        if (trackTexture) {
-            Track->getComponent<ShapeFactory>()->getShape()->setTexture(&trackTexture->getTexture());
+        // La pista se decodifica en segundo plano; mientras tanto muestra la textura por defecto.
+        // El handle se guarda para que la caché no expulse la textura mientras la pista la usa.
+        m_trackTexture = resourceManager.loadTextureAsync("Circuit", "png",
+            [this](Texture& texture) {
+                Track->getComponent<ShapeFactory>()->setTexture(&texture.getTexture(), true);
+            });
+        if (!m_trackTexture.isReady() && m_trackTexture.get()) {
+            Track->getComponent<ShapeFactory>()->setTexture(&m_trackTexture.get()->getTexture());
         }
 
+        // La pista no se mueve: se hornea una vez en la capa estática.
+        Track->setStatic(true);
         m_actors.push_back(Track);
     }
 
@@ -77,15 +178,19 @@ bool BaseApp::initialize() {
     if (!Circle.isNull()) {
         Circle->getComponent<ShapeFactory>()->createShape(ShapeType::CIRCLE);
         Circle->getComponent<Transform>()->setTransform(Vector2(200.0f, 200.0f), Vector2(0.0f, 0.0f), Vector2(1.0f, 1.0f));
-        if (!resourceManager.loadTexture("Characters/tile000", "png")) {
-            notifier.addMessage(ConsolErrorType::ERROR, "Failed to load texture: Mario");
+        // Los cuadros del personaje se empaquetan en un atlas (caché en disco entre ejecuciones).
+        if (!resourceManager.loadAtlas("CharactersAtlas", { "Characters/tile000" })) {
+            notifier.addMessage(ConsolErrorType::ERROR, "Failed to load atlas: CharactersAtlas");
         }
 
-        auto trackTexture = resourceManager.getTexture("Characters/tile000");
-        if (trackTexture) {
-            Circle->getComponent<ShapeFactory>()->getShape()->setTexture(&trackTexture->getTexture());
+        m_playerSprite = resourceManager.getSprite("Characters/tile000");
+        if (m_playerSprite.texture) {
+            Circle->getComponent<ShapeFactory>()->setTexture(&m_playerSprite.texture->getTexture());
+            Circle->getComponent<ShapeFactory>()->setTextureRect(m_playerSprite.rect);
         }
 
+        // El jugador se dibuja sobre el resto de los actores.
+        Circle->setRenderLayer(1);
         m_actors.push_back(Circle);
     }
 
@@ -100,37 +205,157 @@ bool BaseApp::initialize() {
 
     m_actors.push_back(Triangle);
 
+    // Checkpoints del circuito: volúmenes de disparo en cada punto de la trayectoria.
+    for (int i = 0; i < 9; ++i) {
+        auto checkpoint = EngineUtilities::MakeShared<Actor>("Checkpoint " + std::to_string(i));
+        if (checkpoint.isNull()) {
+            continue;
+        }
+        checkpoint->getComponent<Transform>()->setPosition(points[i]);
+
+        auto trigger = EngineUtilities::MakeShared<TriggerVolume>(Vector2(20.0f, 20.0f));
+        trigger->setOnEnter([this, i](const TriggerEvent& event) {
+            onCheckpointEntered(i, event);
+        });
+        checkpoint->addComponent(trigger);
+
+        m_triggerSystem.addTrigger(checkpoint);
+        m_checkpoints.push_back(checkpoint);
+    }
+    m_triggerSystem.addBody(Circle);
+
+    // Actores de prueba para medir una escena con mucha carga de CPU.
+    for (int i = 0; i < m_stressActorCount; ++i) {
+        auto actor = EngineUtilities::MakeShared<Actor>("Stress " + std::to_string(i));
+        if (actor.isNull()) {
+            continue;
+        }
+        actor->getComponent<ShapeFactory>()->createShape(i % 2 == 0 ? ShapeType::CIRCLE : ShapeType::TRIANGLE);
+        actor->getComponent<Transform>()->setTransform(Vector2(static_cast<float>(i * 37 % 1280), static_cast<float>(i * 53 % 720)),
+                                                     Vector2(0.0f, 0.0f), Vector2(0.2f, 0.2f));
+        m_stressActors.push_back(actor);
+    }
+    m_startupTimeline.end(phase);
+
+    phase = m_startupTimeline.begin("Wait for preload");
+    resourceManager.finishPendingLoads();
+    m_startupTimeline.end(phase);
+    m_startupTimeline.end(preloadPhase);
+
     return true;
 }
 
 void BaseApp::update() {
     m_window->update();
 
+    // Sube las texturas que terminaron de decodificarse sin pasarse del presupuesto; con el hilo
+    // de render se espera a que estén completas antes de que una instantánea las referencie.
+    if (ResourceManager::getInstance().processUploads(TEXTURE_UPLOAD_BUDGET_MS) > 0 && m_threadedRendering) {
+        m_renderThread.finishUploads();
+    }
+
+    // Pasa al historial los mensajes que escribieron todos los hilos desde el fotograma anterior.
+    NotificationService::getInstance().pump();
+
     for (auto& actor : m_actors) {
-        if (actor && actor->isNull()) continue;
+        if (actor.isNull()) continue;
         actor->update(m_window->deltaTime.asSeconds());
         if (actor->getName() == "Player") {
             updateMovement(m_window->deltaTime.asSeconds(), actor);
         }
     }
+
+    for (size_t i = 0; i < m_stressActors.size(); ++i) {
+        auto& actor = m_stressActors[i];
+        actor->getComponent<Transform>()->Seek(points[(i + m_currentPoint) % 9], 100.0f, m_window->deltaTime.asSeconds(), 10.0f);
+        actor->update(m_window->deltaTime.asSeconds());
+    }
+
+    // Los eventos de los checkpoints se generan y despachan en un solo lote por fotograma.
+    m_triggerSystem.update();
+    m_triggerSystem.dispatchEvents();
 }
 
 void BaseApp::render() {
     NotificationService& notifier = NotificationService::getInstance();
+    updateLevelOfDetail();
+
+    // Modo con hilo de render: aquí solo se publica la instantánea y se muestra el último fotograma.
+    if (m_threadedRendering) {
+        submitSnapshot();
+        m_sceneRenderMs = m_renderThread.getRenderMs();
+        m_sceneDrawCalls = m_renderThread.getDrawCallCount();
+        m_previewDrawCalls = 0;
+        m_unbatchedDrawCalls = m_renderThread.getItemCount();
+
+        m_window->clear();
+        const sf::Texture* frame = m_renderThread.acquireFrame();
+        if (frame != nullptr) {
+            m_window->showInImGui(*frame);
+        }
+        m_logConsole.draw(notifier.getHistory());
+        m_GUI.showInspector();
+        m_GUI.showHierarchy(m_actors);
+        render3DView();
+        showFrameTimings();
+
+        m_window->render();
+        m_window->display();
+        return;
+    }
+
+    sf::Clock sceneClock;
     m_window->clear();
 
-    for (auto& actor : m_actors) {
-        if (actor && !actor->isNull()) {
-            actor->render(*m_window);
+    // Los actores estáticos se dibujan primero desde sus buffers horneados.
+    m_staticLayer.update(m_actors);
+    m_staticLayer.draw(*m_window);
+
+    // Los actores se ordenan por capa y textura; luego las formas con la misma textura
+    // y mezcla se dibujan en una sola llamada.
+    m_renderQueue.begin();
+    for (auto* actors : { &m_actors, &m_stressActors }) {
+        for (auto& actor : *actors) {
+            if (!actor.isNull() && !actor->isStatic()) {
+                auto shape = actor->getComponent<ShapeFactory>();
+                if (!shape.isNull() && shape->getGeometry() != nullptr) {
+                    m_renderQueue.submit(*shape, actor->getRenderLayer());
+                }
+            }
         }
     }
+    m_renderQueue.sort();
+
+    m_batchRenderer.begin();
+    m_renderQueue.flush(m_batchRenderer);
+    m_batchRenderer.flush(*m_window);
+    m_sceneDrawCalls = m_staticLayer.getDrawCallCount() + m_batchRenderer.getDrawCallCount();
+    m_unbatchedDrawCalls = m_staticLayer.getStaticShapeCount() + m_batchRenderer.getSubmittedCount();
+    m_previewDrawCalls = 0;
+
+    // La vista previa reutiliza los mismos lotes con una cámara centrada en el jugador.
+    if (m_previewViewport && m_previewViewport->getTarget() != nullptr && !Circle.isNull()) {
+        Vector2 playerPosition = Circle->getComponent<Transform>()->getPosition();
+        m_previewViewport->setCamera(sf::View(sf::Vector2f(playerPosition.x, playerPosition.y), sf::Vector2f(320.0f, 180.0f)));
+        m_previewViewport->clear();
+        m_staticLayer.draw(*m_previewViewport->getTarget());
+        m_batchRenderer.flush(*m_previewViewport->getTarget());
+        m_previewViewport->display();
+        m_previewDrawCalls = m_staticLayer.getDrawCallCount() + m_batchRenderer.getDrawCallCount() - m_sceneDrawCalls;
+    }
 
     // ImGui rendering
     m_window->renderToTexture();
+    m_sceneRenderMs = sceneClock.getElapsedTime().asSeconds() * 1000.0f;
     m_window->showInImGui();
-    m_GUI.console(notifier.getNotifications());
-    m_GUI.inspector();
-    m_GUI.hierarchy(m_actors);
+    if (m_previewViewport) {
+        m_previewViewport->showInImGui();
+    }
+    m_logConsole.draw(notifier.getHistory());
+    m_GUI.showInspector();
+    m_GUI.showHierarchy(m_actors);
+    render3DView();
+    showFrameTimings();
 
     m_window->render();
     m_window->display();
@@ -147,13 +372,203 @@ void BaseApp::updateMovement(float deltaTime, EngineUtilities::TSharedPointer<Ac
     auto transform = circle->getComponent<Transform>();
     if (transform.isNull()) return;
 
+    // El avance al siguiente punto lo decide el checkpoint (ver onCheckpointEntered).
     Vector2 targetPos = points[m_currentPoint];
     transform->Seek(targetPos, 200.0f, deltaTime, 10.0f);
+}
+
+void BaseApp::onCheckpointEntered(int checkpointIndex, const TriggerEvent& event) {
+    if (event.other != Circle.get() || checkpointIndex != m_currentPoint) {
+        return;
+    }
+    m_currentPoint = (m_currentPoint + 1) % 9;
+}
+
+void BaseApp::setThreadedRendering(bool enabled) {
+    m_threadedRendering = enabled;
+}
+
+void BaseApp::setStressActorCount(int count) {
+    m_stressActorCount = count;
+}
+
+void BaseApp::setOnDemandRendering(bool enabled) {
+    m_onDemandRendering = enabled;
+}
+
+void BaseApp::setMaxIdleInterval(float seconds) {
+    m_maxIdleInterval = sf::seconds(seconds);
+}
+
+void BaseApp::requestRedraw() {
+    m_pendingRedrawFrames = std::max(m_pendingRedrawFrames, REDRAW_SETTLE_FRAMES);
+}
+
+bool BaseApp::needsRedraw() {
+    // Las versiones solo crecen, así que su suma cambia si cambió cualquier actor o forma.
+    uint64_t sceneVersion = 0;
+    for (auto* actors : { &m_actors, &m_stressActors }) {
+        sceneVersion += actors->size();
+        for (auto& actor : *actors) {
+            if (!actor.isNull()) {
+                sceneVersion += actor->getVersion();
+                auto shape = actor->getComponent<ShapeFactory>();
+                if (!shape.isNull()) {
+                    sceneVersion += shape->getVersion();
+                }
+            }
+        }
+    }
+
+    size_t eventCount = m_window->getEventCount();
+    size_t messageCount = NotificationService::getInstance().getMessageCount();
+    if (sceneVersion != m_lastSceneVersion || eventCount != m_lastEventCount ||
+        messageCount != m_lastMessageCount) {
+        m_lastSceneVersion = sceneVersion;
+        m_lastEventCount = eventCount;
+        m_lastMessageCount = messageCount;
+        requestRedraw();
+    }
+
+    // Un campo de texto activo anima el cursor.
+    if (ImGui::GetIO().WantTextInput) {
+        requestRedraw();
+    }
+
+    if (m_pendingRedrawFrames > 0) {
+        --m_pendingRedrawFrames;
+        return true;
+    }
+    return m_maxIdleInterval > sf::Time::Zero && m_idleClock.getElapsedTime() >= m_maxIdleInterval;
+}
 
-    Vector2 currentPos = transform->getPosition();
-    float distanceToTarget = (targetPos - currentPos).lengthSquared(); // Avoid sqrt
+void BaseApp::setShow3DView(bool enabled) {
+    m_show3DView = enabled;
+}
+
+void BaseApp::setHotReload(bool enabled) {
+    m_hotReload = enabled;
+}
+
+void BaseApp::setBinaryLog(bool enabled) {
+    m_binaryLog = enabled;
+}
+
+void BaseApp::render3DView() {
+    if (!m_renderer3D) {
+        return;
+    }
+
+    // El triángulo del README queda detrás del cubo, que gira con el tiempo.
+    static const Vertex3D triangle[3] = {
+        { Vector3(-2.0f, -1.5f, -3.0f), sf::Color::Red },
+        { Vector3(2.0f, -1.5f, -3.0f), sf::Color::Green },
+        { Vector3(0.0f, 2.0f, -3.0f), sf::Color::Blue },
+    };
+    // Se mantiene en [0, 2pi) para no perder precisión en sesiones largas.
+    m_view3DAngle = std::fmod(m_view3DAngle + m_window->deltaTime.asSeconds(), 2.0f * EngineMath::MATH_PI);
+
+    sf::Clock clock3D;
+    m_renderer3D->clear(sf::Color(25, 25, 35));
+    m_renderer3D->setCamera(Matrix4::lookAt(Vector3(0.0f, 1.5f, 4.0f), Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f)),
+                            Matrix4::perspective(1.0f, 480.0f / 270.0f, 0.1f, 100.0f));
+    m_renderer3D->submit(triangle, 3, Matrix4());
+    m_renderer3D->submit(m_cubeMesh.data(), m_cubeMesh.size(),
+                         Matrix4::rotation(Quaternion(m_view3DAngle, Vector3(0.3f, 1.0f, 0.2f).normalize())));
+    m_renderer3D->render();
+    m_renderer3D->copyPixels(m_view3DPixels.data());
+    m_view3DTexture.update(m_view3DPixels.data());
+    m_view3DMs = clock3D.getElapsedTime().asSeconds() * 1000.0f;
+
+    ImGui::Begin("3D View");
+    ImGui::Image(m_view3DTexture);
+    ImGui::Text("CPU 3D: %.2f ms, %zu triangles on screen", m_view3DMs, m_renderer3D->getRasterizedTriangleCount());
+    ImGui::End();
+
+    // El cubo se anima: en el modo bajo demanda se siguen dibujando fotogramas.
+    requestRedraw();
+}
+
+void BaseApp::updateLevelOfDetail() {
+    // Píxeles por unidad de mundo: tamaño del destino entre el tamaño de la vista.
+    sf::RenderWindow* window = m_window->getWindow();
+    float viewWidth = window->getView().getSize().x;
+    float pixelsPerUnit = viewWidth > 0.0f ? window->getSize().x / viewWidth : 1.0f;
+
+    m_lodChanges = 0;
+    for (auto* actors : { &m_actors, &m_stressActors }) {
+        for (auto& actor : *actors) {
+            if (!actor.isNull()) {
+                auto shape = actor->getComponent<ShapeFactory>();
+                if (!shape.isNull() && shape->updateLevelOfDetail(pixelsPerUnit)) {
+                    ++m_lodChanges;
+                }
+            }
+        }
+    }
+}
+
+void BaseApp::submitSnapshot() {
+    // Los actores estáticos también se copian: el hilo de render no usa la capa horneada.
+    SceneSnapshot& snapshot = m_renderThread.beginSnapshot();
+    for (auto* actors : { &m_actors, &m_stressActors }) {
+        for (auto& actor : *actors) {
+            if (!actor.isNull()) {
+                auto shape = actor->getComponent<ShapeFactory>();
+                if (!shape.isNull() && shape->getGeometry() != nullptr) {
+                    snapshot.capture(*shape, actor->getRenderLayer());
+                }
+            }
+        }
+    }
+    m_renderThread.submitSnapshot();
+}
+
+void BaseApp::showFrameTimings() {
+    ImGui::Begin("Frame Timing");
+    ImGui::Text("Mode: %s", m_threadedRendering ? "render thread" : "single thread");
+    ImGui::Text("Simulation: %.2f ms", m_simulationMs);
+    ImGui::Text("Scene render: %.2f ms", m_sceneRenderMs);
+    ImGui::Text("Frame: %.2f ms (%.0f FPS)", m_frameMs, m_frameMs > 0.0f ? 1000.0f / m_frameMs : 0.0f);
+    ImGui::Text("Draw calls: %zu per frame (scene %zu, preview %zu); %zu without batching",
+                m_sceneDrawCalls + m_previewDrawCalls, m_sceneDrawCalls, m_previewDrawCalls, m_unbatchedDrawCalls);
+    ImGui::Text("LOD changes: %d", m_lodChanges);
+    ImGui::Checkbox("On-demand rendering", &m_onDemandRendering);
+    ImGui::Text("Frames rendered: %llu, skipped: %llu", m_renderedFrameCount, m_skippedFrameCount);
+
+    const TextureLoadStats& loads = ResourceManager::getInstance().getTextureLoadStats();
+    ImGui::Text("Texture loads: %zu queued (%zu decoding, %zu to upload), %zu done, %zu failed",
+                loads.getQueueDepth(), loads.pendingDecodes, loads.pendingUploads,
+                loads.completedLoads, loads.failedLoads);
+    ImGui::Text("Texture latency: %.1f ms avg (decode %.1f ms), %.1f ms max; uploads %zu in %.2f ms",
+                loads.averageLatencyMs, loads.averageDecodeMs, loads.maxLatencyMs,
+                loads.lastFrameUploads, loads.lastFrameUploadMs);
+    ImGui::Text("Texture hot reloads: %zu (%zu decoding)", loads.hotReloads, loads.pendingReloads);
+    NotificationService& notifier = NotificationService::getInstance();
+    ImGui::Text("Log: %zu messages, %llu dropped", notifier.getMessageCount(),
+                static_cast<unsigned long long>(notifier.getDroppedCount()));
+    const TextureCacheStats& cache = ResourceManager::getInstance().getTextureCacheStats();
+    ImGui::Text("Texture cache: %zu textures, %.1f / %.1f MB, %.0f%% hits, %zu evictions, %zu reloads",
+                cache.residentCount, cache.residentBytes / 1048576.0, cache.budgetBytes / 1048576.0,
+                cache.getHitRate() * 100.0f, cache.evictions, cache.reloads);
+
+    if (ImGui::CollapsingHeader("Startup")) {
+        for (const StartupPhase& phase : m_startupTimeline.getPhases()) {
+            ImGui::Text("%s: %.1f -> %.1f ms (%.1f ms)", phase.name.c_str(), phase.startMs, phase.endMs,
+                        phase.endMs - phase.startMs);
+        }
+        ImGui::Text("Time to first frame: %.1f ms", m_startupTimeline.getTimeToFirstFrameMs());
+    }
 
-    if (distanceToTarget < 10.0f) {
-        m_currentPoint = (m_currentPoint + 1) % 9;
+    RenderTargetPool& pool = m_window->getTargetPool();
+    ImGui::Text("Resize events: %zu (applied %zu)", m_window->getResizeEventCount(), m_window->getAppliedResizeCount());
+    ImGui::Text("Render targets: %zu alive, %zu allocated, %zu reused",
+                pool.getTargetCount(), pool.getAllocationCount(), pool.getReuseCount());
+    if (m_threadedRendering) {
+        // Sin solapamiento el fotograma duraría al menos simulación + render.
+        ImGui::Text("Sequential estimate: %.2f ms", m_simulationMs + m_sceneRenderMs);
+        ImGui::Text("Snapshot latency: %.2f ms", m_renderThread.getLatencyMs());
+        ImGui::Text("Dropped snapshots: %llu", m_renderThread.getDroppedSnapshotCount());
     }
+    ImGui::End();
 }
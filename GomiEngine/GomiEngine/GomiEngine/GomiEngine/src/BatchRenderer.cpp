@@ -0,0 +1,207 @@
+#include "BatchRenderer.h"
+#include "Window.h"
+#include "RenderBackend.h"
+
+/**
+ * @brief Triangula un polígono convexo como abanico desde el primer punto y aplica la transformación.
+ * Las coordenadas de textura se calculan sobre los límites locales de los puntos, como en sf::Shape.
+ */
+template <typename GetPoint>
+static void
+appendFan(size_t pointCount, GetPoint getPoint, const sf::Transform& transform,
+          const sf::Color& color, const sf::IntRect& textureRect, sf::VertexArray& out) {
+    if (pointCount < 3) {
+        return;
+    }
+
+    sf::Vector2f first = getPoint(0);
+    float left = first.x;
+    float top = first.y;
+    float right = first.x;
+    float bottom = first.y;
+    for (size_t i = 1; i < pointCount; ++i) {
+        sf::Vector2f point = getPoint(i);
+        left = std::min(left, point.x);
+        top = std::min(top, point.y);
+        right = std::max(right, point.x);
+        bottom = std::max(bottom, point.y);
+    }
+    float width = right - left;
+    float height = bottom - top;
+
+    auto makeVertex = [&](size_t index) {
+        sf::Vector2f point = getPoint(index);
+        float xRatio = width > 0.0f ? (point.x - left) / width : 0.0f;
+        float yRatio = height > 0.0f ? (point.y - top) / height : 0.0f;
+        return sf::Vertex(transform.transformPoint(point),
+                          color,
+                          sf::Vector2f(textureRect.left + textureRect.width * xRatio,
+                                       textureRect.top + textureRect.height * yRatio));
+    };
+
+    sf::Vertex pivot = makeVertex(0);
+    sf::Vertex previous = makeVertex(1);
+    for (size_t i = 2; i < pointCount; ++i) {
+        sf::Vertex current = makeVertex(i);
+        out.append(pivot);
+        out.append(previous);
+        out.append(current);
+        previous = current;
+    }
+}
+
+/**
+ * @brief Dibuja los lotes en cualquier destino que acepte `draw(drawable, states)`.
+ */
+template <typename Target>
+static size_t
+drawBatches(const std::vector<BatchRenderer::Batch>& batches, size_t batchCount, Target& target) {
+    size_t drawCalls = 0;
+    for (size_t i = 0; i < batchCount; ++i) {
+        const BatchRenderer::Batch& batch = batches[i];
+        if (batch.drawable != nullptr) {
+            target.draw(*batch.drawable, sf::RenderStates(batch.blendMode));
+            ++drawCalls;
+        }
+        else if (batch.vertices.getVertexCount() > 0) {
+            sf::RenderStates states(batch.blendMode);
+            states.texture = batch.texture;
+            target.draw(batch.vertices, states);
+            ++drawCalls;
+        }
+    }
+    return drawCalls;
+}
+
+// Reinicia los lotes sin liberar la memoria de sus arreglos de vértices.
+void
+BatchRenderer::begin() {
+    for (size_t i = 0; i < m_batchCount; ++i) {
+        m_batches[i].vertices.clear();
+        m_batches[i].drawable = nullptr;
+    }
+    m_batchCount = 0;
+    m_submittedCount = 0;
+    m_drawCallCount = 0;
+}
+
+// Envía la geometría compartida del componente con los datos de su instancia.
+void
+BatchRenderer::submit(const ShapeFactory& shape, const sf::BlendMode& blendMode) {
+    const ShapeGeometry* geometry = shape.getGeometry();
+    if (geometry != nullptr) {
+        submitPolygon(geometry->points.data(), geometry->points.size(), shape.getTransform(),
+                      shape.getFillColor(), shape.getTextureRect(), shape.getTexture(), blendMode);
+    }
+}
+
+// Agrega la forma al lote compatible más reciente.
+void
+BatchRenderer::submit(const sf::Shape& shape, const sf::BlendMode& blendMode) {
+    ++m_submittedCount;
+
+    if (shape.getOutlineThickness() != 0.0f) {
+        // El contorno lo genera SFML; la forma ocupa su propio lote para conservar el orden.
+        openBatch(shape.getTexture(), blendMode).drawable = &shape;
+        return;
+    }
+
+    appendShapeVertices(shape, batchFor(shape.getTexture(), blendMode).vertices);
+}
+
+// Agrega un polígono ya copiado (p. ej. desde una instantánea de la escena) al lote compatible.
+void
+BatchRenderer::submitPolygon(const sf::Vector2f* points, size_t pointCount,
+                             const sf::Transform& transform, const sf::Color& color,
+                             const sf::IntRect& textureRect, const sf::Texture* texture,
+                             const sf::BlendMode& blendMode) {
+    ++m_submittedCount;
+    appendPolygonVertices(points, pointCount, transform, color, textureRect,
+                          batchFor(texture, blendMode).vertices);
+}
+
+// Dibuja cada lote con una sola llamada.
+void
+BatchRenderer::flush(Window& window) {
+    m_drawCallCount += drawBatches(m_batches, m_batchCount, window);
+}
+
+// Dibuja cada lote con una sola llamada en un destino de SFML (usado por el hilo de render).
+void
+BatchRenderer::flush(sf::RenderTarget& target) {
+    m_drawCallCount += drawBatches(m_batches, m_batchCount, target);
+}
+
+// Los lotes ya son listas de triángulos; las formas con contorno quedan a cargo del backend.
+void
+BatchRenderer::flush(RenderBackend& backend) {
+    for (size_t i = 0; i < m_batchCount; ++i) {
+        const Batch& batch = m_batches[i];
+        if (batch.drawable != nullptr) {
+            backend.draw(*batch.drawable, sf::RenderStates(batch.blendMode));
+            ++m_drawCallCount;
+        }
+        else if (batch.vertices.getVertexCount() > 0) {
+            sf::RenderStates states(batch.blendMode);
+            states.texture = batch.texture;
+            backend.drawTriangles(&batch.vertices[0], batch.vertices.getVertexCount(), states);
+            ++m_drawCallCount;
+        }
+    }
+}
+
+// Agrega los triángulos de la forma con su transformación, color y región de textura.
+void
+BatchRenderer::appendShapeVertices(const sf::Shape& shape, sf::VertexArray& out) {
+    appendFan(shape.getPointCount(),
+              [&shape](size_t index) { return shape.getPoint(index); },
+              shape.getTransform(), shape.getFillColor(), shape.getTextureRect(), out);
+}
+
+// Misma triangulación que para sf::Shape, a partir de puntos copiados.
+void
+BatchRenderer::appendPolygonVertices(const sf::Vector2f* points, size_t pointCount,
+                                     const sf::Transform& transform, const sf::Color& color,
+                                     const sf::IntRect& textureRect, sf::VertexArray& out) {
+    appendFan(pointCount,
+              [points](size_t index) { return points[index]; },
+              transform, color, textureRect, out);
+}
+
+// Suma los vértices de los lotes en uso.
+size_t
+BatchRenderer::getVertexCount() const {
+    size_t count = 0;
+    for (size_t i = 0; i < m_batchCount; ++i) {
+        count += m_batches[i].vertices.getVertexCount();
+    }
+    return count;
+}
+
+// Reutiliza el último lote si comparte textura y mezcla; si no, abre el siguiente.
+BatchRenderer::Batch&
+BatchRenderer::batchFor(const sf::Texture* texture, const sf::BlendMode& blendMode) {
+    if (m_batchCount > 0) {
+        Batch& last = m_batches[m_batchCount - 1];
+        if (last.drawable == nullptr && last.texture == texture && last.blendMode == blendMode) {
+            return last;
+        }
+    }
+
+    return openBatch(texture, blendMode);
+}
+
+// Abre un lote nuevo al final de la lista, reutilizando la memoria de fotogramas anteriores.
+BatchRenderer::Batch&
+BatchRenderer::openBatch(const sf::Texture* texture, const sf::BlendMode& blendMode) {
+    ++m_batchCount;
+    if (m_batchCount > m_batches.size()) {
+        m_batches.emplace_back();
+    }
+    Batch& batch = m_batches[m_batchCount - 1];
+    batch.texture = texture;
+    batch.blendMode = blendMode;
+    batch.vertices.clear();
+    batch.drawable = nullptr;
+    return batch;
+}
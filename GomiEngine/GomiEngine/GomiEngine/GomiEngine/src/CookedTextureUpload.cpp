@@ -0,0 +1,35 @@
+#include "TextureCooker.h"
+#include <SFML/OpenGL.hpp>
+#include <SFML/Window/Context.hpp>
+#include <algorithm>
+
+#ifndef GL_TEXTURE_MAX_LEVEL
+#define GL_TEXTURE_MAX_LEVEL 0x813D
+#endif
+
+// Nivel 0 por SFML; el resto de los niveles directo con OpenGL sobre la misma textura.
+bool
+uploadCookedTexture(sf::Texture& texture, const CookedImage& image) {
+    if (image.levelCount == 0 || !texture.create(image.width, image.height)) {
+        return false;
+    }
+    texture.update(image.levels[0]);
+    texture.setSmooth(true);
+    if (image.levelCount < 2 || sf::Context::getActiveContext() == nullptr) {
+        return true;
+    }
+
+    sf::Texture::bind(&texture);
+    GLsizei width = static_cast<GLsizei>(image.width);
+    GLsizei height = static_cast<GLsizei>(image.height);
+    for (uint32_t level = 1; level < image.levelCount; ++level) {
+        width = std::max<GLsizei>(1, width / 2);
+        height = std::max<GLsizei>(1, height / 2);
+        glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), GL_RGBA, width, height, 0,
+                     GL_RGBA, GL_UNSIGNED_BYTE, image.levels[level]);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(image.levelCount - 1));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    sf::Texture::bind(nullptr);
+    return true;
+}
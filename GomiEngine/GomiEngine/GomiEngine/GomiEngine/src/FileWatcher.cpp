@@ -0,0 +1,261 @@
+#include "FileWatcher.h"
+#include <filesystem>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Intervalo máximo que el hilo espera eventos antes de revisar si debe terminar.
+constexpr int WAIT_INTERVAL_MS = 100;
+
+std::string
+normalizePath(const std::filesystem::path& path) {
+    std::string normalized = path.lexically_normal().generic_string();
+    while (normalized.size() > 1 && normalized.back() == '/') {
+        normalized.pop_back();
+    }
+    return normalized;
+}
+
+} // namespace
+
+#ifdef _WIN32
+
+struct FileWatcher::Watch {
+    std::string directory;                 ///< Ruta normalizada del directorio.
+    bool recursive = true;                 ///< Incluye los subdirectorios.
+    HANDLE handle = INVALID_HANDLE_VALUE;  ///< Directorio abierto para leer cambios.
+    OVERLAPPED overlapped = {};            ///< Lectura asíncrona en curso.
+    DWORD buffer[16384];                   ///< Registros FILE_NOTIFY_INFORMATION (alineados a DWORD).
+
+    bool issueRead() {
+        return ReadDirectoryChangesW(handle, buffer, sizeof(buffer), recursive ? TRUE : FALSE,
+                                     FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME,
+                                     nullptr, &overlapped, nullptr) != FALSE;
+    }
+};
+
+FileWatcher::FileWatcher() = default;
+
+// Cancela las lecturas pendientes antes de cerrar los directorios.
+FileWatcher::~FileWatcher() {
+    stop();
+    for (auto& watch : m_watches) {
+        CancelIoEx(watch->handle, &watch->overlapped);
+        CloseHandle(watch->handle);
+        CloseHandle(watch->overlapped.hEvent);
+    }
+}
+
+// Un solo `ReadDirectoryChangesW` cubre el árbol completo cuando es recursivo.
+bool
+FileWatcher::addDirectory(const std::string& directory, bool recursive) {
+    if (m_running || m_watches.size() >= MAXIMUM_WAIT_OBJECTS) {
+        return false;
+    }
+    HANDLE handle = CreateFileA(directory.c_str(), FILE_LIST_DIRECTORY,
+                                FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                                FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    auto watch = std::make_unique<Watch>();
+    watch->directory = normalizePath(directory);
+    watch->recursive = recursive;
+    watch->handle = handle;
+    watch->overlapped.hEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+    m_watches.push_back(std::move(watch));
+    return true;
+}
+
+// Espera cualquiera de las lecturas, procesa sus registros y vuelve a pedir la siguiente.
+void
+FileWatcher::run() {
+    std::vector<HANDLE> events;
+    for (auto& watch : m_watches) {
+        watch->issueRead();
+        events.push_back(watch->overlapped.hEvent);
+    }
+
+    while (m_running) {
+        DWORD result = WaitForMultipleObjects(static_cast<DWORD>(events.size()), events.data(), FALSE,
+                                              WAIT_INTERVAL_MS);
+        if (result < WAIT_OBJECT_0 || result >= WAIT_OBJECT_0 + events.size()) {
+            continue;
+        }
+        Watch& watch = *m_watches[result - WAIT_OBJECT_0];
+        DWORD bytes = 0;
+        // Con 0 bytes el búfer se desbordó y los cambios se pierden; el siguiente guardado se detecta igual.
+        if (GetOverlappedResult(watch.handle, &watch.overlapped, &bytes, FALSE) && bytes > 0) {
+            const char* record = reinterpret_cast<const char*>(watch.buffer);
+            for (;;) {
+                const FILE_NOTIFY_INFORMATION* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(record);
+                if (info->Action == FILE_ACTION_ADDED || info->Action == FILE_ACTION_MODIFIED ||
+                    info->Action == FILE_ACTION_RENAMED_NEW_NAME) {
+                    int length = static_cast<int>(info->FileNameLength / sizeof(WCHAR));
+                    int size = WideCharToMultiByte(CP_UTF8, 0, info->FileName, length, nullptr, 0, nullptr, nullptr);
+                    std::string name(static_cast<size_t>(size), '\0');
+                    WideCharToMultiByte(CP_UTF8, 0, info->FileName, length, &name[0], size, nullptr, nullptr);
+                    recordChange(watch.directory + "/" + name);
+                }
+                if (info->NextEntryOffset == 0) {
+                    break;
+                }
+                record += info->NextEntryOffset;
+            }
+        }
+        ResetEvent(watch.overlapped.hEvent);
+        watch.issueRead();
+    }
+}
+
+#else
+
+struct FileWatcher::Watch {
+    std::string directory;  ///< Ruta normalizada del directorio.
+    int descriptor = -1;    ///< Descriptor de inotify para este directorio.
+};
+
+FileWatcher::FileWatcher() = default;
+
+// Cerrar el descriptor de inotify quita todas sus vigilancias.
+FileWatcher::~FileWatcher() {
+    stop();
+    if (m_inotify >= 0) {
+        close(m_inotify);
+    }
+}
+
+// inotify no es recursivo: se agrega una vigilancia por cada subdirectorio.
+bool
+FileWatcher::addDirectory(const std::string& directory, bool recursive) {
+    if (m_inotify < 0) {
+        m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_inotify < 0) {
+            return false;
+        }
+    }
+
+    std::vector<std::string> directories{ directory };
+    std::error_code error;
+    if (recursive) {
+        for (std::filesystem::recursive_directory_iterator it(directory, error), end; it != end && !error;
+             it.increment(error)) {
+            if (it->is_directory()) {
+                directories.push_back(it->path().string());
+            }
+        }
+    }
+
+    bool added = false;
+    for (const std::string& path : directories) {
+        int descriptor = inotify_add_watch(m_inotify, path.c_str(),
+                                           IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_ONLYDIR);
+        if (descriptor < 0) {
+            continue;
+        }
+        auto watch = std::make_unique<Watch>();
+        watch->directory = normalizePath(path);
+        watch->descriptor = descriptor;
+        m_watches.push_back(std::move(watch));
+        added = true;
+    }
+    return added;
+}
+
+// Los archivos se anotan al cerrarse tras escribir o al llegar por un renombre; los directorios
+// nuevos se empiezan a vigilar.
+void
+FileWatcher::run() {
+    alignas(inotify_event) char buffer[16384];
+    while (m_running) {
+        pollfd descriptor = { m_inotify, POLLIN, 0 };
+        if (::poll(&descriptor, 1, WAIT_INTERVAL_MS) <= 0) {
+            continue;
+        }
+        ssize_t length = read(m_inotify, buffer, sizeof(buffer));
+        for (ssize_t offset = 0; offset < length;) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+            if (event->len == 0) {
+                continue;
+            }
+            std::string directory;
+            for (const auto& watch : m_watches) {
+                if (watch->descriptor == event->wd) {
+                    directory = watch->directory;
+                    break;
+                }
+            }
+            if (directory.empty()) {
+                continue;
+            }
+            std::string path = directory + "/" + event->name;
+            if (event->mask & IN_ISDIR) {
+                if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                    addDirectory(path, true);
+                }
+            }
+            else if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+                recordChange(path);
+            }
+        }
+    }
+}
+
+#endif
+
+// El hilo solo arranca si hay algo que vigilar.
+bool
+FileWatcher::start() {
+    if (m_running || m_watches.empty()) {
+        return m_running;
+    }
+    m_running = true;
+    m_thread = std::thread([this]() { run(); });
+    return true;
+}
+
+// El hilo revisa `m_running` en cada intervalo de espera.
+void
+FileWatcher::stop() {
+    m_running = false;
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+// Reinicia la espera de la ruta para que una ráfaga de eventos cuente como un solo cambio.
+void
+FileWatcher::recordChange(const std::string& path) {
+    std::string normalized = normalizePath(path);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pending[normalized] = std::chrono::steady_clock::now();
+}
+
+// Entrega las rutas que llevan `m_coalesceDelayMs` sin eventos.
+size_t
+FileWatcher::poll(std::vector<std::string>& changedFiles) {
+    const auto now = std::chrono::steady_clock::now();
+    size_t count = 0;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_pending.begin(); it != m_pending.end();) {
+        if (std::chrono::duration<float, std::milli>(now - it->second).count() < m_coalesceDelayMs) {
+            ++it;
+            continue;
+        }
+        changedFiles.push_back(it->first);
+        it = m_pending.erase(it);
+        ++count;
+    }
+    return count;
+}
@@ -1,26 +1,25 @@
-﻿#include "GUIHandler.h"
-#include "WindowHandler.h"
+﻿#include "GUI.h"
 #include "imgui_internal.h"
 
 // Inicializa la interfaz gráfica.
-void GUIHandler::initialize() {
+void GUI::initialize() {
     configureStyle();
 }
 
 // Actualiza los elementos de la interfaz.
-void GUIHandler::updateInterface() {
+void GUI::updateInterface() {
 }
 
 // Dibuja los elementos de la interfaz.
-void GUIHandler::draw() {
+void GUI::draw() {
 }
 
 // Libera recursos y destruye la interfaz gráfica.
-void GUIHandler::releaseResources() {
+void GUI::releaseResources() {
 }
 
 // Establece el estilo y colores para los elementos gráficos.
-void GUIHandler::configureStyle() {
+void GUI::configureStyle() {
     ImGuiStyle& style = ImGui::GetStyle();
 
     // Personalización del estilo gráfico
@@ -51,7 +50,7 @@ void GUIHandler::configureStyle() {
 }
 
 // Muestra la consola de mensajes con errores del programa.
-void GUIHandler::showConsole(std::map<ConsolErrorType, std::string> messages) {
+void GUI::showConsole(std::map<ConsolErrorType, std::string> messages) {
     ImGui::Begin("Console");
     for (const auto& pair : messages) {
         ImGui::Text("Code: %d - Message: %s", pair.first, pair.second.c_str());
@@ -60,7 +59,7 @@ void GUIHandler::showConsole(std::map<ConsolErrorType, std::string> messages) {
 }
 
 // Muestra la jerarquía de actores y permite la selección de uno.
-void GUIHandler::showHierarchy(std::vector<EngineUtilities::TSharedPointer<Actor>>& actors) {
+void GUI::showHierarchy(std::vector<EngineUtilities::TSharedPointer<Actor>>& actors) {
     NotificationService& notifier = NotificationService::getInstance();
 
     ImGui::Begin("Actor Hierarchy");
@@ -71,8 +70,8 @@ void GUIHandler::showHierarchy(std::vector<EngineUtilities::TSharedPointer<Actor
 
         ImGui::PushID(i);
         std::string displayName = std::to_string(i) + " - " + actor->getName();
-        if (ImGui::Selectable(displayName.c_str(), selectedActor == actor)) {
-            selectedActor = actor;
+        if (ImGui::Selectable(displayName.c_str(), m_selectedActor.get() == actor.get())) {
+            m_selectedActor = actor;
         }
         ImGui::PopID();
     }
@@ -114,39 +113,36 @@ void GUIHandler::showHierarchy(std::vector<EngineUtilities::TSharedPointer<Actor
 }
 
 // Muestra el inspector para editar atributos del actor seleccionado.
-void GUIHandler::showInspector() {
-    if (selectedActor.isNull()) {
+void GUI::showInspector() {
+    if (m_selectedActor.isNull()) {
         return;
     }
 
     ImGui::Begin("Inspector");
 
     char actorName[128];
-    std::string name = selectedActor->getName();
+    std::string name = m_selectedActor->getName();
     if (name.size() < sizeof(actorName)) {
         std::copy(name.begin(), name.end(), actorName);
         actorName[name.size()] = '\0';
     }
 
     if (ImGui::InputText("Name", actorName, sizeof(actorName))) {
-        selectedActor->setName(std::string(actorName));
+        m_selectedActor->setName(std::string(actorName));
     }
 
-    auto transform = selectedActor->getComponent<Transform>();
+    auto transform = m_selectedActor->getComponent<Transform>();
     if (!transform.isNull()) {
-        float* position = new float[2];
-        float* rotation = new float[2];
-        float* scale = new float[2];
-        displayVec2Control("Position", selectedActor->getComponent<Transform>()->getPosData());
-        displayVec2Control("Rotation", selectedActor->getComponent<Transform>()->getRotData());
-        displayVec2Control("Scale", selectedActor->getComponent<Transform>()->getSclData());
+        displayVec2Control("Position", m_selectedActor->getComponent<Transform>()->getPosData());
+        displayVec2Control("Rotation", m_selectedActor->getComponent<Transform>()->getRotData());
+        displayVec2Control("Scale", m_selectedActor->getComponent<Transform>()->getSclData());
     }
 
     ImGui::End();
 }
 
 // Muestra controles para editar valores de vectores 2D.
-void GUIHandler::displayVec2Control(const std::string& label, float* values, float resetValue, float columnWidth) {
+void GUI::displayVec2Control(const std::string& label, float* values, float resetValue, float columnWidth) {
     ImGuiIO& io = ImGui::GetIO();
     auto boldFont = io.Fonts->Fonts[0];
 
@@ -1,11 +1,1195 @@
 #include "BaseApp.h"
 #include <SFML/Graphics.hpp>
 #include "Window.h"
+#include "TextureAtlas.h"
+#include "RenderQueue.h"
+#include "ShapeFactory.h"
+#include "RenderViewport.h"
+#include "BatchRenderer.h"
+#include "SoftwareRasterizer.h"
+#include "SoftwareRenderer3D.h"
+#include "Mesh.h"
+#include "AssetArchive.h"
+#include "TextureCooker.h"
+#include "MappedFile.h"
+#include "Services/JobSystem.h"
+#include "OpenHashMap.h"
+#include "LogSink.h"
+#include "LogConsole.h"
+#include "RenderThread.h"
+#include "SweepAndPrune.h"
+#include "UniformGrid.h"
+#include "AabbTree.h"
+#include <SFML/OpenGL.hpp>
+#include <cctype>
+#include <cmath>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <random>
 
 sf::RenderWindow* window;
 
 int
-main() {
+main(int argc, char* argv[]) {
+	// Modo offline: GomiEngine --build-atlas <salida> <sprite> [sprite...]
+	if (argc > 3 && std::string(argv[1]) == "--build-atlas") {
+		TextureAtlas atlas;
+		for (int i = 3; i < argc; ++i) {
+			atlas.addImage(argv[i], std::string(argv[i]) + ".png");
+		}
+		return atlas.build() && atlas.saveToFiles(argv[2]) ? 0 : 1;
+	}
+
+	// Medición: GomiEngine --bench-render-queue [comandos] [fotogramas]
+	if (argc > 1 && std::string(argv[1]) == "--bench-render-queue") {
+		size_t commandCount = argc > 2 ? std::stoul(argv[2]) : 100000;
+		int frames = argc > 3 ? std::stoi(argv[3]) : 100;
+
+		// Formas con texturas, capas y profundidades aleatorias (no se necesita contexto de OpenGL).
+		std::vector<sf::Texture> textures(16);
+		std::vector<ShapeFactory> shapes(commandCount);
+		std::vector<uint8_t> layers(commandCount);
+		std::vector<float> depths(commandCount);
+		std::mt19937 random(42);
+		for (size_t i = 0; i < commandCount; ++i) {
+			shapes[i].createShape(ShapeType::RECTANGLE);
+			shapes[i].setTexture(&textures[random() % textures.size()]);
+			layers[i] = static_cast<uint8_t>(random() % 4);
+			depths[i] = static_cast<float>(random() % 1000) / 1000.0f;
+		}
+
+		RenderQueue queue;
+		double totalMs = 0.0;
+		for (int frame = 0; frame < frames; ++frame) {
+			auto start = std::chrono::steady_clock::now();
+			queue.begin();
+			for (size_t i = 0; i < commandCount; ++i) {
+				queue.submit(shapes[i], layers[i], depths[i]);
+			}
+			queue.sort();
+			totalMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+		std::cout << commandCount << " commands, " << frames << " frames: "
+		          << totalMs / frames << " ms/frame (submit + sort, "
+		          << queue.getSortPassCount() << " radix passes)" << std::endl;
+		return 0;
+	}
+
+	// Reporte: GomiEngine --shape-memory-report [actores]
+	if (argc > 1 && std::string(argv[1]) == "--shape-memory-report") {
+		size_t actorCount = argc > 2 ? std::stoul(argv[2]) : 100000;
+		std::vector<ShapeFactory> shapes(actorCount);
+		for (ShapeFactory& shape : shapes) {
+			shape.createShape(ShapeType::CIRCLE);
+		}
+
+		// Antes: cada actor tenía su propio sf::CircleShape en el heap con un abanico de
+		// (puntos + 2) vértices; el contorno estaba vacío porque su grosor es 0.
+		size_t perShapeBefore = sizeof(Component) + sizeof(sf::Shape*) + sizeof(ShapeType)
+		                        + sizeof(sf::CircleShape) + (30 + 2) * sizeof(sf::Vertex);
+		size_t cacheBytes = GeometryCache::getInstance().getMemoryUsage();
+		double perShapeAfter = sizeof(ShapeFactory) + static_cast<double>(cacheBytes) / actorCount;
+
+		std::cout << actorCount << " circle actors\n"
+		          << "  before: ~" << perShapeBefore << " bytes/actor (component + sf::CircleShape + vertices)\n"
+		          << "  after:  " << perShapeAfter << " bytes/actor (sizeof(ShapeFactory) = " << sizeof(ShapeFactory)
+		          << ", shared geometry = " << cacheBytes << " bytes in "
+		          << GeometryCache::getInstance().getGeometryCount() << " entries)" << std::endl;
+		return 0;
+	}
+
+	// Medición: GomiEngine --bench-resize-storm [eventos] [eventos por fotograma]
+	// Simula arrastrar la esquina de la ventana de 800x600 a 1920x1080 y de regreso.
+	if (argc > 1 && std::string(argv[1]) == "--bench-resize-storm") {
+		int eventCount = argc > 2 ? std::stoi(argv[2]) : 240;
+		int eventsPerFrame = argc > 3 ? std::stoi(argv[3]) : 4;
+
+		RenderTargetPool pool;
+		RenderViewport scene(pool, "Scene");
+		RenderViewport game(pool, "Game");
+		scene.resize(sf::Vector2u(800, 600));
+		game.resize(sf::Vector2u(400, 300));
+
+		int appliedResizes = 0;
+		for (int first = 0; first < eventCount; first += eventsPerFrame) {
+			// Solo el último evento del fotograma se aplica.
+			int last = std::min(first + eventsPerFrame, eventCount) - 1;
+			float t = static_cast<float>(last) / (eventCount - 1);
+			float progress = t < 0.5f ? t * 2.0f : (1.0f - t) * 2.0f;
+			sf::Vector2u size(static_cast<unsigned int>(800 + 1120 * progress),
+			                  static_cast<unsigned int>(600 + 480 * progress));
+			scene.resize(size);
+			game.resize(sf::Vector2u(size.x / 2, size.y / 2));
+			++appliedResizes;
+		}
+
+		std::cout << eventCount << " resize events, " << appliedResizes << " applied (2 viewports)\n"
+		          << "  without pool: " << 2 * eventCount << " render texture allocations\n"
+		          << "  with pool:    " << pool.getAllocationCount() << " allocations, "
+		          << pool.getReuseCount() << " reuses, " << pool.getTargetCount() << " alive" << std::endl;
+		return 0;
+	}
+
+	// Sin GPU: GomiEngine --render-headless <salida.png> [referencia.png] [tolerancia]
+	// Dibuja la escena de demostración con el rasterizador por software; con una imagen de
+	// referencia, falla si algún canal difiere más que la tolerancia.
+	if (argc > 2 && std::string(argv[1]) == "--render-headless") {
+		SoftwareRasterizer rasterizer(1280, 720);
+
+		// Sin los recursos (p. ej. en CI) se usa un tablero de ajedrez en su lugar.
+		auto loadImage = [](sf::Image& image, const std::string& fileName) {
+			if (!image.loadFromFile(fileName)) {
+				image.create(64, 64, sf::Color::White);
+				for (unsigned int y = 0; y < 64; ++y) {
+					for (unsigned int x = 0; x < 64; ++x) {
+						if ((x / 8 + y / 8) % 2 == 0) {
+							image.setPixel(x, y, sf::Color(80, 80, 80));
+						}
+					}
+				}
+			}
+		};
+		sf::Image trackImage;
+		sf::Image playerImage;
+		loadImage(trackImage, "Circuit.png");
+		loadImage(playerImage, "Characters/tile000.png");
+
+		// Las texturas solo sirven de clave: el rasterizador muestrea las imágenes asociadas.
+		sf::Texture trackTexture;
+		sf::Texture playerTexture;
+		rasterizer.setTextureImage(&trackTexture, &trackImage);
+		rasterizer.setTextureImage(&playerTexture, &playerImage);
+
+		ShapeFactory track;
+		track.createShape(ShapeType::RECTANGLE);
+		track.setScale(Vector2(11.0f, 12.0f));
+		track.setTexture(&trackTexture);
+		track.setTextureRect(sf::IntRect(0, 0, trackImage.getSize().x, trackImage.getSize().y));
+
+		ShapeFactory player;
+		player.createShape(ShapeType::CIRCLE);
+		player.setPosition(200.0f, 200.0f);
+		player.setTexture(&playerTexture);
+		player.setTextureRect(sf::IntRect(0, 0, playerImage.getSize().x, playerImage.getSize().y));
+
+		ShapeFactory triangle;
+		triangle.createShape(ShapeType::TRIANGLE);
+		triangle.setPosition(200.0f, 200.0f);
+		triangle.setFillColor(sf::Color(255, 255, 255, 160));
+
+		BatchRenderer batches;
+		batches.begin();
+		batches.submit(track);
+		batches.submit(triangle);
+		batches.submit(player);
+
+		auto start = std::chrono::steady_clock::now();
+		rasterizer.clear(sf::Color(30, 30, 30));
+		batches.flush(rasterizer);
+		rasterizer.display();
+		double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		sf::Image result = rasterizer.copyToImage();
+		if (!result.saveToFile(argv[2])) {
+			std::cerr << "Could not write " << argv[2] << std::endl;
+			return 1;
+		}
+		std::cout << "Rendered " << rasterizer.getTriangleCount() << " triangles ("
+		          << rasterizer.getBinEntryCount() << " tile entries) in " << elapsedMs << " ms" << std::endl;
+
+		if (argc > 3) {
+			sf::Image golden;
+			int tolerance = argc > 4 ? std::stoi(argv[4]) : 0;
+			if (!golden.loadFromFile(argv[3]) || golden.getSize() != result.getSize()) {
+				std::cerr << "Reference image missing or with a different size: " << argv[3] << std::endl;
+				return 1;
+			}
+			size_t differentPixels = 0;
+			const sf::Uint8* expected = golden.getPixelsPtr();
+			const sf::Uint8* actual = result.getPixelsPtr();
+			for (size_t i = 0; i < static_cast<size_t>(result.getSize().x) * result.getSize().y; ++i) {
+				for (int channel = 0; channel < 4; ++channel) {
+					if (std::abs(expected[i * 4 + channel] - actual[i * 4 + channel]) > tolerance) {
+						++differentPixels;
+						break;
+					}
+				}
+			}
+			std::cout << differentPixels << " pixels differ from " << argv[3] << std::endl;
+			return differentPixels == 0 ? 0 : 1;
+		}
+		return 0;
+	}
+
+	// Medición: GomiEngine --bench-raster [formas] [fotogramas]
+	// Compara el rasterizador por software escalar / SSE2 y con uno o varios hilos.
+	if (argc > 1 && std::string(argv[1]) == "--bench-raster") {
+		size_t shapeCount = argc > 2 ? std::stoul(argv[2]) : 5000;
+		int frames = argc > 3 ? std::stoi(argv[3]) : 10;
+
+		std::vector<ShapeFactory> shapes(shapeCount);
+		std::mt19937 random(7);
+		BatchRenderer batches;
+		batches.begin();
+		for (size_t i = 0; i < shapeCount; ++i) {
+			shapes[i].createShape(static_cast<ShapeType>(1 + random() % 3));
+			shapes[i].setPosition(static_cast<float>(random() % 1280), static_cast<float>(random() % 720));
+			shapes[i].setScale(Vector2(0.3f, 0.3f));
+			shapes[i].setFillColor(sf::Color(random() % 256, random() % 256, random() % 256, 128 + random() % 128));
+			batches.submit(shapes[i]);
+		}
+
+		SoftwareRasterizer rasterizer(1280, 720);
+		for (int simd = 0; simd < 2; ++simd) {
+			for (int threaded = 0; threaded < 2; ++threaded) {
+				if (simd && !SoftwareRasterizer::isSimdAvailable()) {
+					continue;
+				}
+				rasterizer.setSimdEnabled(simd != 0);
+				rasterizer.setMultithreaded(threaded != 0);
+				auto start = std::chrono::steady_clock::now();
+				for (int frame = 0; frame < frames; ++frame) {
+					rasterizer.clear();
+					batches.flush(rasterizer);
+					rasterizer.display();
+				}
+				double frameMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+				std::cout << (simd ? "SSE2  " : "scalar") << (threaded ? " multithreaded " : " single thread ")
+				          << frameMs << " ms/frame (" << rasterizer.getTriangleCount() << " triangles, "
+				          << JobSystem::getInstance().getWorkerCount() + 1 << " threads available)" << std::endl;
+			}
+		}
+		return 0;
+	}
+
+	// Medición: GomiEngine --bench-broadphase [proxies] [fotogramas]
+	// Compara barrido y poda, rejilla uniforme y árbol AABB con las mismas cajas en movimiento,
+	// una carga coherente (desplazamientos cortos) y una rápida.
+	if (argc > 1 && std::string(argv[1]) == "--bench-broadphase") {
+		size_t proxyCount = argc > 2 ? std::stoul(argv[2]) : 2000;
+		int frames = argc > 3 ? std::stoi(argv[3]) : 300;
+		const float worldWidth = 1280.0f;
+		const float worldHeight = 720.0f;
+
+		// Cajas de 8 a 24 unidades que rebotan en los bordes del mundo; la semilla fija repite la carga.
+		struct MovingBox {
+			sf::FloatRect bounds;
+			sf::Vector2f velocity;
+		};
+		auto makeWorkload = [&](float maxSpeed) {
+			std::mt19937 random(11);
+			std::uniform_real_distribution<float> size(8.0f, 24.0f);
+			std::uniform_real_distribution<float> speed(-maxSpeed, maxSpeed);
+			std::vector<MovingBox> boxes(proxyCount);
+			for (MovingBox& box : boxes) {
+				box.bounds.width = size(random);
+				box.bounds.height = size(random);
+				box.bounds.left = std::uniform_real_distribution<float>(0.0f, worldWidth - box.bounds.width)(random);
+				box.bounds.top = std::uniform_real_distribution<float>(0.0f, worldHeight - box.bounds.height)(random);
+				box.velocity = sf::Vector2f(speed(random), speed(random));
+			}
+			return boxes;
+		};
+		auto step = [&](std::vector<MovingBox>& boxes) {
+			for (MovingBox& box : boxes) {
+				box.bounds.left += box.velocity.x;
+				box.bounds.top += box.velocity.y;
+				if (box.bounds.left < 0.0f || box.bounds.left + box.bounds.width > worldWidth) {
+					box.velocity.x = -box.velocity.x;
+					box.bounds.left = std::min(std::max(box.bounds.left, 0.0f), worldWidth - box.bounds.width);
+				}
+				if (box.bounds.top < 0.0f || box.bounds.top + box.bounds.height > worldHeight) {
+					box.velocity.y = -box.velocity.y;
+					box.bounds.top = std::min(std::max(box.bounds.top, 0.0f), worldHeight - box.bounds.height);
+				}
+			}
+		};
+
+		for (float maxSpeed : { 1.0f, 16.0f }) {
+			std::cout << proxyCount << " proxies, " << frames << " frames, up to " << maxSpeed << " units/frame" << std::endl;
+			// Pares del barrido y poda por fotograma: las otras estructuras deben encontrar los mismos.
+			std::vector<size_t> referencePairs(frames);
+			for (int method = 0; method < 3; ++method) {
+				std::vector<MovingBox> boxes = makeWorkload(maxSpeed);
+				SweepAndPrune sweep;
+				UniformGrid grid(32.0f);
+				AabbTree tree(4.0f);
+				std::vector<UniformGrid::ProxyPair> gridPairs;
+				std::vector<AabbTree::ProxyPair> treePairs;
+				for (const MovingBox& box : boxes) {
+					if (method == 0) {
+						sweep.createProxy(box.bounds, nullptr);
+					}
+					else if (method == 1) {
+						grid.createProxy(box.bounds, nullptr);
+					}
+					else {
+						tree.createProxy(box.bounds, nullptr);
+					}
+				}
+				sweep.clearEvents();
+
+				double totalMs = 0.0;
+				size_t totalPairs = 0;
+				int mismatches = 0;
+				for (int frame = 0; frame < frames; ++frame) {
+					step(boxes);
+					auto start = std::chrono::steady_clock::now();
+					size_t pairCount;
+					if (method == 0) {
+						for (unsigned int i = 0; i < boxes.size(); ++i) {
+							sweep.moveProxy(i, boxes[i].bounds);
+						}
+						pairCount = sweep.getPairCount();
+						sweep.clearEvents();
+					}
+					else if (method == 1) {
+						for (unsigned int i = 0; i < boxes.size(); ++i) {
+							grid.moveProxy(i, boxes[i].bounds);
+						}
+						grid.findPairs(gridPairs);
+						pairCount = gridPairs.size();
+					}
+					else {
+						for (unsigned int i = 0; i < boxes.size(); ++i) {
+							tree.moveProxy(i, boxes[i].bounds);
+						}
+						tree.findPairs(treePairs);
+						pairCount = treePairs.size();
+					}
+					totalMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+					totalPairs += pairCount;
+					if (method == 0) {
+						referencePairs[frame] = pairCount;
+					}
+					else if (pairCount != referencePairs[frame]) {
+						++mismatches;
+					}
+				}
+
+				static const char* const names[3] = { "sweep and prune", "uniform grid   ", "AABB tree      " };
+				std::cout << "  " << names[method] << " " << totalMs / frames << " ms/frame, "
+				          << static_cast<double>(totalPairs) / frames << " pairs/frame";
+				if (method == 0) {
+					std::cout << ", " << static_cast<double>(sweep.getSwapCount()) / frames << " swaps/frame";
+				}
+				else if (method == 2) {
+					std::cout << ", " << static_cast<double>(tree.getReinsertCount()) / frames << " reinserts/frame";
+				}
+				if (method > 0 && mismatches == 0) {
+					std::cout << ", same pairs";
+				}
+				else if (method > 0) {
+					std::cout << ", pair counts differ in " << mismatches << " frames";
+				}
+				std::cout << std::endl;
+			}
+		}
+		return 0;
+	}
+
+	// Medición: GomiEngine --bench-render-thread [actores] [fotogramas]
+	// Fotogramas distintos por segundo con simulación y dibujo en el mismo hilo, frente al hilo de
+	// render (instantáneas); la ganancia depende de tener al menos dos núcleos libres.
+	if (argc > 1 && std::string(argv[1]) == "--bench-render-thread") {
+		size_t actorCount = argc > 2 ? std::stoul(argv[2]) : 20000;
+		int frames = argc > 3 ? std::stoi(argv[3]) : 300;
+
+		std::vector<EngineUtilities::TSharedPointer<Actor>> actors;
+		std::mt19937 random(11);
+		for (size_t i = 0; i < actorCount; ++i) {
+			auto actor = EngineUtilities::MakeShared<Actor>("Bench " + std::to_string(i));
+			actor->getComponent<ShapeFactory>()->createShape(static_cast<ShapeType>(1 + random() % 3));
+			actor->getComponent<Transform>()->setTransform(Vector2(static_cast<float>(random() % 1280), static_cast<float>(random() % 720)),
+			                                             Vector2(0.0f, 0.0f), Vector2(0.2f, 0.2f));
+			actor->setRenderLayer(static_cast<uint8_t>(random() % 2));
+			actors.push_back(actor);
+		}
+
+		// La misma simulación que los actores de prueba de la aplicación.
+		double simulationMs = 0.0;
+		auto simulate = [&actors, &simulationMs](int frame) {
+			auto start = std::chrono::steady_clock::now();
+			Vector2 target(640.0f + 400.0f * std::cos(frame * 0.05f), 360.0f + 200.0f * std::sin(frame * 0.05f));
+			for (auto& actor : actors) {
+				actor->getComponent<Transform>()->Seek(target, 100.0f, 1.0f / 60.0f, 10.0f);
+				actor->update(1.0f / 60.0f);
+			}
+			simulationMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		};
+
+		// Un solo hilo: simulación, cola de dibujo y lotes, como BaseApp::render sin el hilo de render.
+		sf::RenderTexture target;
+		if (!target.create(1280, 720)) {
+			std::cerr << "Could not create the render texture" << std::endl;
+			return 1;
+		}
+		RenderQueue queue;
+		BatchRenderer batches;
+		auto start = std::chrono::steady_clock::now();
+		for (int frame = 0; frame < frames; ++frame) {
+			simulate(frame);
+			queue.begin();
+			for (auto& actor : actors) {
+				queue.submit(*actor->getComponent<ShapeFactory>(), actor->getRenderLayer());
+			}
+			queue.sort();
+			batches.begin();
+			queue.flush(batches);
+			target.setActive(true);
+			target.clear();
+			batches.flush(target);
+			target.display();
+			glFinish();
+		}
+		double singleMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		double singleSimulationMs = simulationMs / frames;
+		target.setActive(false);
+
+		// Hilo de render: el hilo principal solo simula y publica instantáneas.
+		RenderThread renderThread;
+		if (!renderThread.start(1280, 720)) {
+			std::cerr << "Could not start the render thread" << std::endl;
+			return 1;
+		}
+		simulationMs = 0.0;
+		start = std::chrono::steady_clock::now();
+		for (int frame = 0; frame < frames; ++frame) {
+			simulate(frame);
+			SceneSnapshot& snapshot = renderThread.beginSnapshot();
+			for (auto& actor : actors) {
+				snapshot.capture(*actor->getComponent<ShapeFactory>(), actor->getRenderLayer());
+			}
+			renderThread.submitSnapshot();
+		}
+		renderThread.stop();
+		double threadedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		unsigned long long renderedFrames = renderThread.getRenderedFrameCount();
+
+		std::cout << actorCount << " actors, " << frames << " frames, "
+		          << std::thread::hardware_concurrency() << " hardware threads\n"
+		          << "  single thread: " << singleMs / frames << " ms/frame (simulation "
+		          << singleSimulationMs << " ms), " << frames * 1000.0 / singleMs << " frames/s\n"
+		          << "  render thread: " << threadedMs / frames << " ms/frame on the main thread (simulation "
+		          << simulationMs / frames << " ms), " << renderedFrames << " frames drawn ("
+		          << renderThread.getDroppedSnapshotCount() << " snapshots dropped), "
+		          << renderedFrames * 1000.0 / threadedMs << " frames/s, last render "
+		          << renderThread.getRenderMs() << " ms" << std::endl;
+		return 0;
+	}
+
+	// Sin GPU: GomiEngine --render-3d <salida.png> [modelo.obj]
+	// Dibuja el cubo (o el modelo, escalado a su tamaño) y el triángulo de demostración con la tubería 3D en CPU.
+	if (argc > 2 && std::string(argv[1]) == "--render-3d") {
+		SoftwareRenderer3D renderer(1280, 720);
+		std::vector<Vertex3D> cube;
+		if (argc > 3) {
+			Mesh mesh;
+			if (!mesh.load(argv[3])) {
+				std::cerr << "Could not load " << argv[3] << std::endl;
+				return 1;
+			}
+			mesh.appendTriangles(cube);
+			Vector3 center = (mesh.getBoundsMin() + mesh.getBoundsMax()) * 0.5f;
+			Vector3 extent = mesh.getBoundsMax() - mesh.getBoundsMin();
+			float scale = 2.0f / std::max(std::max(extent.x, extent.y), std::max(extent.z, 1.0e-6f));
+			for (Vertex3D& vertex : cube) {
+				vertex.position = (vertex.position - center) * scale;
+			}
+		}
+		else {
+			SoftwareRenderer3D::appendCube(cube, 1.0f);
+		}
+		const Vertex3D triangle[3] = {
+			{ Vector3(-2.0f, -1.5f, -3.0f), sf::Color::Red },
+			{ Vector3(2.0f, -1.5f, -3.0f), sf::Color::Green },
+			{ Vector3(0.0f, 2.0f, -3.0f), sf::Color::Blue },
+		};
+
+		renderer.clear(sf::Color(25, 25, 35));
+		renderer.setCamera(Matrix4::lookAt(Vector3(0.0f, 1.5f, 4.0f), Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f)),
+		                   Matrix4::perspective(1.0f, 1280.0f / 720.0f, 0.1f, 100.0f));
+		renderer.submit(triangle, 3, Matrix4());
+		renderer.submit(cube.data(), cube.size(), Matrix4::rotation(Quaternion(0.6f, Vector3(0.3f, 1.0f, 0.2f).normalize())));
+		renderer.render();
+
+		if (!renderer.copyToImage().saveToFile(argv[2])) {
+			std::cerr << "Could not write " << argv[2] << std::endl;
+			return 1;
+		}
+		std::cout << renderer.getRasterizedTriangleCount() << " of " << renderer.getSubmittedTriangleCount()
+		          << " triangles rasterized" << std::endl;
+		return 0;
+	}
+
+	// Medición: GomiEngine --bench-3d [cubos] [fotogramas]
+	// Triángulos por segundo de la tubería 3D con 1, 2, 4... hilos.
+	if (argc > 1 && std::string(argv[1]) == "--bench-3d") {
+		int cubeCount = argc > 2 ? std::stoi(argv[2]) : 5000;
+		int frames = argc > 3 ? std::stoi(argv[3]) : 10;
+
+		// Una rejilla de cubos delante de la cámara, a distintas profundidades.
+		std::vector<Vertex3D> scene;
+		for (int i = 0; i < cubeCount; ++i) {
+			size_t first = scene.size();
+			SoftwareRenderer3D::appendCube(scene, 0.3f);
+			Vector3 offset(static_cast<float>(i % 50) - 25.0f, static_cast<float>((i / 50) % 40) - 20.0f,
+			               -30.0f - static_cast<float>(i % 7));
+			for (size_t v = first; v < scene.size(); ++v) {
+				scene[v].position = scene[v].position + offset;
+			}
+		}
+
+		SoftwareRenderer3D renderer(1280, 720);
+		renderer.setCamera(Matrix4(), Matrix4::perspective(1.2f, 1280.0f / 720.0f, 0.1f, 200.0f));
+		unsigned int maxThreads = static_cast<unsigned int>(JobSystem::getInstance().getWorkerCount() + 1);
+		for (unsigned int threads = 1; ; threads = std::min(threads * 2, maxThreads)) {
+			renderer.setThreadCount(threads);
+			auto start = std::chrono::steady_clock::now();
+			for (int frame = 0; frame < frames; ++frame) {
+				renderer.clear();
+				renderer.submit(scene.data(), scene.size(), Matrix4());
+				renderer.render();
+			}
+			double frameMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+			std::cout << threads << " threads: " << frameMs << " ms/frame, "
+			          << renderer.getSubmittedTriangleCount() / (frameMs / 1000.0) / 1.0e6 << " M triangles/s ("
+			          << renderer.getRasterizedTriangleCount() << " on screen, "
+			          << renderer.getBinEntryCount() << " tile entries)" << std::endl;
+			if (threads == maxThreads) {
+				break;
+			}
+		}
+		return 0;
+	}
+
+	// Medición: GomiEngine --bench-mesh-load [modelo.obj] [repeticiones]
+	// Sin modelo genera una rejilla de ~1M triángulos. Compara la lectura del OBJ en uno y varios
+	// hilos con la carga desde la caché binaria.
+	if (argc > 1 && std::string(argv[1]) == "--bench-mesh-load") {
+		std::string objPath = argc > 2 ? argv[2] : "bench_mesh.obj";
+		int runs = argc > 3 ? std::stoi(argv[3]) : 5;
+		if (argc <= 2) {
+			const int side = 708;
+			std::ofstream file(objPath);
+			char line[96];
+			for (int y = 0; y <= side; ++y) {
+				for (int x = 0; x <= side; ++x) {
+					std::snprintf(line, sizeof(line), "v %.4f %.4f %.4f\n", x * 0.01f, y * 0.01f, ((x * y) % 7) * 0.001f);
+					file << line;
+				}
+			}
+			for (int y = 0; y < side; ++y) {
+				for (int x = 0; x < side; ++x) {
+					int corner = y * (side + 1) + x + 1;
+					std::snprintf(line, sizeof(line), "f %d %d %d %d\n", corner, corner + 1, corner + side + 2, corner + side + 1);
+					file << line;
+				}
+			}
+		}
+
+		auto measure = [runs](const char* label, const std::function<bool(Mesh&)>& load) {
+			double bestMs = 1.0e30;
+			size_t triangles = 0;
+			for (int run = 0; run < runs; ++run) {
+				Mesh mesh;
+				auto start = std::chrono::steady_clock::now();
+				if (!load(mesh)) {
+					std::cerr << label << ": load failed" << std::endl;
+					return;
+				}
+				bestMs = std::min(bestMs, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+				triangles = mesh.getIndexCount() / 3;
+			}
+			std::cout << label << ": " << bestMs << " ms (" << triangles << " triangles)" << std::endl;
+		};
+		std::string cachePath = Mesh::getCachePath(objPath);
+		measure("OBJ, 1 thread", [&](Mesh& mesh) { return mesh.loadFromObj(objPath, false); });
+		measure("OBJ, parallel", [&](Mesh& mesh) { return mesh.loadFromObj(objPath, true); });
+		Mesh source;
+		if (!source.loadFromObj(objPath) || !source.saveCache(cachePath, objPath)) {
+			std::cerr << "Could not write " << cachePath << std::endl;
+			return 1;
+		}
+		measure("Binary cache (mmap)", [&](Mesh& mesh) { return mesh.loadCache(cachePath, objPath); });
+		measure("Binary cache + touch", [&](Mesh& mesh) {
+			// Recorre los índices para incluir el costo de traer las páginas a memoria.
+			if (!mesh.loadCache(cachePath, objPath)) {
+				return false;
+			}
+			volatile uint32_t checksum = 0;
+			for (size_t i = 0; i < mesh.getIndexCount(); i += 1024) {
+				checksum = checksum + mesh.getIndices()[i];
+			}
+			return true;
+		});
+		return 0;
+	}
+
+	// Herramienta offline: GomiEngine --pack-assets <salida.gpak> <directorio>
+	// Empaqueta todos los archivos del directorio con su ruta relativa como nombre.
+	if (argc > 3 && std::string(argv[1]) == "--pack-assets") {
+		std::string error;
+		if (!AssetArchive::buildFromDirectory(argv[2], argv[3], error)) {
+			std::cerr << error << std::endl;
+			return 1;
+		}
+		return 0;
+	}
+
+	// Medición: GomiEngine --bench-asset-archive [recursos]
+	// Compara archivos sueltos con el paquete: solo lectura de bytes, y lectura más decodificación.
+	// La primera pasada es "en frío" solo si antes se vació la caché de disco del sistema.
+	if (argc > 1 && std::string(argv[1]) == "--bench-asset-archive") {
+		int assetCount = argc > 2 ? std::stoi(argv[2]) : 2000;
+		const std::string directory = "bench_assets";
+		const std::string archivePath = "bench_assets.gpak";
+
+		std::vector<std::string> names;
+		std::filesystem::create_directories(directory + "/sprites");
+		sf::Image image;
+		for (int i = 0; i < assetCount; ++i) {
+			names.push_back("sprites/asset" + std::to_string(i) + ".png");
+			std::string path = directory + "/" + names.back();
+			if (!std::filesystem::exists(path)) {
+				image.create(32, 32, sf::Color(static_cast<sf::Uint8>(i * 37), static_cast<sf::Uint8>(i * 11), 200));
+				image.setPixel(static_cast<unsigned int>(i % 32), 0, sf::Color::White);
+				image.saveToFile(path);
+			}
+		}
+		std::string error;
+		if (!AssetArchive::buildFromDirectory(archivePath, directory, error)) {
+			std::cerr << error << std::endl;
+			return 1;
+		}
+
+		auto elapsedMs = [](std::chrono::steady_clock::time_point start) {
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		};
+		for (int pass = 1; pass <= 2; ++pass) {
+			// Solo bytes: abrir y leer cada archivo contra buscar en el índice y tocar los datos.
+			auto start = std::chrono::steady_clock::now();
+			size_t looseBytes = 0;
+			std::vector<char> buffer;
+			for (const std::string& name : names) {
+				std::ifstream file(directory + "/" + name, std::ios::binary | std::ios::ate);
+				buffer.resize(static_cast<size_t>(file.tellg()));
+				file.seekg(0);
+				file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+				looseBytes += buffer.size();
+			}
+			double looseReadMs = elapsedMs(start);
+
+			start = std::chrono::steady_clock::now();
+			AssetArchive archive;
+			if (!archive.open(archivePath)) {
+				std::cerr << "Could not open " << archivePath << std::endl;
+				return 1;
+			}
+			double openMs = elapsedMs(start);
+			volatile unsigned int checksum = 0;
+			for (const std::string& name : names) {
+				AssetSpan span = archive.find(name);
+				const unsigned char* bytes = static_cast<const unsigned char*>(span.data);
+				for (size_t i = 0; i < span.size; i += 4096) {
+					checksum = checksum + bytes[i];
+				}
+			}
+			double archiveReadMs = elapsedMs(start);
+
+			// Lectura más decodificación PNG, como al cargar texturas.
+			start = std::chrono::steady_clock::now();
+			for (const std::string& name : names) {
+				image.loadFromFile(directory + "/" + name);
+			}
+			double looseDecodeMs = elapsedMs(start);
+			start = std::chrono::steady_clock::now();
+			for (const std::string& name : names) {
+				AssetSpan span = archive.find(name);
+				image.loadFromMemory(span.data, span.size);
+			}
+			double archiveDecodeMs = openMs + elapsedMs(start);
+
+			std::cout << "Pass " << pass << " (" << names.size() << " assets, " << looseBytes / 1024 << " KB): "
+			          << "read loose " << looseReadMs << " ms, archive " << archiveReadMs << " ms (open "
+			          << openMs << " ms); read+decode loose " << looseDecodeMs << " ms, archive "
+			          << archiveDecodeMs << " ms" << std::endl;
+		}
+		return 0;
+	}
+
+	// Herramienta offline: GomiEngine --cook-assets <origen> [salida] [--premultiply] [--no-mips]
+	// Convierte las imágenes a `.gtex`; solo se vuelven a cocinar las que cambiaron.
+	if (argc > 2 && std::string(argv[1]) == "--cook-assets") {
+		std::string outputDirectory = argv[2];
+		TextureCooker cooker;
+		for (int i = 3; i < argc; ++i) {
+			std::string argument = argv[i];
+			if (argument == "--premultiply") {
+				cooker.setPremultiply(true);
+			}
+			else if (argument == "--no-mips") {
+				cooker.setGenerateMips(false);
+			}
+			else {
+				outputDirectory = argument;
+			}
+		}
+		auto start = std::chrono::steady_clock::now();
+		bool succeeded = cooker.cookDirectory(argv[2], outputDirectory);
+		double cookMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		std::cout << "Cooked " << cooker.getCookedCount() << ", up to date " << cooker.getSkippedCount()
+		          << ", failed " << cooker.getFailedCount() << " in " << cookMs << " ms" << std::endl;
+		for (const std::string& path : cooker.getFailedFiles()) {
+			std::cerr << "Failed: " << path << std::endl;
+		}
+		return succeeded ? 0 : 1;
+	}
+
+	// Medición: GomiEngine --bench-cooked-textures [imágenes]
+	// Compara decodificar PNG con proyectar y validar el `.gtex` (lo que queda es copiar a la GPU),
+	// y mide cocinar desde cero contra volver a cocinar sin cambios.
+	if (argc > 1 && std::string(argv[1]) == "--bench-cooked-textures") {
+		int imageCount = argc > 2 ? std::stoi(argv[2]) : 200;
+		const std::string sourceDirectory = "bench_textures";
+		const std::string cookedDirectory = "bench_textures_cooked";
+		std::filesystem::create_directories(sourceDirectory);
+		std::filesystem::remove_all(cookedDirectory);
+
+		std::mt19937 random(7);
+		std::vector<std::string> names;
+		sf::Image image;
+		for (int i = 0; i < imageCount; ++i) {
+			names.push_back("texture" + std::to_string(i));
+			std::string path = sourceDirectory + "/" + names.back() + ".png";
+			if (!std::filesystem::exists(path)) {
+				image.create(256, 256);
+				for (unsigned int y = 0; y < 256; ++y) {
+					for (unsigned int x = 0; x < 256; ++x) {
+						image.setPixel(x, y, sf::Color(static_cast<sf::Uint8>(x ^ y), static_cast<sf::Uint8>(random()),
+						                               static_cast<sf::Uint8>(i), static_cast<sf::Uint8>(x + y)));
+					}
+				}
+				image.saveToFile(path);
+			}
+		}
+
+		auto elapsedMs = [](std::chrono::steady_clock::time_point start) {
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		};
+		TextureCooker cooker;
+		auto start = std::chrono::steady_clock::now();
+		cooker.cookDirectory(sourceDirectory, cookedDirectory);
+		double coldCookMs = elapsedMs(start);
+		start = std::chrono::steady_clock::now();
+		cooker.cookDirectory(sourceDirectory, cookedDirectory);
+		double warmCookMs = elapsedMs(start);
+		std::cout << "Cook " << names.size() << " images: " << coldCookMs << " ms; unchanged re-cook "
+		          << warmCookMs << " ms (" << cooker.getSkippedCount() << " skipped)" << std::endl;
+
+		start = std::chrono::steady_clock::now();
+		for (const std::string& name : names) {
+			image.loadFromFile(sourceDirectory + "/" + name + ".png");
+		}
+		double decodeMs = elapsedMs(start);
+
+		start = std::chrono::steady_clock::now();
+		volatile unsigned int checksum = 0;
+		for (const std::string& name : names) {
+			MappedFile file;
+			CookedImage cooked;
+			if (!file.open(cookedDirectory + "/" + name + ".gtex") || !cooked.parse(file.data(), file.size())) {
+				std::cerr << "Invalid cooked texture: " << name << std::endl;
+				return 1;
+			}
+			size_t levelBytes = static_cast<size_t>(cooked.width) * cooked.height * 4;
+			for (size_t i = 0; i < levelBytes; i += 4096) {
+				checksum = checksum + cooked.levels[0][i];
+			}
+		}
+		double cookedMs = elapsedMs(start);
+		std::cout << "Load " << names.size() << " textures: PNG decode " << decodeMs << " ms, cooked map+parse "
+		          << cookedMs << " ms" << std::endl;
+		return 0;
+	}
+
+	// Medición: GomiEngine --bench-resource-lookup [recursos]
+	// Consultas por segundo del mapa anterior (`std::unordered_map` con clave `std::string`,
+	// construida desde el `const char*` de cada consulta) contra `OpenHashMap` con `std::string_view`.
+	if (argc > 1 && std::string(argv[1]) == "--bench-resource-lookup") {
+		size_t resourceCount = argc > 2 ? static_cast<size_t>(std::stoul(argv[2])) : 2000;
+		const size_t queryCount = 10000000;
+		std::vector<std::string> names;
+		for (size_t i = 0; i < resourceCount; ++i) {
+			names.push_back("Characters/Walk/frame_" + std::to_string(100000 + i));
+		}
+
+		std::unordered_map<std::string, EngineUtilities::TSharedPointer<Texture>> standardMap;
+		EngineUtilities::OpenHashMap<EngineUtilities::TSharedPointer<Texture>> openMap;
+		for (const std::string& name : names) {
+			standardMap[name] = EngineUtilities::TSharedPointer<Texture>();
+			openMap.insert(name, EngineUtilities::TSharedPointer<Texture>());
+		}
+		std::mt19937 random(3);
+		std::vector<const char*> queries(queryCount);
+		for (const char*& query : queries) {
+			query = names[random() % names.size()].c_str();
+		}
+
+		auto lookupsPerSecond = [&](const std::function<bool(const char*)>& lookup) {
+			auto start = std::chrono::steady_clock::now();
+			size_t found = 0;
+			for (const char* query : queries) {
+				found += lookup(query) ? 1 : 0;
+			}
+			double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			if (found != queries.size()) {
+				std::cerr << "Lookup mismatch" << std::endl;
+			}
+			return static_cast<double>(queries.size()) / seconds;
+		};
+		double standardRate = lookupsPerSecond([&](const char* query) {
+			return standardMap.find(query) != standardMap.end();
+		});
+		double openRate = lookupsPerSecond([&](const char* query) {
+			return openMap.find(query) != nullptr;
+		});
+		std::printf("%zu resources, %zu lookups: unordered_map<string> %.1f M/s, OpenHashMap<string_view> %.1f M/s (%.2fx)\n",
+		            names.size(), queries.size(), standardRate / 1e6, openRate / 1e6, openRate / standardRate);
+		return 0;
+	}
+
+	// Medición: GomiEngine --bench-preload [texturas]
+	// Tiempo para tener listas N texturas de 256x256: una tras otra con `loadTexture` contra
+	// `preload` (lectura y decodificación en `JobSystem`) seguido de `finishPendingLoads`.
+	if (argc > 1 && std::string(argv[1]) == "--bench-preload") {
+		int textureCount = argc > 2 ? std::stoi(argv[2]) : 300;
+		const std::string directories[2] = { "bench_preload_sequential", "bench_preload_parallel" };
+		sf::Image image;
+		image.create(256, 256);
+		std::mt19937 random(11);
+		for (unsigned int y = 0; y < 256; ++y) {
+			for (unsigned int x = 0; x < 256; ++x) {
+				image.setPixel(x, y, sf::Color(static_cast<sf::Uint8>(random()), static_cast<sf::Uint8>(x), static_cast<sf::Uint8>(y)));
+			}
+		}
+		for (const std::string& directory : directories) {
+			std::filesystem::create_directories(directory);
+			for (int i = 0; i < textureCount; ++i) {
+				std::string path = directory + "/texture" + std::to_string(i) + ".png";
+				if (!std::filesystem::exists(path)) {
+					image.saveToFile(path);
+				}
+			}
+		}
+
+		ResourceManager& resourceManager = ResourceManager::getInstance();
+		resourceManager.setTextureBudget(0);
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < textureCount; ++i) {
+			resourceManager.loadTexture(directories[0] + "/texture" + std::to_string(i), "png");
+		}
+		double sequentialMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		std::vector<PreloadEntry> entries;
+		for (int i = 0; i < textureCount; ++i) {
+			entries.push_back({ PreloadType::TEXTURE, directories[1] + "/texture" + std::to_string(i), "png", {} });
+		}
+		start = std::chrono::steady_clock::now();
+		std::vector<TextureHandle> handles = resourceManager.preload(entries);
+		resourceManager.finishPendingLoads();
+		double parallelMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		std::cout << textureCount << " textures: sequential " << sequentialMs << " ms, preload " << parallelMs
+		          << " ms (" << sequentialMs / parallelMs << "x, " << JobSystem::getInstance().getWorkerCount()
+		          << " workers)" << std::endl;
+		return 0;
+	}
+
+	// Modo offline: GomiEngine --decode-log <registro.glog> [salida.txt]
+	if (argc > 2 && std::string(argv[1]) == "--decode-log") {
+		std::FILE* output = argc > 3 ? std::fopen(argv[3], "w") : stdout;
+		if (output == nullptr) {
+			std::cerr << "Could not open " << argv[3] << std::endl;
+			return 1;
+		}
+		size_t recordCount = 0;
+		bool complete = decodeBinaryLog(argv[2], output, recordCount);
+		if (output != stdout) {
+			std::fclose(output);
+		}
+		std::cerr << recordCount << " messages decoded" << (complete ? "" : " (file missing, invalid or truncated)") << std::endl;
+		return complete ? 0 : 1;
+	}
+
+	// Medición: GomiEngine --bench-structured-log [mensajes]
+	// Costo por mensaje en el hilo que registra: formatear con `std::ostringstream` (lo que hacía
+	// la macro MESSAGE), `logf` (formatea con `vsnprintf` en el búfer) y `GOMI_LOG` (solo copia los
+	// argumentos). El búfer se vacía entre tandas, fuera de la medición.
+	if (argc > 1 && std::string(argv[1]) == "--bench-structured-log") {
+		int messageCount = argc > 2 ? std::stoi(argv[2]) : 1000000;
+		const int chunk = 4096;
+		NotificationService& notifier = NotificationService::getInstance();
+		const char* names[4] = { "Circuit", "CharactersAtlas", "Characters/tile000", "Fonts/Arial" };
+		size_t formattedBytes = 0;
+		auto nanosecondsPerMessage = [&](const std::function<void(int)>& logMessage) {
+			double totalNs = 0.0;
+			for (int done = 0; done < messageCount; done += chunk) {
+				int count = std::min(chunk, messageCount - done);
+				auto start = std::chrono::steady_clock::now();
+				for (int i = done; i < done + count; ++i) {
+					logMessage(i);
+				}
+				totalNs += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+				notifier.drain([](const LogRecord&) {});
+			}
+			return totalNs / messageCount;
+		};
+
+		double streamNs = nanosecondsPerMessage([&](int i) {
+			std::ostringstream stream;
+			stream << "Texture " << names[i & 3] << " loaded in " << i % 97 << " ms (" << static_cast<size_t>(i) * 4096 << " bytes)";
+			formattedBytes += stream.str().size();
+		});
+		double logfNs = nanosecondsPerMessage([&](int i) {
+			notifier.logf(ConsolErrorType::NORMAL, "Bench", "Texture %s loaded in %d ms (%zu bytes)", names[i & 3], i % 97,
+			              static_cast<size_t>(i) * 4096);
+		});
+		double structuredNs = nanosecondsPerMessage([&](int i) {
+			GOMI_LOG_INFO("Bench", "Texture %s loaded in %d ms (%zu bytes)", names[i & 3], i % 97, static_cast<size_t>(i) * 4096);
+		});
+		std::printf("%d messages: ostringstream %.0f ns, logf %.0f ns, GOMI_LOG %.0f ns per message (%zu bytes formatted)\n",
+		            messageCount, streamNs, logfNs, structuredNs, formattedBytes);
+		return 0;
+	}
+
+	// Medición: GomiEngine --bench-logger [productores] [mensajes por productor]
+	// Mensajes por segundo escritos con `logf` desde varios hilos mientras otro hilo los consume,
+	// con cada política de desborde. Los productores nunca esperan: lo que no cabe se descarta.
+	if (argc > 1 && std::string(argv[1]) == "--bench-logger") {
+		int producerCount = argc > 2 ? std::stoi(argv[2]) : 4;
+		int messagesPerProducer = argc > 3 ? std::stoi(argv[3]) : 1000000;
+		NotificationService& notifier = NotificationService::getInstance();
+		const LogOverflow policies[2] = { LogOverflow::DROP_NEWEST, LogOverflow::DROP_OLDEST };
+		for (LogOverflow policy : policies) {
+			notifier.setOverflowPolicy(policy);
+			uint64_t droppedBefore = notifier.getDroppedCount();
+			std::atomic<bool> producing{ true };
+			size_t consumed = 0;
+			std::thread consumer([&]() {
+				auto consume = [&](const LogRecord&) { ++consumed; };
+				while (producing.load(std::memory_order_acquire)) {
+					if (notifier.drain(consume) == 0) {
+						std::this_thread::yield();
+					}
+				}
+				notifier.drain(consume);
+			});
+
+			auto start = std::chrono::steady_clock::now();
+			std::vector<std::thread> producers;
+			for (int p = 0; p < producerCount; ++p) {
+				producers.emplace_back([&notifier, messagesPerProducer, p]() {
+					for (int i = 0; i < messagesPerProducer; ++i) {
+						notifier.logf(ConsolErrorType::NORMAL, "BenchLogger", "producer %d message %d", p, i);
+					}
+				});
+			}
+			for (std::thread& producer : producers) {
+				producer.join();
+			}
+			double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			producing.store(false, std::memory_order_release);
+			consumer.join();
+
+			double total = static_cast<double>(producerCount) * messagesPerProducer;
+			std::printf("%s: %d producers x %d messages, %.1f M msg/s, %zu consumed, %llu dropped\n",
+			            policy == LogOverflow::DROP_NEWEST ? "drop newest" : "drop oldest", producerCount,
+			            messagesPerProducer, total / seconds / 1e6, consumed,
+			            static_cast<unsigned long long>(notifier.getDroppedCount() - droppedBefore));
+		}
+		return 0;
+	}
+
+	// Medición: GomiEngine --bench-log-sink [fotogramas] [mensajes por fotograma]
+	// Cuánto alarga el fotograma del hilo principal registrar mensajes: sin registro, escribiendo
+	// cada mensaje con `std::ofstream` y `std::endl` (lo necesario para no perderlos si el proceso
+	// se cae), y con `logf` mientras `LogSink` escribe por lotes en su hilo.
+	if (argc > 1 && std::string(argv[1]) == "--bench-log-sink") {
+		int frameCount = argc > 2 ? std::stoi(argv[2]) : 300;
+		int messagesPerFrame = argc > 3 ? std::stoi(argv[3]) : 500;
+		NotificationService& notifier = NotificationService::getInstance();
+		std::vector<float> work(20000);
+		auto averageFrameMs = [&](const std::function<void(int, int)>& logMessage) {
+			auto start = std::chrono::steady_clock::now();
+			for (int frame = 0; frame < frameCount; ++frame) {
+				for (size_t i = 0; i < work.size(); ++i) {
+					work[i] = std::sin(work[i] + static_cast<float>(i));
+				}
+				for (int i = 0; i < messagesPerFrame; ++i) {
+					logMessage(frame, i);
+				}
+			}
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frameCount;
+		};
+
+		double baseMs = averageFrameMs([](int, int) {});
+		std::ofstream file("bench_log_ofstream.txt");
+		double ofstreamMs = averageFrameMs([&](int frame, int i) {
+			file << "[Bench] Code: 0 - Message: frame " << frame << " message " << i << std::endl;
+		});
+		file.close();
+
+		LogSink sink;
+		if (!sink.start("bench_log_sink.txt", 64 * 1024 * 1024, 1)) {
+			std::cerr << "Could not open bench_log_sink.txt" << std::endl;
+			return 1;
+		}
+		uint64_t droppedBefore = notifier.getDroppedCount();
+		double sinkMs = averageFrameMs([&](int frame, int i) {
+			notifier.logf(ConsolErrorType::NORMAL, "Bench", "frame %d message %d", frame, i);
+		});
+		sink.stop();
+		LogSinkStats stats = sink.getStats();
+
+		double messages = static_cast<double>(messagesPerFrame);
+		std::printf("%d frames x %d messages\n", frameCount, messagesPerFrame);
+		std::printf("  no logging: %.3f ms/frame\n", baseMs);
+		std::printf("  ofstream + endl: %.3f ms/frame (+%.0f ns/message)\n", ofstreamMs, (ofstreamMs - baseMs) * 1e6 / messages);
+		std::printf("  ring + sink: %.3f ms/frame (+%.0f ns/message), %llu written in %llu writes, %llu dropped\n",
+		            sinkMs, (sinkMs - baseMs) * 1e6 / messages, stats.records, stats.writes,
+		            static_cast<unsigned long long>(notifier.getDroppedCount() - droppedBefore));
+		return 0;
+	}
+
+	// Medición: GomiEngine --bench-console [mensajes] [mensajes por fotograma]
+	// Tiempo de la consola por fotograma con el historial lleno, sin ventana (ImGui sin backend):
+	// siguiendo el final mientras llegan mensajes, rehaciendo el índice tras cambiar el filtro de
+	// texto y con el filtro activo. Como referencia, un fotograma que dibuja todas las líneas.
+	if (argc > 1 && std::string(argv[1]) == "--bench-console") {
+		int messageCount = argc > 2 ? std::stoi(argv[2]) : 1000000;
+		int messagesPerFrame = argc > 3 ? std::stoi(argv[3]) : 100;
+		NotificationService& notifier = NotificationService::getInstance();
+		auto logMessages = [&](int first, int count) {
+			for (int i = first; i < first + count; ++i) {
+				// La mitad de los mensajes normales llega sin formatear (GOMI_LOG) y se arma al mostrarla.
+				ConsolErrorType severity = i % 100 == 0 ? ConsolErrorType::ERROR
+				                           : i % 10 == 0 ? ConsolErrorType::WARNING : ConsolErrorType::NORMAL;
+				if (severity == ConsolErrorType::NORMAL && i % 2 == 1) {
+					GOMI_LOG_INFO("Bench", "actor %d moved to checkpoint %d", i % 5000, i % 7);
+				}
+				else {
+					notifier.logf(severity, "Bench", "actor %d moved to checkpoint %d", i % 5000, i % 7);
+				}
+			}
+			notifier.pump();
+		};
+		for (int done = 0; done < messageCount; done += 4096) {
+			logMessages(done, std::min(4096, messageCount - done));
+		}
+		const LogHistory& history = notifier.getHistory();
+
+		ImGui::CreateContext();
+		ImGuiIO& io = ImGui::GetIO();
+		io.DisplaySize = ImVec2(1280.0f, 720.0f);
+		io.DeltaTime = 1.0f / 60.0f;
+		io.IniFilename = nullptr;
+		unsigned char* pixels = nullptr;
+		int width = 0;
+		int height = 0;
+		io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+		LogConsole console;
+		auto drawFrame = [&](const std::function<void()>& drawWindows) {
+			ImGui::NewFrame();
+			ImGui::SetNextWindowSize(ImVec2(900.0f, 600.0f));
+			drawWindows();
+			ImGui::Render();
+		};
+		int next = messageCount;
+		auto measure = [&](const char* label, int frameCount, bool newMessages) {
+			float totalMs = 0.0f;
+			float maxMs = 0.0f;
+			for (int frame = 0; frame < frameCount; ++frame) {
+				if (newMessages) {
+					logMessages(next, messagesPerFrame);
+					next += messagesPerFrame;
+				}
+				drawFrame([&]() { console.draw(history); });
+				totalMs += console.getLastDrawMs();
+				maxMs = std::max(maxMs, console.getLastDrawMs());
+			}
+			std::printf("  %s: %d frames, %.3f ms avg, %.3f ms max, %zu lines shown\n", label, frameCount,
+			            totalMs / frameCount, maxMs, console.getVisibleCount());
+		};
+
+		std::printf("%zu messages in history (%.1f MB), %d new per frame\n", history.size(),
+		            history.getMemoryBytes() / (1024.0 * 1024.0), messagesPerFrame);
+		// El primer fotograma crea la ventana y no cuenta.
+		drawFrame([&]() { console.draw(history); });
+		measure("auto-scroll", 300, true);
+		console.setFilter("checkpoint 3", true, true, true);
+		int rebuildFrames = 0;
+		float rebuildMaxMs = 0.0f;
+		while (!console.isIndexComplete(history)) {
+			drawFrame([&]() { console.draw(history); });
+			rebuildMaxMs = std::max(rebuildMaxMs, console.getLastDrawMs());
+			++rebuildFrames;
+		}
+		std::printf("  filter rebuild: %d frames, %.3f ms max\n", rebuildFrames, rebuildMaxMs);
+		measure("filtered auto-scroll", 300, true);
+		console.setFilter("", false, true, true);
+		while (!console.isIndexComplete(history)) {
+			drawFrame([&]() { console.draw(history); });
+		}
+		measure("warnings and errors", 300, true);
+
+		auto start = std::chrono::steady_clock::now();
+		drawFrame([&]() {
+			ImGui::Begin("Console (all lines)");
+			for (uint64_t sequence = history.getFirstSequence(); sequence < history.getEndSequence(); ++sequence) {
+				char buffer[LOG_MESSAGE_BYTES];
+				LogLine line = history.at(sequence);
+				std::string_view text = line.getText(buffer, sizeof(buffer));
+				ImGui::Text("Code: %d - Message: %.*s", line.severity, static_cast<int>(text.size()), text.data());
+			}
+			ImGui::End();
+		});
+		std::printf("  every line: %.1f ms\n",
+		            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+		ImGui::DestroyContext();
+		return 0;
+	}
+
+	// GomiEngine [--threaded-render] [--stress-actors <cantidad>] [--on-demand [ms máximos sin dibujar]] [--view-3d] [--hot-reload]
+	//            [--binary-log]
 	BaseApp app;
+	for (int i = 1; i < argc; ++i) {
+		std::string argument = argv[i];
+		if (argument == "--threaded-render") {
+			app.setThreadedRendering(true);
+		}
+		else if (argument == "--stress-actors" && i + 1 < argc) {
+			app.setStressActorCount(std::stoi(argv[++i]));
+		}
+		else if (argument == "--view-3d") {
+			app.setShow3DView(true);
+		}
+		else if (argument == "--hot-reload") {
+			app.setHotReload(true);
+		}
+		else if (argument == "--binary-log") {
+			app.setBinaryLog(true);
+		}
+		else if (argument == "--on-demand") {
+			app.setOnDemandRendering(true);
+			if (i + 1 < argc && std::isdigit(static_cast<unsigned char>(argv[i + 1][0]))) {
+				app.setMaxIdleInterval(std::stof(argv[++i]) / 1000.0f);
+			}
+		}
+	}
 	return app.run();
 }
\ No newline at end of file
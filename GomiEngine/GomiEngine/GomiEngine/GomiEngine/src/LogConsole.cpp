@@ -0,0 +1,173 @@
+#include "LogConsole.h"
+#include "Services/NotificationSystem.h"
+#include <chrono>
+#include <cstdio>
+
+namespace {
+
+// Mensajes que se revisan entre cada consulta del reloj al rehacer el índice.
+constexpr uint64_t INDEX_CLOCK_STRIDE = 64;
+
+const char* const SEVERITY_LABELS[3] = { "Normal", "Warning", "Error" };
+
+} // namespace
+
+void
+LogConsole::draw(const LogHistory& history) {
+    auto start = std::chrono::steady_clock::now();
+
+    if (!ImGui::Begin("Console")) {
+        ImGui::End();
+        m_lastDrawMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return;
+    }
+
+    bool filtersChanged = false;
+    for (int severity = 0; severity < 3; ++severity) {
+        if (severity > 0) {
+            ImGui::SameLine();
+        }
+        filtersChanged |= ImGui::Checkbox(SEVERITY_LABELS[severity], &m_showSeverity[severity]);
+    }
+    ImGui::SameLine();
+    filtersChanged |= m_filter.Draw("Filter", 180.0f);
+    if (filtersChanged) {
+        invalidateIndex();
+    }
+
+    bool paused = m_paused;
+    if (ImGui::Checkbox("Pause", &paused)) {
+        setPaused(paused, history);
+    }
+    ImGui::SameLine();
+    ImGui::Checkbox("Auto-scroll", &m_autoScroll);
+    ImGui::SameLine();
+    if (ImGui::Button("Clear")) {
+        m_clearedBefore = history.getEndSequence();
+        m_index.clear();
+        m_indexedEnd = m_clearedBefore;
+    }
+
+    uint64_t first = getStartSequence(history);
+    uint64_t end = m_paused ? std::max(m_pausedEnd, first) : history.getEndSequence();
+    if (isFiltered()) {
+        updateIndex(history);
+        m_rowCount = static_cast<size_t>(std::lower_bound(m_index.begin(), m_index.end(), end) - m_index.begin());
+    }
+    else {
+        m_rowCount = static_cast<size_t>(end - first);
+    }
+
+    ImGui::Text("%zu / %zu messages, %.2f ms", m_rowCount, history.size(), m_lastDrawMs);
+    if (!isIndexComplete(history)) {
+        uint64_t total = history.getEndSequence() - first;
+        ImGui::SameLine();
+        ImGui::Text("- Indexing %.0f%%", total > 0 ? 100.0 * (m_indexedEnd - first) / total : 100.0);
+    }
+    ImGui::Separator();
+
+    ImGui::BeginChild("ConsoleLines", ImVec2(0.0f, 0.0f), ImGuiChildFlags_None, ImGuiWindowFlags_HorizontalScrollbar);
+    drawLines(history, first);
+    // Como en el log de ImGui: solo se sigue el final si la vista ya estaba ahí.
+    if (m_autoScroll && !m_paused && ImGui::GetScrollY() >= ImGui::GetScrollMaxY()) {
+        ImGui::SetScrollHereY(1.0f);
+    }
+    ImGui::EndChild();
+    ImGui::End();
+
+    m_lastDrawMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void
+LogConsole::setFilter(const char* text, bool showNormal, bool showWarning, bool showError) {
+    std::snprintf(m_filter.InputBuf, sizeof(m_filter.InputBuf), "%s", text);
+    m_filter.Build();
+    m_showSeverity[ConsolErrorType::NORMAL] = showNormal;
+    m_showSeverity[ConsolErrorType::WARNING] = showWarning;
+    m_showSeverity[ConsolErrorType::ERROR] = showError;
+    invalidateIndex();
+}
+
+void
+LogConsole::setPaused(bool paused, const LogHistory& history) {
+    m_paused = paused;
+    m_pausedEnd = history.getEndSequence();
+}
+
+bool
+LogConsole::isFiltered() const {
+    return m_filter.IsActive() || !m_showSeverity[0] || !m_showSeverity[1] || !m_showSeverity[2];
+}
+
+bool
+LogConsole::matches(const LogLine& line) const {
+    int severity = static_cast<int>(line.severity);
+    if (severity >= 0 && severity < 3 && !m_showSeverity[severity]) {
+        return false;
+    }
+    if (!m_filter.IsActive()) {
+        return true;
+    }
+    char buffer[LOG_MESSAGE_BYTES];
+    std::string_view text = line.getText(buffer, sizeof(buffer));
+    return m_filter.PassFilter(text.data(), text.data() + text.size());
+}
+
+void
+LogConsole::invalidateIndex() {
+    m_index.clear();
+    m_indexedEnd = 0;
+}
+
+uint64_t
+LogConsole::getStartSequence(const LogHistory& history) const {
+    return std::max(history.getFirstSequence(), m_clearedBefore);
+}
+
+// Los mensajes nuevos de un fotograma normal caben de sobra en el presupuesto; solo una
+// reconstrucción (filtro nuevo sobre un historial grande) se reparte entre fotogramas.
+void
+LogConsole::updateIndex(const LogHistory& history) {
+    uint64_t first = getStartSequence(history);
+    while (!m_index.empty() && m_index.front() < first) {
+        m_index.pop_front();
+    }
+    if (m_indexedEnd < first) {
+        m_indexedEnd = first;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() +
+                    std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                        std::chrono::duration<float, std::milli>(m_indexBudgetMs));
+    uint64_t end = history.getEndSequence();
+    while (m_indexedEnd < end) {
+        uint64_t stop = std::min(end, m_indexedEnd + INDEX_CLOCK_STRIDE);
+        for (; m_indexedEnd < stop; ++m_indexedEnd) {
+            if (matches(history.at(m_indexedEnd))) {
+                m_index.push_back(m_indexedEnd);
+            }
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+    }
+}
+
+void
+LogConsole::drawLines(const LogHistory& history, uint64_t start) {
+    bool filtered = isFiltered();
+    char buffer[LOG_MESSAGE_BYTES];
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(m_rowCount));
+    while (clipper.Step()) {
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+            uint64_t sequence = filtered ? m_index[static_cast<size_t>(row)] : start + static_cast<uint64_t>(row);
+            LogLine line = history.at(sequence);
+            std::string_view text = line.getText(buffer, sizeof(buffer));
+            ImGui::TextColored(NotificationService::getInstance().getColorForSeverity(line.severity),
+                               "[%.3f ms] [T%u] [%s] %.*s", line.timestampNs / 1e6, line.threadId, line.source,
+                               static_cast<int>(text.size()), text.data());
+        }
+    }
+    clipper.End();
+}
@@ -0,0 +1,328 @@
+#include "LogSink.h"
+#include "Services/NotificationSystem.h"
+#include <csignal>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+
+std::atomic<LogSink*> LogSink::s_active{ nullptr };
+
+namespace {
+
+// Espacio libre con el que se escribe el búfer antes de agregar otro mensaje.
+constexpr size_t MAX_LINE_BYTES = LOG_MESSAGE_BYTES + 256;
+
+// Intentos de tomar el candado del sink durante un fallo fatal (1 ms cada uno).
+constexpr int FATAL_LOCK_ATTEMPTS = 100;
+
+const int FATAL_SIGNALS[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+
+std::once_flag g_handlersInstalled;
+std::terminate_handler g_previousTerminate = nullptr;
+
+// "LogData.txt" -> "LogData.<index>.txt"; el índice 0 es el archivo actual.
+std::string
+rotatedPath(const std::string& path, int index) {
+    if (index == 0) {
+        return path;
+    }
+    std::filesystem::path original(path);
+    std::filesystem::path rotated = original.parent_path() / original.stem();
+    return rotated.string() + "." + std::to_string(index) + original.extension().string();
+}
+
+} // namespace
+
+LogSink::LogSink() = default;
+
+LogSink::~LogSink() {
+    stop();
+}
+
+// La ejecución anterior queda en "<nombre>.1<ext>" para poder leerla después de un fallo.
+bool
+LogSink::start(const std::string& path, size_t maxFileBytes, int maxFiles, LogFileFormat format) {
+    LogSink* expected = nullptr;
+    if (!s_active.compare_exchange_strong(expected, this)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_path = path;
+    m_maxFileBytes = maxFileBytes;
+    m_maxFiles = maxFiles < 1 ? 1 : maxFiles;
+    m_format = format;
+    m_stats = LogSinkStats();
+    m_buffer.resize(BUFFER_SIZE);
+    m_used = 0;
+    std::error_code error;
+    bool opened = std::filesystem::file_size(path, error) > 0 && !error ? rotate() : openFile();
+    if (!opened) {
+        s_active.store(nullptr);
+        return false;
+    }
+
+    std::call_once(g_handlersInstalled, []() {
+        std::atexit(&LogSink::onExit);
+        g_previousTerminate = std::set_terminate(&LogSink::onTerminate);
+        for (int value : FATAL_SIGNALS) {
+            std::signal(value, &LogSink::onSignal);
+        }
+    });
+
+    NotificationService::getInstance().setExternalConsumer(true);
+    m_running.store(true);
+    m_thread = std::thread([this]() { run(); });
+    return true;
+}
+
+void
+LogSink::stop() {
+    if (!m_running.exchange(false)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+    }
+    m_wake.notify_all();
+    m_thread.join();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    while (drainBatch(true) > 0) {
+    }
+    NotificationService::getInstance().setExternalConsumer(false);
+    std::fclose(m_file);
+    m_file = nullptr;
+    s_active.store(nullptr);
+}
+
+void
+LogSink::flush() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_file == nullptr) {
+        return;
+    }
+    while (drainBatch(true) > 0) {
+    }
+}
+
+LogSinkStats
+LogSink::getStats() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+// Mientras haya mensajes saca lotes seguidos; sin mensajes duerme hasta `m_pollIntervalMs`.
+void
+LogSink::run() {
+    while (m_running.load()) {
+        size_t count = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            count = drainBatch(true);
+        }
+        if (count == 0) {
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            m_wake.wait_for(lock, std::chrono::duration<float, std::milli>(m_pollIntervalMs),
+                            [this]() { return !m_running.load(); });
+        }
+    }
+}
+
+// Una escritura por lote (o por búfer lleno); las entregas a la consola también van por lote.
+size_t
+LogSink::drainBatch(bool deliver) {
+    NotificationService& notifier = NotificationService::getInstance();
+    size_t count = notifier.drain([this, deliver](const LogRecord& record) {
+        // Solo el archivo de texto necesita el mensaje formateado; al historial va sin formatear
+        // y la consola arma únicamente las líneas que muestra.
+        char message[LOG_MESSAGE_BYTES];
+        if (m_format == LogFileFormat::TEXT) {
+            formatLogMessage(record, message, sizeof(message));
+        }
+        append(record, message);
+        if (deliver) {
+            m_delivery.push_back(record);
+        }
+    }, BATCH_SIZE);
+    writeBuffer();
+    if (!m_delivery.empty()) {
+        notifier.deliver(m_delivery);
+    }
+    return count;
+}
+
+// La rotación se decide aquí, entre mensajes, para que un archivo binario nunca quede con
+// mensajes cuyos formatos se escribieron en el anterior.
+void
+LogSink::append(const LogRecord& record, const char* message) {
+    if (m_fileBytes + m_used >= m_maxFileBytes) {
+        writeBuffer();
+        if (!rotate()) {
+            return;
+        }
+    }
+    if (m_buffer.size() - m_used < MAX_LINE_BYTES) {
+        writeBuffer();
+    }
+    if (m_format == LogFileFormat::BINARY) {
+        appendBinary(record);
+    }
+    else {
+        m_used += formatLogLine(m_buffer.data() + m_used, m_buffer.size() - m_used, record.timestampNs,
+                                record.threadId, record.source, record.severity, message);
+    }
+    ++m_stats.records;
+}
+
+void
+LogSink::appendBinary(const LogRecord& record) {
+    uint32_t formatId = 0;
+    if (record.format != nullptr) {
+        const LogFormat& format = *record.format;
+        formatId = format.id.load(std::memory_order_relaxed);
+        if (formatId >= m_writtenFormats.size()) {
+            m_writtenFormats.resize(formatId + 1, false);
+        }
+        if (!m_writtenFormats[formatId]) {
+            m_writtenFormats[formatId] = true;
+            uint32_t severity = static_cast<uint32_t>(format.severity);
+            int32_t line = format.line;
+            uint16_t sourceLength = static_cast<uint16_t>(std::min<size_t>(std::strlen(format.source), 256));
+            uint16_t fileLength = static_cast<uint16_t>(std::min<size_t>(std::strlen(format.file), 256));
+            uint16_t formatLength = static_cast<uint16_t>(std::min<size_t>(std::strlen(format.format), 256));
+            char* entry = reserve(1 + 3 * 4 + 3 * 2 + sourceLength + fileLength + formatLength);
+            *entry++ = static_cast<char>(BinaryLog::ENTRY_FORMAT);
+            std::memcpy(entry, &formatId, 4);
+            std::memcpy(entry + 4, &severity, 4);
+            std::memcpy(entry + 8, &line, 4);
+            std::memcpy(entry + 12, &sourceLength, 2);
+            std::memcpy(entry + 14, &fileLength, 2);
+            std::memcpy(entry + 16, &formatLength, 2);
+            entry += 18;
+            std::memcpy(entry, format.source, sourceLength);
+            std::memcpy(entry + sourceLength, format.file, fileLength);
+            std::memcpy(entry + sourceLength + fileLength, format.format, formatLength);
+        }
+    }
+
+    uint8_t severity = static_cast<uint8_t>(record.severity);
+    uint16_t dataLength = static_cast<uint16_t>(record.length);
+    uint16_t sourceLength = formatId == 0 ? static_cast<uint16_t>(std::min<size_t>(std::strlen(record.source), 256)) : 0;
+    char* entry = reserve(1 + 8 + 4 + 1 + 4 + 2 + (formatId == 0 ? 2 + sourceLength : 0) + dataLength);
+    *entry++ = static_cast<char>(BinaryLog::ENTRY_RECORD);
+    std::memcpy(entry, &record.timestampNs, 8);
+    std::memcpy(entry + 8, &record.threadId, 4);
+    std::memcpy(entry + 12, &severity, 1);
+    std::memcpy(entry + 13, &formatId, 4);
+    std::memcpy(entry + 17, &dataLength, 2);
+    entry += 19;
+    if (formatId == 0) {
+        std::memcpy(entry, &sourceLength, 2);
+        std::memcpy(entry + 2, record.source, sourceLength);
+        entry += 2 + sourceLength;
+    }
+    std::memcpy(entry, record.text, dataLength);
+}
+
+char*
+LogSink::reserve(size_t size) {
+    char* bytes = m_buffer.data() + m_used;
+    m_used += size;
+    return bytes;
+}
+
+void
+LogSink::writeBuffer() {
+    if (m_used == 0 || m_file == nullptr) {
+        m_used = 0;
+        return;
+    }
+    size_t written = std::fwrite(m_buffer.data(), 1, m_used, m_file);
+    m_fileBytes += written;
+    m_stats.bytes += written;
+    ++m_stats.writes;
+    m_used = 0;
+}
+
+bool
+LogSink::openFile() {
+    m_file = std::fopen(m_path.c_str(), "wb");
+    if (m_file == nullptr) {
+        return false;
+    }
+    std::setvbuf(m_file, nullptr, _IONBF, 0);
+    m_fileBytes = 0;
+    m_writtenFormats.clear();
+    if (m_format == LogFileFormat::BINARY) {
+        char header[8];
+        std::memcpy(header, BinaryLog::MAGIC, 4);
+        std::memcpy(header + 4, &BinaryLog::VERSION, 4);
+        m_fileBytes = std::fwrite(header, 1, sizeof(header), m_file);
+    }
+    return true;
+}
+
+bool
+LogSink::rotate() {
+    if (m_file != nullptr) {
+        std::fclose(m_file);
+        m_file = nullptr;
+    }
+    std::error_code error;
+    for (int index = m_maxFiles - 1; index > 0; --index) {
+        std::filesystem::remove(rotatedPath(m_path, index), error);
+        std::filesystem::rename(rotatedPath(m_path, index - 1), rotatedPath(m_path, index), error);
+    }
+    if (!openFile()) {
+        return false;
+    }
+    ++m_stats.rotations;
+    return true;
+}
+
+// Si el candado no se libera (el fallo ocurrió dentro del sink) se termina sin escribir.
+void
+LogSink::flushActive() {
+    LogSink* sink = s_active.load();
+    if (sink == nullptr) {
+        return;
+    }
+    for (int attempt = 0; attempt < FATAL_LOCK_ATTEMPTS; ++attempt) {
+        if (sink->m_mutex.try_lock()) {
+            if (sink->m_file != nullptr) {
+                while (sink->drainBatch(false) > 0) {
+                }
+            }
+            sink->m_mutex.unlock();
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+// `exit` (p. ej. desde la macro ERROR) no destruye a quien es dueño del sink: se detiene aquí,
+// antes de que se destruya NotificationService.
+void
+LogSink::onExit() {
+    LogSink* sink = s_active.load();
+    if (sink != nullptr && sink->m_thread.get_id() != std::this_thread::get_id()) {
+        sink->stop();
+    }
+}
+
+void
+LogSink::onTerminate() {
+    flushActive();
+    if (g_previousTerminate != nullptr) {
+        g_previousTerminate();
+    }
+    std::abort();
+}
+
+void
+LogSink::onSignal(int value) {
+    flushActive();
+    std::signal(value, SIG_DFL);
+    std::raise(value);
+}
@@ -0,0 +1,207 @@
+#include "Mesh.h"
+#include "Hash.h"
+#include "SoftwareRenderer3D.h"
+#include "Services/NotificationSystem.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+namespace {
+
+/**
+ * @brief Encabezado de la caché `.gmesh`; los vértices empiezan justo después.
+ */
+struct MeshCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t vertexCount;
+    uint64_t indexCount;
+    uint64_t sourceHash;
+    float boundsMin[3];
+    float boundsMax[3];
+    uint32_t vertexSize;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(MeshCacheHeader) == Mesh::CACHE_HEADER_SIZE, "Unexpected mesh cache header size");
+static_assert(sizeof(MeshVertex) == 32, "MeshVertex must stay tightly packed");
+
+} // namespace
+
+// Usa la caché si sigue vigente; si no, lee el OBJ y la regenera para la próxima vez.
+bool
+Mesh::load(const std::string& objPath) {
+    std::string cachePath = getCachePath(objPath);
+    if (loadCache(cachePath, objPath)) {
+        return true;
+    }
+    if (!loadFromObj(objPath)) {
+        return false;
+    }
+    if (!saveCache(cachePath, objPath)) {
+        NotificationService::getInstance().addMessage(ConsolErrorType::WARNING,
+            "Mesh: could not write cache " + cachePath);
+    }
+    return true;
+}
+
+// Lee el OBJ a búferes propios.
+bool
+Mesh::loadFromObj(const std::string& path, bool parallel) {
+    ObjLoader loader;
+    loader.setParallel(parallel);
+    MeshData data;
+    if (!loader.loadFromFile(path, data)) {
+        NotificationService::getInstance().addMessage(ConsolErrorType::ERROR, loader.getError());
+        return false;
+    }
+    if (loader.getSkippedLineCount() > 0) {
+        NotificationService::getInstance().addMessage(ConsolErrorType::WARNING,
+            "Mesh: skipped " + std::to_string(loader.getSkippedLineCount()) + " malformed lines in " + path);
+    }
+    m_data = std::move(data);
+    adoptOwnedData();
+    return true;
+}
+
+// Valida el encabezado y apunta a los datos proyectados.
+bool
+Mesh::loadCache(const std::string& cachePath, const std::string& sourcePath) {
+    std::unique_ptr<MappedFile> file(new MappedFile());
+    if (!file->open(cachePath) || file->size() < CACHE_HEADER_SIZE) {
+        return false;
+    }
+    MeshCacheHeader header;
+    std::memcpy(&header, file->data(), sizeof(header));
+    if (header.magic != CACHE_MAGIC || header.version != CACHE_VERSION ||
+        header.vertexSize != sizeof(MeshVertex) || header.indexCount % 3 != 0) {
+        return false;
+    }
+    // Conteos imposibles para el tamaño del archivo se descartan antes de multiplicarlos.
+    if (header.vertexCount > file->size() / sizeof(MeshVertex) || header.indexCount > file->size() / sizeof(uint32_t)) {
+        return false;
+    }
+    uint64_t expectedSize = CACHE_HEADER_SIZE + header.vertexCount * sizeof(MeshVertex) +
+                            header.indexCount * sizeof(uint32_t);
+    if (expectedSize != file->size()) {
+        return false;
+    }
+    // Sin el OBJ de origen (p. ej. solo se distribuye la caché) no hay nada contra qué comparar.
+    std::error_code error;
+    if (!sourcePath.empty() && std::filesystem::exists(sourcePath, error) &&
+        computeSourceHash(sourcePath) != header.sourceHash) {
+        return false;
+    }
+
+    // Una caché corrupta podría apuntar fuera de los vértices: se rechaza y se reconstruye del OBJ.
+    const char* payload = file->data() + CACHE_HEADER_SIZE;
+    const uint32_t* indices = reinterpret_cast<const uint32_t*>(payload + header.vertexCount * sizeof(MeshVertex));
+    for (uint64_t i = 0; i < header.indexCount; ++i) {
+        if (indices[i] >= header.vertexCount) {
+            NotificationService::getInstance().addMessage(ConsolErrorType::WARNING,
+                "Mesh: cache " + cachePath + " has an index out of range, rebuilding");
+            return false;
+        }
+    }
+
+    m_data = MeshData();
+    m_vertexData = reinterpret_cast<const MeshVertex*>(payload);
+    m_indexData = indices;
+    m_vertexCount = static_cast<size_t>(header.vertexCount);
+    m_indexCount = static_cast<size_t>(header.indexCount);
+    m_boundsMin = Vector3(header.boundsMin[0], header.boundsMin[1], header.boundsMin[2]);
+    m_boundsMax = Vector3(header.boundsMax[0], header.boundsMax[1], header.boundsMax[2]);
+    m_cacheFile = std::move(file);
+    return true;
+}
+
+// Escribe el encabezado y los búferes tal como están en memoria.
+bool
+Mesh::saveCache(const std::string& cachePath, const std::string& sourcePath) const {
+    MeshCacheHeader header = {};
+    header.magic = CACHE_MAGIC;
+    header.version = CACHE_VERSION;
+    header.vertexCount = m_vertexCount;
+    header.indexCount = m_indexCount;
+    header.sourceHash = computeSourceHash(sourcePath);
+    header.boundsMin[0] = m_boundsMin.x;
+    header.boundsMin[1] = m_boundsMin.y;
+    header.boundsMin[2] = m_boundsMin.z;
+    header.boundsMax[0] = m_boundsMax.x;
+    header.boundsMax[1] = m_boundsMax.y;
+    header.boundsMax[2] = m_boundsMax.z;
+    header.vertexSize = sizeof(MeshVertex);
+
+    std::ofstream file(cachePath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(m_vertexData), m_vertexCount * sizeof(MeshVertex));
+    file.write(reinterpret_cast<const char*>(m_indexData), m_indexCount * sizeof(uint32_t));
+    return static_cast<bool>(file);
+}
+
+// Mapea cada normal de [-1, 1] a un color de [0, 255].
+void
+Mesh::appendTriangles(std::vector<Vertex3D>& out) const {
+    out.reserve(out.size() + m_indexCount);
+    for (size_t i = 0; i < m_indexCount; ++i) {
+        const MeshVertex& source = m_vertexData[m_indexData[i]];
+        Vertex3D vertex;
+        vertex.position = Vector3(source.position[0], source.position[1], source.position[2]);
+        vertex.color = sf::Color(static_cast<sf::Uint8>((source.normal[0] * 0.5f + 0.5f) * 255.0f),
+                                 static_cast<sf::Uint8>((source.normal[1] * 0.5f + 0.5f) * 255.0f),
+                                 static_cast<sf::Uint8>((source.normal[2] * 0.5f + 0.5f) * 255.0f));
+        out.push_back(vertex);
+    }
+}
+
+// Combina nombre, tamaño y fecha del OBJ, igual que la caché del atlas.
+unsigned long long
+Mesh::computeSourceHash(const std::string& sourcePath) {
+    std::error_code error;
+    unsigned long long fileSize = std::filesystem::file_size(sourcePath, error);
+    if (error) {
+        fileSize = 0;
+    }
+    long long writeTime = 0;
+    auto lastWrite = std::filesystem::last_write_time(sourcePath, error);
+    if (!error) {
+        writeTime = static_cast<long long>(lastWrite.time_since_epoch().count());
+    }
+
+    std::string name = std::filesystem::path(sourcePath).filename().string();
+    unsigned long long hash = EngineUtilities::hashFNV1a(name.data(), name.size());
+    hash = EngineUtilities::hashFNV1a(&fileSize, sizeof(fileSize), hash);
+    hash = EngineUtilities::hashFNV1a(&writeTime, sizeof(writeTime), hash);
+    return hash;
+}
+
+// Suelta la caché proyectada y recalcula la caja envolvente de los búferes propios.
+void
+Mesh::adoptOwnedData() {
+    m_cacheFile.reset();
+    m_vertexData = m_data.vertices.data();
+    m_indexData = m_data.indices.data();
+    m_vertexCount = m_data.vertices.size();
+    m_indexCount = m_data.indices.size();
+
+    if (m_data.vertices.empty()) {
+        m_boundsMin = Vector3();
+        m_boundsMax = Vector3();
+        return;
+    }
+    float low[3], high[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        low[axis] = high[axis] = m_data.vertices[0].position[axis];
+    }
+    for (const MeshVertex& vertex : m_data.vertices) {
+        for (int axis = 0; axis < 3; ++axis) {
+            low[axis] = std::min(low[axis], vertex.position[axis]);
+            high[axis] = std::max(high[axis], vertex.position[axis]);
+        }
+    }
+    m_boundsMin = Vector3(low[0], low[1], low[2]);
+    m_boundsMax = Vector3(high[0], high[1], high[2]);
+}
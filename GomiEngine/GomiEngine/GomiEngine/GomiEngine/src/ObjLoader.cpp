@@ -0,0 +1,544 @@
+#include "ObjLoader.h"
+#include "MappedFile.h"
+#include "Services/JobSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+constexpr int32_t MISSING_INDEX = INT32_MIN;     ///< Esquina sin textura o sin normal.
+constexpr uint32_t EMPTY_SLOT = 0xFFFFFFFFu;     ///< Casilla libre de la tabla hash.
+constexpr uint32_t RELATIVE_POSITION = 1u << 0;  ///< El índice es relativo al inicio del bloque.
+constexpr uint32_t RELATIVE_TEXCOORD = 1u << 1;
+constexpr uint32_t RELATIVE_NORMAL = 1u << 2;
+
+/**
+ * @brief Esquina de una cara. Mientras se lee, los índices negativos del archivo se guardan
+ * relativos al inicio del bloque (con su bandera); al unir los bloques todos quedan absolutos.
+ */
+struct Corner {
+    int32_t position;
+    int32_t texCoord;
+    int32_t normal;
+    uint32_t relative;
+};
+
+/**
+ * @brief Datos leídos de un bloque de líneas.
+ */
+struct ObjChunk {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    std::vector<float> positions;  ///< Tres por posición.
+    std::vector<float> texCoords;  ///< Dos por coordenada.
+    std::vector<float> normals;    ///< Tres por normal.
+    std::vector<Corner> corners;   ///< Tres por triángulo.
+    std::vector<Corner> polygon;   ///< Cara en proceso (se reutiliza entre líneas).
+    size_t skippedLines = 0;
+    bool invalidIndex = false;
+};
+
+const double POWERS_OF_TEN[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+inline bool
+isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+inline const char*
+skipBlanks(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+        ++p;
+    }
+    return p;
+}
+
+inline const char*
+findLineEnd(const char* p, const char* end) {
+    const void* newline = std::memchr(p, '\n', static_cast<size_t>(end - p));
+    return newline != nullptr ? static_cast<const char*>(newline) : end;
+}
+
+/**
+ * @brief Lee un número decimal (con signo, fracción y exponente opcionales). Acumula hasta 19
+ * dígitos significativos en un entero y escala una sola vez, suficiente para precisión float.
+ */
+bool
+parseFloat(const char*& cursor, const char* end, float& out) {
+    const char* p = skipBlanks(cursor, end);
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        ++p;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    bool anyDigit = false;
+    for (; p < end && isDigit(*p); ++p) {
+        anyDigit = true;
+        if (digits < 19) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+            digits += mantissa != 0 ? 1 : 0;
+        }
+        else {
+            ++exponent;
+        }
+    }
+    if (p < end && *p == '.') {
+        for (++p; p < end && isDigit(*p); ++p) {
+            anyDigit = true;
+            if (digits < 19) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                digits += mantissa != 0 ? 1 : 0;
+                --exponent;
+            }
+        }
+    }
+    if (!anyDigit) {
+        return false;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char* e = p + 1;
+        bool negativeExponent = false;
+        if (e < end && (*e == '-' || *e == '+')) {
+            negativeExponent = *e == '-';
+            ++e;
+        }
+        if (e < end && isDigit(*e)) {
+            int value = 0;
+            for (; e < end && isDigit(*e); ++e) {
+                value = value < 10000 ? value * 10 + (*e - '0') : value;
+            }
+            exponent += negativeExponent ? -value : value;
+            p = e;
+        }
+    }
+
+    double value = static_cast<double>(mantissa);
+    int magnitude = exponent < 0 ? -exponent : exponent;
+    double scale = magnitude <= 22 ? POWERS_OF_TEN[magnitude] : std::pow(10.0, magnitude);
+    value = exponent < 0 ? value / scale : value * scale;
+    out = static_cast<float>(negative ? -value : value);
+    cursor = p;
+    return true;
+}
+
+/**
+ * @brief Lee un índice de OBJ (entero distinto de cero, negativo si es relativo).
+ */
+bool
+parseIndex(const char*& cursor, const char* end, long long& out) {
+    const char* p = cursor;
+    bool negative = false;
+    if (p < end && *p == '-') {
+        negative = true;
+        ++p;
+    }
+    if (p >= end || !isDigit(*p)) {
+        return false;
+    }
+    long long value = 0;
+    for (; p < end && isDigit(*p); ++p) {
+        value = value < (1ll << 40) ? value * 10 + (*p - '0') : value;
+    }
+    if (value == 0) {
+        return false;
+    }
+    out = negative ? -value : value;
+    cursor = p;
+    return true;
+}
+
+/**
+ * @brief Convierte un índice del archivo al formato de `Corner`.
+ * @param localCount Elementos de ese tipo leídos hasta ahora en el bloque.
+ */
+inline int32_t
+encodeIndex(long long value, size_t localCount, uint32_t relativeFlag, uint32_t& relative) {
+    if (value > 0) {
+        return value - 1 <= INT32_MAX - 1 ? static_cast<int32_t>(value - 1) : INT32_MAX;
+    }
+    relative |= relativeFlag;
+    long long local = static_cast<long long>(localCount) + value;
+    return local > INT32_MIN ? static_cast<int32_t>(local) : INT32_MIN + 1;
+}
+
+/**
+ * @brief Lee los floats de una línea `v`, `vt` o `vn`. Los que falten valen 0, así la numeración
+ * de los elementos sigue siendo la del archivo aunque la línea esté mal formada.
+ */
+void
+parseVector(const char* p, const char* lineEnd, int required, int count,
+            std::vector<float>& out, size_t& skippedLines) {
+    bool valid = true;
+    for (int i = 0; i < count; ++i) {
+        float value = 0.0f;
+        if (!parseFloat(p, lineEnd, value) && i < required) {
+            valid = false;
+        }
+        out.push_back(value);
+    }
+    if (!valid) {
+        ++skippedLines;
+    }
+}
+
+/**
+ * @brief Lee una línea `f` y la divide en triángulos en abanico.
+ */
+void
+parseFace(ObjChunk& chunk, const char* p, const char* lineEnd) {
+    const size_t positionCount = chunk.positions.size() / 3;
+    const size_t texCoordCount = chunk.texCoords.size() / 2;
+    const size_t normalCount = chunk.normals.size() / 3;
+
+    chunk.polygon.clear();
+    for (;;) {
+        p = skipBlanks(p, lineEnd);
+        if (p >= lineEnd || *p == '#') {
+            break;
+        }
+
+        Corner corner{ 0, MISSING_INDEX, MISSING_INDEX, 0 };
+        long long value = 0;
+        if (!parseIndex(p, lineEnd, value)) {
+            ++chunk.skippedLines;
+            return;
+        }
+        corner.position = encodeIndex(value, positionCount, RELATIVE_POSITION, corner.relative);
+        if (p < lineEnd && *p == '/') {
+            ++p;
+            if (p < lineEnd && *p != '/') {
+                if (!parseIndex(p, lineEnd, value)) {
+                    ++chunk.skippedLines;
+                    return;
+                }
+                corner.texCoord = encodeIndex(value, texCoordCount, RELATIVE_TEXCOORD, corner.relative);
+            }
+            if (p < lineEnd && *p == '/') {
+                ++p;
+                if (!parseIndex(p, lineEnd, value)) {
+                    ++chunk.skippedLines;
+                    return;
+                }
+                corner.normal = encodeIndex(value, normalCount, RELATIVE_NORMAL, corner.relative);
+            }
+        }
+        if (p < lineEnd && *p != ' ' && *p != '\t' && *p != '\r') {
+            ++chunk.skippedLines;
+            return;
+        }
+        chunk.polygon.push_back(corner);
+    }
+
+    if (chunk.polygon.size() < 3) {
+        ++chunk.skippedLines;
+        return;
+    }
+    for (size_t i = 1; i + 1 < chunk.polygon.size(); ++i) {
+        chunk.corners.push_back(chunk.polygon[0]);
+        chunk.corners.push_back(chunk.polygon[i]);
+        chunk.corners.push_back(chunk.polygon[i + 1]);
+    }
+}
+
+/**
+ * @brief Lee todas las líneas de un bloque.
+ */
+void
+parseChunk(ObjChunk& chunk) {
+    // Reserva aproximada: una línea típica de OBJ ocupa unos 30 bytes.
+    size_t estimatedLines = static_cast<size_t>(chunk.end - chunk.begin) / 30;
+    chunk.positions.reserve(estimatedLines * 3 / 2);
+    chunk.corners.reserve(estimatedLines * 3);
+
+    const char* p = chunk.begin;
+    while (p < chunk.end) {
+        const char* lineEnd = findLineEnd(p, chunk.end);
+        const char* line = skipBlanks(p, lineEnd);
+        p = lineEnd + 1;
+        if (lineEnd - line < 2) {
+            continue;
+        }
+        char next = line[1];
+        if (line[0] == 'v') {
+            if (next == ' ' || next == '\t') {
+                parseVector(line + 2, lineEnd, 3, 3, chunk.positions, chunk.skippedLines);
+            }
+            else if (next == 't') {
+                parseVector(line + 2, lineEnd, 1, 2, chunk.texCoords, chunk.skippedLines);
+            }
+            else if (next == 'n') {
+                parseVector(line + 2, lineEnd, 3, 3, chunk.normals, chunk.skippedLines);
+            }
+        }
+        else if (line[0] == 'f' && (next == ' ' || next == '\t')) {
+            parseFace(chunk, line + 2, lineEnd);
+        }
+    }
+}
+
+/**
+ * @brief Convierte un índice de `Corner` en absoluto y revisa que exista.
+ */
+inline bool
+resolveIndex(int32_t& index, bool relative, size_t offset, size_t total) {
+    if (index == MISSING_INDEX) {
+        return true;
+    }
+    long long absolute = relative ? static_cast<long long>(offset) + index : index;
+    if (absolute < 0 || absolute >= static_cast<long long>(total)) {
+        return false;
+    }
+    index = static_cast<int32_t>(absolute);
+    return true;
+}
+
+inline uint64_t
+hashCorner(const Corner& corner) {
+    uint64_t hash = static_cast<uint32_t>(corner.position) * 0x9E3779B97F4A7C15ull;
+    hash ^= static_cast<uint32_t>(corner.texCoord) * 0xC2B2AE3D27D4EB4Full;
+    hash ^= static_cast<uint32_t>(corner.normal) * 0x165667B19E3779F9ull;
+    return hash ^ (hash >> 29);
+}
+
+inline bool
+sameCorner(const Corner& a, const Corner& b) {
+    return a.position == b.position && a.texCoord == b.texCoord && a.normal == b.normal;
+}
+
+} // namespace
+
+// Proyecta el archivo y lo lee sin copiarlo.
+bool
+ObjLoader::loadFromFile(const std::string& path, MeshData& mesh) {
+    MappedFile file;
+    if (!file.open(path)) {
+        m_error = "OBJ: could not open " + path;
+        return false;
+    }
+    return parse(file.data(), file.size(), mesh);
+}
+
+// Lee por bloques, une los resultados, funde vértices repetidos y completa las normales.
+bool
+ObjLoader::parse(const char* data, size_t size, MeshData& mesh) {
+    JobSystem& jobs = JobSystem::getInstance();
+    m_error.clear();
+    mesh.vertices.clear();
+    mesh.indices.clear();
+
+    // 1. Divide el archivo en bloques que terminan en salto de línea.
+    size_t chunkCount = 1;
+    if (m_parallel && size >= 2 * PARALLEL_CHUNK_SIZE) {
+        size_t maxChunks = (jobs.getWorkerCount() + 1) * 4;
+        chunkCount = std::min(size / PARALLEL_CHUNK_SIZE, maxChunks);
+    }
+    std::vector<ObjChunk> chunks(chunkCount);
+    const char* end = data + size;
+    const char* cursor = data;
+    for (size_t i = 0; i < chunkCount; ++i) {
+        chunks[i].begin = cursor;
+        if (i + 1 == chunkCount) {
+            cursor = end;
+        }
+        else {
+            const char* target = std::max(cursor, data + size * (i + 1) / chunkCount);
+            const char* lineEnd = findLineEnd(target, end);
+            cursor = lineEnd < end ? lineEnd + 1 : end;
+        }
+        chunks[i].end = cursor;
+    }
+    m_chunkCount = chunkCount;
+
+    jobs.parallelFor(chunkCount, [&](size_t i) { parseChunk(chunks[i]); });
+
+    // 2. Une posiciones, coordenadas y normales; cada bloque conoce su desplazamiento.
+    std::vector<size_t> positionOffsets(chunkCount), texCoordOffsets(chunkCount),
+        normalOffsets(chunkCount), cornerOffsets(chunkCount);
+    size_t positionTotal = 0, texCoordTotal = 0, normalTotal = 0, cornerTotal = 0;
+    m_skippedLines = 0;
+    for (size_t i = 0; i < chunkCount; ++i) {
+        positionOffsets[i] = positionTotal;
+        texCoordOffsets[i] = texCoordTotal;
+        normalOffsets[i] = normalTotal;
+        cornerOffsets[i] = cornerTotal;
+        positionTotal += chunks[i].positions.size() / 3;
+        texCoordTotal += chunks[i].texCoords.size() / 2;
+        normalTotal += chunks[i].normals.size() / 3;
+        cornerTotal += chunks[i].corners.size();
+        m_skippedLines += chunks[i].skippedLines;
+    }
+    m_positionCount = positionTotal;
+    m_triangleCount = cornerTotal / 3;
+    if (cornerTotal >= EMPTY_SLOT || positionTotal >= static_cast<size_t>(INT32_MAX)) {
+        m_error = "OBJ: mesh too large";
+        return false;
+    }
+
+    std::vector<float> positions(positionTotal * 3);
+    std::vector<float> texCoords(texCoordTotal * 2);
+    std::vector<float> normals(normalTotal * 3);
+    jobs.parallelFor(chunkCount, [&](size_t i) {
+        ObjChunk& chunk = chunks[i];
+        std::copy(chunk.positions.begin(), chunk.positions.end(), positions.begin() + positionOffsets[i] * 3);
+        std::copy(chunk.texCoords.begin(), chunk.texCoords.end(), texCoords.begin() + texCoordOffsets[i] * 2);
+        std::copy(chunk.normals.begin(), chunk.normals.end(), normals.begin() + normalOffsets[i] * 3);
+        for (Corner& corner : chunk.corners) {
+            bool valid = resolveIndex(corner.position, (corner.relative & RELATIVE_POSITION) != 0,
+                                      positionOffsets[i], positionTotal) &&
+                         resolveIndex(corner.texCoord, (corner.relative & RELATIVE_TEXCOORD) != 0,
+                                      texCoordOffsets[i], texCoordTotal) &&
+                         resolveIndex(corner.normal, (corner.relative & RELATIVE_NORMAL) != 0,
+                                      normalOffsets[i], normalTotal);
+            if (!valid) {
+                chunk.invalidIndex = true;
+                break;
+            }
+        }
+    });
+    for (const ObjChunk& chunk : chunks) {
+        if (chunk.invalidIndex) {
+            m_error = "OBJ: face index out of range";
+            return false;
+        }
+    }
+
+    // 3. Funde las esquinas iguales. Casi todas las posiciones terminan en un solo vértice, así que
+    // el primer vértice de cada posición se busca directo en `firstVertex`; solo las variantes
+    // (otra textura u otra normal en la misma posición) pasan por la tabla hash de
+    // direccionamiento abierto con sondeo lineal.
+    std::vector<uint32_t> firstVertex(positionTotal, EMPTY_SLOT);
+    size_t capacity = 1024;
+    size_t tableCount = 0;
+    std::vector<uint32_t> table(capacity, EMPTY_SLOT);
+    std::vector<Corner> uniqueCorners;
+    uniqueCorners.reserve(positionTotal + positionTotal / 4);
+    mesh.indices.resize(cornerTotal);
+    uint32_t* outIndex = mesh.indices.data();
+    for (const ObjChunk& chunk : chunks) {
+        for (const Corner& corner : chunk.corners) {
+            uint32_t& first = firstVertex[static_cast<size_t>(corner.position)];
+            if (first == EMPTY_SLOT) {
+                first = static_cast<uint32_t>(uniqueCorners.size());
+                uniqueCorners.push_back(corner);
+                *outIndex++ = first;
+                continue;
+            }
+            if (sameCorner(uniqueCorners[first], corner)) {
+                *outIndex++ = first;
+                continue;
+            }
+
+            if ((tableCount + 1) * 2 > capacity) {
+                capacity *= 2;
+                std::vector<uint32_t> grown(capacity, EMPTY_SLOT);
+                for (uint32_t vertex : table) {
+                    if (vertex == EMPTY_SLOT) {
+                        continue;
+                    }
+                    size_t slot = hashCorner(uniqueCorners[vertex]) & (capacity - 1);
+                    while (grown[slot] != EMPTY_SLOT) {
+                        slot = (slot + 1) & (capacity - 1);
+                    }
+                    grown[slot] = vertex;
+                }
+                table.swap(grown);
+            }
+            size_t slot = hashCorner(corner) & (capacity - 1);
+            while (table[slot] != EMPTY_SLOT && !sameCorner(uniqueCorners[table[slot]], corner)) {
+                slot = (slot + 1) & (capacity - 1);
+            }
+            if (table[slot] == EMPTY_SLOT) {
+                table[slot] = static_cast<uint32_t>(uniqueCorners.size());
+                uniqueCorners.push_back(corner);
+                ++tableCount;
+            }
+            *outIndex++ = table[slot];
+        }
+    }
+    std::vector<uint32_t>().swap(firstVertex);
+    std::vector<uint32_t>().swap(table);
+    for (ObjChunk& chunk : chunks) {
+        std::vector<Corner>().swap(chunk.corners);
+    }
+
+    // 4. Construye los vértices intercalados.
+    mesh.vertices.resize(uniqueCorners.size());
+    const size_t blockSize = 16384;
+    const size_t blockCount = (uniqueCorners.size() + blockSize - 1) / blockSize;
+    jobs.parallelFor(blockCount, [&](size_t block) {
+        size_t last = std::min(uniqueCorners.size(), (block + 1) * blockSize);
+        for (size_t i = block * blockSize; i < last; ++i) {
+            const Corner& corner = uniqueCorners[i];
+            MeshVertex& vertex = mesh.vertices[i];
+            std::memcpy(vertex.position, &positions[static_cast<size_t>(corner.position) * 3], sizeof(vertex.position));
+            if (corner.normal != MISSING_INDEX) {
+                std::memcpy(vertex.normal, &normals[static_cast<size_t>(corner.normal) * 3], sizeof(vertex.normal));
+            }
+            else {
+                vertex.normal[0] = vertex.normal[1] = vertex.normal[2] = 0.0f;
+            }
+            if (corner.texCoord != MISSING_INDEX) {
+                std::memcpy(vertex.texCoord, &texCoords[static_cast<size_t>(corner.texCoord) * 2], sizeof(vertex.texCoord));
+            }
+            else {
+                vertex.texCoord[0] = vertex.texCoord[1] = 0.0f;
+            }
+        }
+    });
+
+    // 5. Normales suaves para los vértices sin normal: suma de las normales de cara (su longitud
+    // es el doble del área, así que las caras grandes pesan más) y normalización.
+    bool missingNormals = std::any_of(uniqueCorners.begin(), uniqueCorners.end(),
+        [](const Corner& corner) { return corner.normal == MISSING_INDEX; });
+    if (missingNormals) {
+        for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+            MeshVertex* triangle[3] = { &mesh.vertices[mesh.indices[i]], &mesh.vertices[mesh.indices[i + 1]],
+                                        &mesh.vertices[mesh.indices[i + 2]] };
+            float edge1[3], edge2[3];
+            for (int axis = 0; axis < 3; ++axis) {
+                edge1[axis] = triangle[1]->position[axis] - triangle[0]->position[axis];
+                edge2[axis] = triangle[2]->position[axis] - triangle[0]->position[axis];
+            }
+            float faceNormal[3] = { edge1[1] * edge2[2] - edge1[2] * edge2[1],
+                                    edge1[2] * edge2[0] - edge1[0] * edge2[2],
+                                    edge1[0] * edge2[1] - edge1[1] * edge2[0] };
+            for (int corner = 0; corner < 3; ++corner) {
+                if (uniqueCorners[mesh.indices[i + corner]].normal != MISSING_INDEX) {
+                    continue;
+                }
+                for (int axis = 0; axis < 3; ++axis) {
+                    triangle[corner]->normal[axis] += faceNormal[axis];
+                }
+            }
+        }
+        jobs.parallelFor(blockCount, [&](size_t block) {
+            size_t last = std::min(uniqueCorners.size(), (block + 1) * blockSize);
+            for (size_t i = block * blockSize; i < last; ++i) {
+                if (uniqueCorners[i].normal != MISSING_INDEX) {
+                    continue;
+                }
+                float* normal = mesh.vertices[i].normal;
+                float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+                if (length > 0.0f) {
+                    normal[0] /= length;
+                    normal[1] /= length;
+                    normal[2] /= length;
+                }
+                else {
+                    normal[0] = 0.0f;
+                    normal[1] = 1.0f;
+                    normal[2] = 0.0f;
+                }
+            }
+        });
+    }
+    return true;
+}
@@ -0,0 +1,79 @@
+#include "PreloadManifest.h"
+#include "Services/NotificationSystem.h"
+#include <fstream>
+#include <sstream>
+
+// Una sección `[escena]` por escena; cada línea es "<tipo> <nombre> [argumentos]".
+bool
+PreloadManifest::loadFromFile(const std::string& path) {
+    std::ifstream input(path);
+    if (!input) {
+        return false;
+    }
+
+    std::string scene;
+    std::string line;
+    for (int lineNumber = 1; std::getline(input, line); ++lineNumber) {
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+        std::istringstream fields(line);
+        std::string keyword;
+        if (!(fields >> keyword)) {
+            continue;
+        }
+        if (keyword.front() == '[' && keyword.back() == ']') {
+            scene = keyword.substr(1, keyword.size() - 2);
+            continue;
+        }
+
+        PreloadEntry entry;
+        fields >> entry.name;
+        bool valid = !scene.empty() && !entry.name.empty();
+        if (keyword == "texture") {
+            // "Circuit.png" -> nombre "Circuit", extensión "png".
+            size_t dot = entry.name.find_last_of('.');
+            valid = valid && dot != std::string::npos && dot > 0;
+            if (valid) {
+                entry.extension = entry.name.substr(dot + 1);
+                entry.name.erase(dot);
+            }
+        }
+        else if (keyword == "atlas") {
+            entry.type = PreloadType::ATLAS;
+            fields >> entry.extension;
+            for (std::string sprite; fields >> sprite;) {
+                entry.sprites.push_back(sprite);
+            }
+            valid = valid && !entry.sprites.empty();
+        }
+        else if (keyword == "font") {
+            entry.type = PreloadType::FONT;
+        }
+        else if (keyword == "sound") {
+            entry.type = PreloadType::SOUND;
+        }
+        else if (keyword == "shader") {
+            entry.type = PreloadType::SHADER;
+        }
+        else {
+            valid = false;
+        }
+
+        if (!valid) {
+            NotificationService::getInstance().addMessage(ConsolErrorType::WARNING,
+                "Preload manifest " + path + ": ignoring line " + std::to_string(lineNumber));
+            continue;
+        }
+        m_scenes[scene].push_back(entry);
+    }
+    return true;
+}
+
+const std::vector<PreloadEntry>&
+PreloadManifest::getScene(const std::string& scene) const {
+    static const std::vector<PreloadEntry> empty;
+    auto it = m_scenes.find(scene);
+    return it != m_scenes.end() ? it->second : empty;
+}
@@ -0,0 +1,94 @@
+#include "RenderQueue.h"
+#include "BatchRenderer.h"
+#include "ShapeFactory.h"
+#include <algorithm>
+
+// Traduce textura, profundidad y mezcla a la clave del comando.
+void
+RenderQueue::submit(const ShapeFactory& shape, uint8_t layer, float depth, const sf::BlendMode& blendMode) {
+    float clamped = std::min(std::max(depth, 0.0f), 1.0f);
+    uint16_t quantizedDepth = static_cast<uint16_t>(clamped * 65535.0f + 0.5f);
+
+    RenderCommand command;
+    command.key = makeKey(layer, getTextureId(shape.getTexture()), quantizedDepth, getMaterialId(blendMode));
+    command.shape = &shape;
+    m_commands.push_back(command);
+}
+
+// Radix sort LSD de 8 bits: un recorrido cuenta los 8 histogramas y cada pasada útil reparte.
+void
+RenderQueue::sort() {
+    m_sortPassCount = 0;
+    size_t count = m_commands.size();
+    if (count < 2) {
+        return;
+    }
+
+    size_t histograms[8][256] = {};
+    for (const RenderCommand& command : m_commands) {
+        uint64_t key = command.key;
+        for (int pass = 0; pass < 8; ++pass) {
+            ++histograms[pass][(key >> (pass * 8)) & 0xFF];
+        }
+    }
+
+    m_scratch.resize(count);
+    for (int pass = 0; pass < 8; ++pass) {
+        size_t* histogram = histograms[pass];
+
+        // Si todos los comandos tienen el mismo byte, la pasada no cambia el orden.
+        unsigned int firstByte = (m_commands[0].key >> (pass * 8)) & 0xFF;
+        if (histogram[firstByte] == count) {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (int bucket = 0; bucket < 256; ++bucket) {
+            size_t bucketCount = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucketCount;
+        }
+
+        for (const RenderCommand& command : m_commands) {
+            m_scratch[histogram[(command.key >> (pass * 8)) & 0xFF]++] = command;
+        }
+        m_commands.swap(m_scratch);
+        ++m_sortPassCount;
+    }
+}
+
+// El material de la clave recupera el modo de mezcla con el que se envió la forma.
+void
+RenderQueue::flush(BatchRenderer& batchRenderer) const {
+    for (const RenderCommand& command : m_commands) {
+        size_t material = static_cast<size_t>(command.key & 0xFFFF);
+        batchRenderer.submit(*command.shape, m_materials[material]);
+    }
+}
+
+// Los identificadores se asignan en orden de aparición dentro del fotograma (ver begin).
+uint32_t
+RenderQueue::getTextureId(const sf::Texture* texture) {
+    if (texture == nullptr) {
+        return 0;
+    }
+    auto it = m_textureIds.find(texture);
+    if (it != m_textureIds.end()) {
+        return it->second;
+    }
+    uint32_t id = static_cast<uint32_t>(m_textureIds.size() + 1) & TEXTURE_MASK;
+    m_textureIds.emplace(texture, id);
+    return id;
+}
+
+// Búsqueda lineal: en la práctica solo hay unos cuantos modos de mezcla.
+uint16_t
+RenderQueue::getMaterialId(const sf::BlendMode& blendMode) {
+    for (size_t i = 0; i < m_materials.size(); ++i) {
+        if (m_materials[i] == blendMode) {
+            return static_cast<uint16_t>(i);
+        }
+    }
+    m_materials.push_back(blendMode);
+    return static_cast<uint16_t>(m_materials.size() - 1);
+}
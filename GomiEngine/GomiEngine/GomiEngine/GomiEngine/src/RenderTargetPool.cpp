@@ -0,0 +1,82 @@
+#include "RenderTargetPool.h"
+#include <algorithm>
+
+// Busca una textura libre de la misma clase antes de crear una.
+sf::RenderTexture*
+RenderTargetPool::acquire(const sf::Vector2u& size) {
+    sf::Vector2u sizeClass = getSizeClass(size);
+    for (Entry& entry : m_entries) {
+        if (!entry.inUse && entry.sizeClass == sizeClass) {
+            entry.inUse = true;
+            ++m_reuseCount;
+            return entry.texture.get();
+        }
+    }
+
+    auto texture = std::make_unique<sf::RenderTexture>();
+    if (!texture->create(sizeClass.x, sizeClass.y)) {
+        ERROR("RenderTargetPool", "acquire", "CHECK RENDER TEXTURE CREATION");
+        return nullptr;
+    }
+    ++m_allocationCount;
+
+    Entry entry;
+    entry.texture = std::move(texture);
+    entry.sizeClass = sizeClass;
+    entry.inUse = true;
+    m_entries.push_back(std::move(entry));
+    return m_entries.back().texture.get();
+}
+
+// La textura queda disponible para el siguiente pedido de su clase.
+void
+RenderTargetPool::release(sf::RenderTexture* target) {
+    for (Entry& entry : m_entries) {
+        if (entry.texture.get() == target) {
+            entry.inUse = false;
+            entry.releaseStamp = ++m_releaseCounter;
+            break;
+        }
+    }
+
+    // Durante un arrastre se recorren varias clases: solo se conservan las liberadas más recientes.
+    while (m_entries.size() - getInUseCount() > MAX_FREE_TARGETS) {
+        auto oldest = m_entries.end();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (!it->inUse && (oldest == m_entries.end() || it->releaseStamp < oldest->releaseStamp)) {
+                oldest = it;
+            }
+        }
+        m_entries.erase(oldest);
+    }
+}
+
+// Elimina las entradas libres.
+void
+RenderTargetPool::trim() {
+    m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(),
+                                   [](const Entry& entry) { return !entry.inUse; }),
+                    m_entries.end());
+}
+
+// Redondea cada lado hacia arriba al siguiente múltiplo de la granularidad.
+sf::Vector2u
+RenderTargetPool::getSizeClass(const sf::Vector2u& size) {
+    auto roundUp = [](unsigned int value) {
+        unsigned int steps = (std::max(value, 1u) + SIZE_GRANULARITY - 1) / SIZE_GRANULARITY;
+        return steps * SIZE_GRANULARITY;
+    };
+    return sf::Vector2u(roundUp(size.x), roundUp(size.y));
+}
+
+// Cuenta las entradas reservadas.
+size_t
+RenderTargetPool::getInUseCount() const {
+    size_t count = 0;
+    for (const Entry& entry : m_entries) {
+        if (entry.inUse) {
+            ++count;
+        }
+    }
+    return count;
+}
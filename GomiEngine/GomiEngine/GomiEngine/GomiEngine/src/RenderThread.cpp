@@ -0,0 +1,161 @@
+#include "RenderThread.h"
+#include <SFML/OpenGL.hpp>
+#include <algorithm>
+
+RenderThread::~RenderThread() {
+    stop();
+}
+
+// Las texturas se crean en el hilo principal y se liberan de su contexto para usarlas en el hilo de render.
+bool
+RenderThread::start(unsigned int width, unsigned int height) {
+    if (m_running.load()) {
+        return true;
+    }
+    for (int i = 0; i < 3; ++i) {
+        sf::RenderTexture& frame = m_frames.getBuffer(i);
+        if (!frame.create(width, height)) {
+            return false;
+        }
+        if (!frame.setActive(false)) {
+            return false;
+        }
+    }
+
+    m_running = true;
+    m_thread = std::thread([this]() { run(); });
+    return true;
+}
+
+// Despierta al hilo para que salga de la espera y lo une.
+void
+RenderThread::stop() {
+    if (!m_thread.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_running = false;
+    }
+    m_wake.notify_one();
+    m_thread.join();
+}
+
+// Limpia la copia de escritura; su memoria se conserva entre fotogramas.
+SceneSnapshot&
+RenderThread::beginSnapshot() {
+    SceneSnapshot& snapshot = m_snapshots.getWriteBuffer();
+    snapshot.clear();
+    return snapshot;
+}
+
+// La publicación es un intercambio atómico; el mutex solo acompaña a la señal de despertar.
+void
+RenderThread::submitSnapshot() {
+    SceneSnapshot& snapshot = m_snapshots.getWriteBuffer();
+    snapshot.frameIndex = m_frameIndex++;
+    snapshot.publishTime = std::chrono::steady_clock::now();
+    if (m_snapshots.publish()) {
+        ++m_droppedSnapshotCount;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_snapshotPending = true;
+    }
+    m_wake.notify_one();
+}
+
+// glFlush solo envía los comandos; entre contextos hace falta esperar a que terminen.
+void
+RenderThread::finishUploads() {
+    glFinish();
+}
+
+// Si no hay un fotograma nuevo se sigue mostrando el anterior.
+const sf::Texture*
+RenderThread::acquireFrame() {
+    if (m_frames.acquire()) {
+        m_hasFrame = true;
+    }
+    return m_hasFrame ? &m_frames.getReadBuffer().getTexture() : nullptr;
+}
+
+// Espera una instantánea, la dibuja y publica la textura resultante.
+void
+RenderThread::run() {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            m_wake.wait(lock, [this]() { return m_snapshotPending || !m_running.load(); });
+            if (!m_running.load()) {
+                break;
+            }
+            m_snapshotPending = false;
+        }
+
+        if (!m_snapshots.acquire()) {
+            continue;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        const SceneSnapshot& snapshot = m_snapshots.getReadBuffer();
+        sf::RenderTexture& target = m_frames.getWriteBuffer();
+        renderSnapshot(snapshot, target);
+        m_frames.publish();
+
+        auto end = std::chrono::steady_clock::now();
+        m_renderMs = std::chrono::duration<float, std::milli>(end - start).count();
+        m_latencyMs = std::chrono::duration<float, std::milli>(end - snapshot.publishTime).count();
+        ++m_renderedFrameCount;
+    }
+
+    // Libera el contexto de la última textura usada en este hilo.
+    for (int i = 0; i < 3; ++i) {
+        m_frames.getBuffer(i).setActive(false);
+    }
+}
+
+// Ordena por capa y textura (como la cola de dibujo) y agrupa en lotes.
+void
+RenderThread::renderSnapshot(const SceneSnapshot& snapshot, sf::RenderTexture& target) {
+    const std::vector<SnapshotItem>& items = snapshot.items;
+    m_drawOrder.resize(items.size());
+    for (size_t i = 0; i < items.size(); ++i) {
+        m_drawOrder[i] = static_cast<uint32_t>(i);
+    }
+    // El índice desempata para conservar el orden de captura sin la memoria extra de stable_sort.
+    std::sort(m_drawOrder.begin(), m_drawOrder.end(), [&items](uint32_t a, uint32_t b) {
+        const SnapshotItem& left = items[a];
+        const SnapshotItem& right = items[b];
+        if (left.layer != right.layer) {
+            return left.layer < right.layer;
+        }
+        if (left.textureId != right.textureId) {
+            return left.textureId < right.textureId;
+        }
+        return a < b;
+    });
+
+    m_batchRenderer.begin();
+    for (uint32_t index : m_drawOrder) {
+        const SnapshotItem& item = items[index];
+        if (item.geometry == nullptr) {
+            continue;
+        }
+        m_batchRenderer.submitPolygon(item.geometry->points.data(), item.geometry->points.size(),
+                                      SceneSnapshot::getTransform(item), item.color,
+                                      item.textureRect, snapshot.textures[item.textureId]);
+    }
+
+    target.setActive(true);
+    target.clear();
+    m_batchRenderer.flush(target);
+    target.display();
+    m_drawCallCount = m_batchRenderer.getDrawCallCount();
+    m_itemCount = m_batchRenderer.getSubmittedCount();
+
+    // El hilo principal lee la textura desde otro contexto: se espera a que la GPU termine de
+    // dibujarla antes de publicarla (glFlush no basta para sincronizar contextos).
+    glFinish();
+}
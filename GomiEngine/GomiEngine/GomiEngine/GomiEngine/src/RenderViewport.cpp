@@ -0,0 +1,90 @@
+#include "RenderViewport.h"
+
+RenderViewport::~RenderViewport() {
+    if (m_target != nullptr) {
+        m_pool.release(m_target);
+    }
+}
+
+// Conserva la textura mientras la vista quepa y no sea menos de la mitad de la clase; al crecer
+// pide un 25% de margen para que un arrastre no cree una textura por cada clase que cruza.
+bool
+RenderViewport::resize(const sf::Vector2u& size) {
+    m_size = size;
+    if (m_target != nullptr) {
+        sf::Vector2u capacity = m_target->getSize();
+        sf::Vector2u needed = RenderTargetPool::getSizeClass(size);
+        bool fits = size.x <= capacity.x && size.y <= capacity.y;
+        bool oversized = capacity.x > needed.x * 2 || capacity.y > needed.y * 2;
+        if (fits && !oversized) {
+            return true;
+        }
+        m_pool.release(m_target);
+    }
+    m_target = m_pool.acquire(sf::Vector2u(size.x + size.x / 4, size.y + size.y / 4));
+    return m_target != nullptr;
+}
+
+// Guarda la cámara; la subregión se aplica al limpiar.
+void
+RenderViewport::setCamera(const sf::View& view) {
+    m_camera = view;
+    m_hasCamera = true;
+}
+
+// Otra vista pudo usar la misma textura antes, así que la cámara se aplica en cada fotograma.
+void
+RenderViewport::clear(const sf::Color& color) {
+    if (m_target == nullptr) {
+        return;
+    }
+    m_target->setView(m_target->getDefaultView());
+    m_target->clear(color);
+    m_target->setView(makeView());
+}
+
+// Dibuja en la textura de la vista.
+void
+RenderViewport::draw(const sf::Drawable& drawable, const sf::RenderStates& states) {
+    if (m_target != nullptr) {
+        m_target->draw(drawable, states);
+    }
+}
+
+// Termina el fotograma de la textura.
+void
+RenderViewport::display() {
+    if (m_target != nullptr) {
+        m_target->display();
+    }
+}
+
+// La textura de render está invertida en Y: la subregión superior va de v = 1 a v = 1 - h/H.
+void
+RenderViewport::showInImGui() {
+    ImGui::Begin(m_name.c_str());
+    if (m_target != nullptr) {
+        const sf::Texture& texture = m_target->getTexture();
+        sf::Vector2u capacity = texture.getSize();
+        float u = static_cast<float>(m_size.x) / capacity.x;
+        float v = static_cast<float>(m_size.y) / capacity.y;
+        ImGui::Image((void*)(intptr_t)texture.getNativeHandle(),
+                     ImVec2(static_cast<float>(m_size.x), static_cast<float>(m_size.y)),
+                     ImVec2(0.0f, 1.0f), ImVec2(u, 1.0f - v));
+    }
+    ImGui::End();
+}
+
+// Sin cámara asignada, un píxel por unidad con el origen arriba a la izquierda.
+sf::View
+RenderViewport::makeView() const {
+    sf::View view = m_hasCamera
+        ? m_camera
+        : sf::View(sf::FloatRect(0.0f, 0.0f, static_cast<float>(m_size.x), static_cast<float>(m_size.y)));
+
+    sf::Vector2u capacity = m_target->getSize();
+    view.setViewport(sf::FloatRect(0.0f, 0.0f,
+                                   static_cast<float>(m_size.x) / capacity.x,
+                                   static_cast<float>(m_size.y) / capacity.y));
+    return view;
+}
@@ -0,0 +1,50 @@
+#include "SceneSnapshot.h"
+#include "ShapeFactory.h"
+#include "Services/ResourceManager.h"
+#include <algorithm>
+
+// Vacía los arreglos y suelta las texturas retenidas; la tabla de texturas conserva la entrada nula.
+void
+SceneSnapshot::clear() {
+    items.clear();
+    textures.resize(1);
+    textureRefs.clear();
+}
+
+// Copia matriz, color, textura y la referencia a la geometría de la forma.
+void
+SceneSnapshot::capture(const ShapeFactory& shape, uint8_t layer) {
+    SnapshotItem item;
+
+    // sf::Transform guarda una matriz 4x4 por columnas; solo se necesita la parte afín.
+    const float* matrix = shape.getTransform().getMatrix();
+    item.transform[0] = matrix[0];
+    item.transform[1] = matrix[4];
+    item.transform[2] = matrix[12];
+    item.transform[3] = matrix[1];
+    item.transform[4] = matrix[5];
+    item.transform[5] = matrix[13];
+
+    item.color = shape.getFillColor();
+    item.textureRect = shape.getTextureRect();
+    item.layer = layer;
+
+    // Hay pocas texturas por escena: la búsqueda lineal es más barata que un mapa.
+    const sf::Texture* texture = shape.getTexture();
+    if (texture != nullptr) {
+        auto it = std::find(textures.begin() + 1, textures.end(), texture);
+        item.textureId = static_cast<uint32_t>(it - textures.begin());
+        if (it == textures.end()) {
+            textures.push_back(texture);
+            // Las texturas que no son de la caché (p. ej. miembros de la aplicación) no se expulsan.
+            EngineUtilities::TSharedPointer<Texture> owner = ResourceManager::getInstance().findOwner(texture);
+            if (!owner.isNull()) {
+                textureRefs.push_back(owner);
+            }
+        }
+    }
+
+    item.geometry = shape.getGeometry();
+
+    items.push_back(item);
+}
@@ -1,76 +1,174 @@
-﻿#include "ShapeBuilder.h"
+﻿#include "ShapeFactory.h"
+#include "BatchRenderer.h"
+#include <algorithm>
+#include <cmath>
+
+// Niveles de detalle de los círculos: puntos por nivel y radio en píxeles hasta el que se usa.
+// Con estos límites el error de la cuerda queda por debajo de medio píxel en cada nivel.
+static const unsigned int LOD_POINT_COUNTS[] = { 6, 10, 16, 24, 30 };
+static const float LOD_MAX_RADIUS[] = { 3.0f, 8.0f, 16.0f, 32.0f };
+static const int LOD_LEVEL_COUNT = sizeof(LOD_POINT_COUNTS) / sizeof(LOD_POINT_COUNTS[0]);
+static const float LOD_HYSTERESIS = 0.15f; // Margen relativo para cambiar de nivel.
 
 /**
  * @brief Genera una figura según el tipo solicitado
  * ShapeType se refiere al tipo de figura a crear:
  * (CIRCLE, RECTANGLE, TRIANGLE)
+ * La geometría se toma de la caché; solo se teselan una vez por tipo, tamaño y puntos.
  */
-sf::Shape*
-ShapeBuilder::createFigure(ShapeType figureType) {
-    m_FigureType = figureType;
-    switch (figureType) {
-    case NONE: {
+const ShapeGeometry*
+ShapeFactory::createShape(ShapeType shapeType) {
+    m_ShapeType = shapeType;
+    ++m_version;
+    GeometryCache& cache = GeometryCache::getInstance();
+    switch (shapeType) {
+    case EMPTY: {
+        m_geometry = nullptr;
         return nullptr;
     }
-             // Crea un círculo con radio de 10 unidades.
+             // Crea un círculo con radio de 10 unidades (detalle máximo hasta calcular el nivel).
     case CIRCLE: {
-        sf::CircleShape* circle = new sf::CircleShape(10.0f);
-        m_figure = circle;
-        return circle;
+        m_lodLevel = LOD_LEVEL_COUNT - 1;
+        m_geometry = cache.getGeometry(CIRCLE, sf::Vector2f(20.0f, 20.0f), LOD_POINT_COUNTS[m_lodLevel]);
+        return m_geometry;
     }
                // Crea un rectángulo con dimensiones 100x50.
     case RECTANGLE: {
-        sf::RectangleShape* rectangle = new sf::RectangleShape(sf::Vector2f(100.0f, 50.0f));
-        m_figure = rectangle;
-        return rectangle;
+        m_geometry = cache.getGeometry(RECTANGLE, sf::Vector2f(100.0f, 50.0f), 4);
+        return m_geometry;
     }
                   // Crea un triángulo representado por un círculo con 3 lados y radio de 50.
     case TRIANGLE: {
-        sf::CircleShape* triangle = new sf::CircleShape(50.0f, 3);
-        m_figure = triangle;
-        return triangle;
+        m_geometry = cache.getGeometry(TRIANGLE, sf::Vector2f(100.0f, 100.0f), 3);
+        return m_geometry;
     }
     default:
+        m_geometry = nullptr;
         return nullptr;
     }
 }
 
+// Dibuja la figura directamente, sin pasar por los lotes.
+void
+ShapeFactory::render(Window& window) {
+    if (!m_geometry) {
+        return;
+    }
+    sf::VertexArray vertices(sf::Triangles);
+    BatchRenderer::appendPolygonVertices(m_geometry->points.data(), m_geometry->points.size(),
+                                         getTransform(), m_fillColor, m_textureRect, vertices);
+    sf::RenderStates states;
+    states.texture = m_texture;
+    window.draw(vertices, states);
+}
+
 // Establece la posición de la figura usando coordenadas (x, y).
 void
-ShapeBuilder::setPosition(float x, float y) {
-    if (m_figure) {
-        m_figure->setPosition(x, y);
+ShapeFactory::setPosition(float x, float y) {
+    sf::Vector2f position(x, y);
+    if (m_position != position) {
+        m_position = position;
+        ++m_version;
     }
 }
 
 // Establece la posición de la figura utilizando un objeto de tipo Vector2 (de la librería matemática).
 void
-ShapeBuilder::setPosition(const Vector2& position) {
-    if (m_figure) {
-        m_figure->setPosition(position.x, position.y);
-    }
+ShapeFactory::setPosition(const Vector2& position) {
+    setPosition(position.x, position.y);
 }
 
 // Ajusta la rotación de la figura en grados.
 void
-ShapeBuilder::setRotation(float angle) {
-    if (m_figure) {
-        m_figure->setRotation(angle);
+ShapeFactory::setRotation(float angle) {
+    // Igual que sf::Transformable: el ángulo se normaliza a [0, 360).
+    float rotation = std::fmod(angle, 360.0f);
+    if (rotation < 0.0f) {
+        rotation += 360.0f;
+    }
+    if (m_rotation != rotation) {
+        m_rotation = rotation;
+        ++m_version;
     }
 }
 
 // Ajusta la escala de la figura utilizando un objeto Vector2 (de la librería matemática).
 void
-ShapeBuilder::setScale(const Vector2& scale) {
-    if (m_figure) {
-        m_figure->setScale(scale.x, scale.y);
+ShapeFactory::setScale(const Vector2& scale) {
+    sf::Vector2f newScale(scale.x, scale.y);
+    if (m_scale != newScale) {
+        m_scale = newScale;
+        ++m_version;
     }
 }
 
 // Modifica el color de relleno de la figura.
 void
-ShapeBuilder::setFillColor(const sf::Color& color) {
-    if (m_figure) {
-        m_figure->setFillColor(color);
+ShapeFactory::setFillColor(const sf::Color& color) {
+    if (m_fillColor != color) {
+        m_fillColor = color;
+        ++m_version;
+    }
+}
+
+// Igual que sf::Shape: sin región previa (o si se pide), se usa la textura completa.
+void
+ShapeFactory::setTexture(const sf::Texture* texture, bool resetRect) {
+    if (texture && (resetRect || (!m_texture && m_textureRect == sf::IntRect()))) {
+        sf::Vector2u size = texture->getSize();
+        m_textureRect = sf::IntRect(0, 0, static_cast<int>(size.x), static_cast<int>(size.y));
+    }
+    m_texture = texture;
+    ++m_version;
+}
+
+// Asigna la región de la textura que se muestra.
+void
+ShapeFactory::setTextureRect(const sf::IntRect& rect) {
+    if (m_textureRect != rect) {
+        m_textureRect = rect;
+        ++m_version;
+    }
+}
+
+// Misma matriz que sf::Transformable con origen en (0, 0).
+sf::Transform
+ShapeFactory::getTransform() const {
+    float angle = -m_rotation * 3.141592654f / 180.0f;
+    float cosine = std::cos(angle);
+    float sine = std::sin(angle);
+    float scaleXCos = m_scale.x * cosine;
+    float scaleYCos = m_scale.y * cosine;
+    float scaleXSin = m_scale.x * sine;
+    float scaleYSin = m_scale.y * sine;
+    return sf::Transform(scaleXCos, scaleYSin, m_position.x,
+                         -scaleXSin, scaleYCos, m_position.y,
+                         0.0f, 0.0f, 1.0f);
+}
+
+// Sube o baja de nivel solo cuando el radio proyectado supera el umbral con margen.
+bool
+ShapeFactory::updateLevelOfDetail(float pixelsPerUnit) {
+    if (m_ShapeType != CIRCLE || !m_geometry) {
+        return false;
     }
+
+    float scale = std::max(std::abs(m_scale.x), std::abs(m_scale.y));
+    float radius = m_geometry->size.x * 0.5f * scale * pixelsPerUnit;
+
+    int level = m_lodLevel;
+    while (level + 1 < LOD_LEVEL_COUNT && radius > LOD_MAX_RADIUS[level] * (1.0f + LOD_HYSTERESIS)) {
+        ++level;
+    }
+    while (level > 0 && radius < LOD_MAX_RADIUS[level - 1] * (1.0f - LOD_HYSTERESIS)) {
+        --level;
+    }
+    if (level == m_lodLevel) {
+        return false;
+    }
+
+    m_lodLevel = static_cast<uint8_t>(level);
+    ++m_version;
+    m_geometry = GeometryCache::getInstance().getGeometry(CIRCLE, m_geometry->size, LOD_POINT_COUNTS[level]);
+    return true;
 }
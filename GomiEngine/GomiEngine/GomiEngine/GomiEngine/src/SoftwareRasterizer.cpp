@@ -0,0 +1,384 @@
+#include "SoftwareRasterizer.h"
+#include "Services/JobSystem.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GOMI_RASTER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief Factor de mezcla de SFML para un canal, con colores normalizados en [0, 1].
+ */
+static float
+blendFactor(sf::BlendMode::Factor factor, const float src[4], const float dst[4], int channel) {
+    switch (factor) {
+    case sf::BlendMode::Zero: return 0.0f;
+    case sf::BlendMode::One: return 1.0f;
+    case sf::BlendMode::SrcColor: return src[channel];
+    case sf::BlendMode::OneMinusSrcColor: return 1.0f - src[channel];
+    case sf::BlendMode::DstColor: return dst[channel];
+    case sf::BlendMode::OneMinusDstColor: return 1.0f - dst[channel];
+    case sf::BlendMode::SrcAlpha: return src[3];
+    case sf::BlendMode::OneMinusSrcAlpha: return 1.0f - src[3];
+    case sf::BlendMode::DstAlpha: return dst[3];
+    case sf::BlendMode::OneMinusDstAlpha: return 1.0f - dst[3];
+    default: return 1.0f;
+    }
+}
+
+/**
+ * @brief Ecuación de mezcla de SFML aplicada a un canal.
+ */
+static float
+blendEquation(sf::BlendMode::Equation equation, float src, float dst) {
+    switch (equation) {
+    case sf::BlendMode::Subtract: return src - dst;
+    case sf::BlendMode::ReverseSubtract: return dst - src;
+    case sf::BlendMode::Min: return std::min(src, dst);
+    case sf::BlendMode::Max: return std::max(src, dst);
+    default: return src + dst;
+    }
+}
+
+/**
+ * @brief Regla superior-izquierda: un píxel justo sobre la arista cuenta solo si la arista es
+ * izquierda o superior, así dos triángulos que comparten arista no dibujan el mismo píxel dos veces.
+ * Con y hacia abajo y el interior del lado positivo, la arista es izquierda si `a > 0` y
+ * superior si es horizontal con el interior debajo.
+ */
+static bool
+isTopLeft(float a, float b) {
+    return a > 0.0f || (a == 0.0f && b > 0.0f);
+}
+
+// La imagen empieza negra y opaca; la vista por defecto cubre la imagen con un píxel por unidad.
+SoftwareRasterizer::SoftwareRasterizer(unsigned int width, unsigned int height)
+    : m_width(std::max(width, 1u)),
+      m_height(std::max(height, 1u)),
+      m_tilesX((m_width + TILE_SIZE - 1) / TILE_SIZE),
+      m_tilesY((m_height + TILE_SIZE - 1) / TILE_SIZE),
+      m_pixels(static_cast<size_t>(m_width) * m_height * 4),
+      m_view(sf::FloatRect(0.0f, 0.0f, static_cast<float>(m_width), static_cast<float>(m_height))),
+      m_tileBins(static_cast<size_t>(m_tilesX) * m_tilesY) {
+    clear();
+}
+
+// Vacía los mosaicos conservando su memoria y llena la imagen.
+void
+SoftwareRasterizer::clear(const sf::Color& color) {
+    m_triangles.clear();
+    for (auto& bin : m_tileBins) {
+        bin.clear();
+    }
+    m_binEntryCount = 0;
+
+    for (size_t i = 0; i < m_pixels.size(); i += 4) {
+        m_pixels[i + 0] = color.r;
+        m_pixels[i + 1] = color.g;
+        m_pixels[i + 2] = color.b;
+        m_pixels[i + 3] = color.a;
+    }
+}
+
+// Misma conversión que sf::RenderTarget::mapCoordsToPixel, con la transformación del dibujo.
+void
+SoftwareRasterizer::drawTriangles(const sf::Vertex* vertices, size_t vertexCount,
+                                  const sf::RenderStates& states) {
+    sf::Transform toClip = m_view.getTransform() * states.transform;
+    const sf::FloatRect& viewport = m_view.getViewport();
+    float viewportLeft = viewport.left * m_width;
+    float viewportTop = viewport.top * m_height;
+    float viewportWidth = viewport.width * m_width;
+    float viewportHeight = viewport.height * m_height;
+
+    const sf::Image* image = nullptr;
+    if (states.texture != nullptr) {
+        auto it = m_textureImages.find(states.texture);
+        if (it != m_textureImages.end()) {
+            image = it->second;
+        }
+    }
+
+    for (size_t first = 0; first + 2 < vertexCount; first += 3) {
+        RasterTriangle triangle;
+        for (int i = 0; i < 3; ++i) {
+            const sf::Vertex& vertex = vertices[first + i];
+            sf::Vector2f clip = toClip.transformPoint(vertex.position);
+            triangle.position[i] = sf::Vector2f((clip.x + 1.0f) * 0.5f * viewportWidth + viewportLeft,
+                                                (1.0f - clip.y) * 0.5f * viewportHeight + viewportTop);
+            triangle.color[i][0] = vertex.color.r / 255.0f;
+            triangle.color[i][1] = vertex.color.g / 255.0f;
+            triangle.color[i][2] = vertex.color.b / 255.0f;
+            triangle.color[i][3] = vertex.color.a / 255.0f;
+            triangle.texCoords[i] = vertex.texCoords;
+        }
+        triangle.image = image;
+        triangle.blendMode = states.blendMode;
+        triangle.alphaBlend = states.blendMode == sf::BlendAlpha;
+
+        // SFML no descarta caras: los triángulos en sentido contrario se invierten.
+        const sf::Vector2f* p = triangle.position;
+        float area = (p[1].x - p[0].x) * (p[2].y - p[0].y) - (p[1].y - p[0].y) * (p[2].x - p[0].x);
+        if (area == 0.0f) {
+            continue;
+        }
+        if (area < 0.0f) {
+            std::swap(triangle.position[1], triangle.position[2]);
+            std::swap_ranges(triangle.color[1], triangle.color[1] + 4, triangle.color[2]);
+            std::swap(triangle.texCoords[1], triangle.texCoords[2]);
+        }
+
+        float minX = std::min({ p[0].x, p[1].x, p[2].x });
+        float minY = std::min({ p[0].y, p[1].y, p[2].y });
+        float maxX = std::max({ p[0].x, p[1].x, p[2].x });
+        float maxY = std::max({ p[0].y, p[1].y, p[2].y });
+        if (maxX < 0.0f || maxY < 0.0f || minX >= m_width || minY >= m_height) {
+            continue;
+        }
+
+        // Mosaicos que toca la caja envolvente, recortada a la imagen.
+        unsigned int tileX0 = static_cast<unsigned int>(std::max(minX, 0.0f)) / TILE_SIZE;
+        unsigned int tileY0 = static_cast<unsigned int>(std::max(minY, 0.0f)) / TILE_SIZE;
+        unsigned int tileX1 = std::min(static_cast<unsigned int>(maxX) / TILE_SIZE, m_tilesX - 1);
+        unsigned int tileY1 = std::min(static_cast<unsigned int>(maxY) / TILE_SIZE, m_tilesY - 1);
+
+        uint32_t index = static_cast<uint32_t>(m_triangles.size());
+        m_triangles.push_back(triangle);
+        for (unsigned int tileY = tileY0; tileY <= tileY1; ++tileY) {
+            for (unsigned int tileX = tileX0; tileX <= tileX1; ++tileX) {
+                m_tileBins[tileY * m_tilesX + tileX].push_back(index);
+                ++m_binEntryCount;
+            }
+        }
+    }
+}
+
+// Sin GPU no hay forma de dibujar un sf::Drawable cualquiera.
+void
+SoftwareRasterizer::draw([[maybe_unused]] const sf::Drawable& drawable, [[maybe_unused]] const sf::RenderStates& states) {
+    ++m_unsupportedDrawCount;
+}
+
+// Cada mosaico es independiente: se reparten entre los hilos y luego se vacían.
+void
+SoftwareRasterizer::display() {
+    size_t tileCount = m_tileBins.size();
+    if (m_multithreaded) {
+        JobSystem::getInstance().parallelFor(tileCount, [this](size_t tile) { rasterizeTile(tile); });
+    }
+    else {
+        for (size_t tile = 0; tile < tileCount; ++tile) {
+            rasterizeTile(tile);
+        }
+    }
+
+    m_lastTriangleCount = m_triangles.size();
+    m_lastBinEntryCount = m_binEntryCount;
+    m_triangles.clear();
+    for (auto& bin : m_tileBins) {
+        bin.clear();
+    }
+    m_binEntryCount = 0;
+}
+
+// Asocia (o quita) la imagen de una textura.
+void
+SoftwareRasterizer::setTextureImage(const sf::Texture* texture, const sf::Image* image) {
+    if (image != nullptr) {
+        m_textureImages[texture] = image;
+    }
+    else {
+        m_textureImages.erase(texture);
+    }
+}
+
+// Depende de las opciones con que se compiló.
+bool
+SoftwareRasterizer::isSimdAvailable() {
+#ifdef GOMI_RASTER_SSE2
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Copia la imagen RGBA a una sf::Image (no necesita contexto de OpenGL).
+sf::Image
+SoftwareRasterizer::copyToImage() const {
+    sf::Image image;
+    image.create(m_width, m_height, m_pixels.data());
+    return image;
+}
+
+// Rasteriza los triángulos del mosaico en el orden en que se enviaron.
+void
+SoftwareRasterizer::rasterizeTile(size_t tileIndex) {
+    const std::vector<uint32_t>& bin = m_tileBins[tileIndex];
+    if (bin.empty()) {
+        return;
+    }
+    int minX = static_cast<int>((tileIndex % m_tilesX) * TILE_SIZE);
+    int minY = static_cast<int>((tileIndex / m_tilesX) * TILE_SIZE);
+    int maxX = std::min(minX + static_cast<int>(TILE_SIZE), static_cast<int>(m_width));
+    int maxY = std::min(minY + static_cast<int>(TILE_SIZE), static_cast<int>(m_height));
+    for (uint32_t index : bin) {
+        rasterizeTriangle(m_triangles[index], minX, minY, maxX, maxY);
+    }
+}
+
+// Funciones de arista E(x, y) = a*x + b*y + c evaluadas en el centro de cada píxel.
+// La versión SSE2 y la escalar hacen las mismas operaciones, así que producen la misma imagen.
+void
+SoftwareRasterizer::rasterizeTriangle(const RasterTriangle& triangle, int minX, int minY, int maxX, int maxY) {
+    const sf::Vector2f* p = triangle.position;
+
+    // Arista i: la opuesta al vértice i; su valor normalizado es el peso baricéntrico del vértice.
+    float a[3], b[3], c[3];
+    bool topLeft[3];
+    for (int i = 0; i < 3; ++i) {
+        const sf::Vector2f& from = p[(i + 1) % 3];
+        const sf::Vector2f& to = p[(i + 2) % 3];
+        a[i] = from.y - to.y;
+        b[i] = to.x - from.x;
+        c[i] = from.x * to.y - from.y * to.x;
+        topLeft[i] = isTopLeft(a[i], b[i]);
+    }
+    float inverseArea = 1.0f / (a[0] * p[0].x + b[0] * p[0].y + c[0]);
+
+    // Recorta el recorrido a la caja envolvente del triángulo.
+    minX = std::max(minX, static_cast<int>(std::floor(std::min({ p[0].x, p[1].x, p[2].x }))));
+    minY = std::max(minY, static_cast<int>(std::floor(std::min({ p[0].y, p[1].y, p[2].y }))));
+    maxX = std::min(maxX, static_cast<int>(std::ceil(std::max({ p[0].x, p[1].x, p[2].x }))));
+    maxY = std::min(maxY, static_cast<int>(std::ceil(std::max({ p[0].y, p[1].y, p[2].y }))));
+
+#ifdef GOMI_RASTER_SSE2
+    if (m_simdEnabled) {
+        const __m128 laneOffsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+        const __m128 zero = _mm_setzero_ps();
+        __m128 edgeA[3], topLeftMask[3];
+        for (int i = 0; i < 3; ++i) {
+            edgeA[i] = _mm_set1_ps(a[i]);
+            topLeftMask[i] = _mm_castsi128_ps(_mm_set1_epi32(topLeft[i] ? -1 : 0));
+        }
+
+        for (int y = minY; y < maxY; ++y) {
+            float centerY = y + 0.5f;
+            __m128 rowTerm[3];
+            for (int i = 0; i < 3; ++i) {
+                rowTerm[i] = _mm_set1_ps(b[i] * centerY + c[i]);
+            }
+
+            for (int x = minX; x < maxX; x += 4) {
+                __m128 centerX = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneOffsets);
+                __m128 edge[3];
+                __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+                for (int i = 0; i < 3; ++i) {
+                    edge[i] = _mm_add_ps(_mm_mul_ps(edgeA[i], centerX), rowTerm[i]);
+                    __m128 onEdge = _mm_and_ps(_mm_cmpeq_ps(edge[i], zero), topLeftMask[i]);
+                    inside = _mm_and_ps(inside, _mm_or_ps(_mm_cmpgt_ps(edge[i], zero), onEdge));
+                }
+
+                int mask = _mm_movemask_ps(inside);
+                if (x + 4 > maxX) {
+                    mask &= (1 << (maxX - x)) - 1;
+                }
+                if (mask == 0) {
+                    continue;
+                }
+
+                alignas(16) float values[3][4];
+                for (int i = 0; i < 3; ++i) {
+                    _mm_store_ps(values[i], edge[i]);
+                }
+                for (int lane = 0; lane < 4; ++lane) {
+                    if (mask & (1 << lane)) {
+                        float weights[3] = { values[0][lane] * inverseArea,
+                                             values[1][lane] * inverseArea,
+                                             values[2][lane] * inverseArea };
+                        shadePixel(triangle, x + lane, y, weights);
+                    }
+                }
+            }
+        }
+        return;
+    }
+#endif
+
+    for (int y = minY; y < maxY; ++y) {
+        float centerY = y + 0.5f;
+        float rowTerm[3];
+        for (int i = 0; i < 3; ++i) {
+            rowTerm[i] = b[i] * centerY + c[i];
+        }
+
+        for (int x = minX; x < maxX; ++x) {
+            float centerX = static_cast<float>(x) + 0.5f;
+            float edge[3];
+            bool inside = true;
+            for (int i = 0; i < 3; ++i) {
+                edge[i] = a[i] * centerX + rowTerm[i];
+                inside = inside && (edge[i] > 0.0f || (edge[i] == 0.0f && topLeft[i]));
+            }
+            if (inside) {
+                float weights[3] = { edge[0] * inverseArea, edge[1] * inverseArea, edge[2] * inverseArea };
+                shadePixel(triangle, x, y, weights);
+            }
+        }
+    }
+}
+
+// Color del vértice por el texel (sin filtrar, como sf::Texture sin suavizado) y mezcla de SFML.
+void
+SoftwareRasterizer::shadePixel(const RasterTriangle& triangle, int x, int y, const float weights[3]) {
+    float src[4];
+    for (int channel = 0; channel < 4; ++channel) {
+        src[channel] = weights[0] * triangle.color[0][channel] + weights[1] * triangle.color[1][channel] +
+                       weights[2] * triangle.color[2][channel];
+    }
+
+    if (triangle.image != nullptr) {
+        sf::Vector2u size = triangle.image->getSize();
+        if (size.x > 0 && size.y > 0) {
+            float u = weights[0] * triangle.texCoords[0].x + weights[1] * triangle.texCoords[1].x +
+                      weights[2] * triangle.texCoords[2].x;
+            float v = weights[0] * triangle.texCoords[0].y + weights[1] * triangle.texCoords[1].y +
+                      weights[2] * triangle.texCoords[2].y;
+            int texelX = std::min(std::max(static_cast<int>(std::floor(u)), 0), static_cast<int>(size.x) - 1);
+            int texelY = std::min(std::max(static_cast<int>(std::floor(v)), 0), static_cast<int>(size.y) - 1);
+            const sf::Uint8* texel = triangle.image->getPixelsPtr() + (static_cast<size_t>(texelY) * size.x + texelX) * 4;
+            for (int channel = 0; channel < 4; ++channel) {
+                src[channel] *= texel[channel] * (1.0f / 255.0f);
+            }
+        }
+    }
+
+    uint8_t* pixel = &m_pixels[(static_cast<size_t>(y) * m_width + x) * 4];
+    float dst[4] = { pixel[0] * (1.0f / 255.0f), pixel[1] * (1.0f / 255.0f),
+                     pixel[2] * (1.0f / 255.0f), pixel[3] * (1.0f / 255.0f) };
+    float out[4];
+    if (triangle.alphaBlend) {
+        // sf::BlendAlpha: color (SrcAlpha, OneMinusSrcAlpha), alfa (One, OneMinusSrcAlpha).
+        float inverseAlpha = 1.0f - src[3];
+        for (int channel = 0; channel < 3; ++channel) {
+            out[channel] = src[channel] * src[3] + dst[channel] * inverseAlpha;
+        }
+        out[3] = src[3] + dst[3] * inverseAlpha;
+    }
+    else {
+        const sf::BlendMode& mode = triangle.blendMode;
+        for (int channel = 0; channel < 4; ++channel) {
+            bool alpha = channel == 3;
+            float srcFactor = blendFactor(alpha ? mode.alphaSrcFactor : mode.colorSrcFactor, src, dst, channel);
+            float dstFactor = blendFactor(alpha ? mode.alphaDstFactor : mode.colorDstFactor, src, dst, channel);
+            out[channel] = blendEquation(alpha ? mode.alphaEquation : mode.colorEquation,
+                                         src[channel] * srcFactor, dst[channel] * dstFactor);
+        }
+    }
+
+    for (int channel = 0; channel < 4; ++channel) {
+        float value = std::min(std::max(out[channel], 0.0f), 1.0f);
+        pixel[channel] = static_cast<uint8_t>(value * 255.0f + 0.5f);
+    }
+}
@@ -0,0 +1,441 @@
+#include "SoftwareRenderer3D.h"
+#include "Services/JobSystem.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GOMI_RASTER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief Regla superior-izquierda (ver SoftwareRasterizer.cpp): con y hacia abajo y el interior
+ * del lado positivo, la arista es izquierda si `a > 0` y superior si es horizontal con `b > 0`.
+ */
+static bool
+isTopLeft(float a, float b) {
+    return a > 0.0f || (a == 0.0f && b > 0.0f);
+}
+
+// Los búferes cubren mosaicos completos aunque la imagen no sea múltiplo del mosaico.
+SoftwareRenderer3D::SoftwareRenderer3D(unsigned int width, unsigned int height)
+    : m_width(std::max(width, 1u)),
+      m_height(std::max(height, 1u)),
+      m_tilesX((m_width + TILE_SIZE - 1) / TILE_SIZE),
+      m_tilesY((m_height + TILE_SIZE - 1) / TILE_SIZE),
+      m_color(static_cast<size_t>(m_tilesX) * m_tilesY * TILE_SIZE * TILE_SIZE * 4),
+      m_depth(static_cast<size_t>(m_tilesX) * m_tilesY * TILE_SIZE * TILE_SIZE) {
+    clear();
+}
+
+// La cámara se combina con el modelo de cada envío.
+void
+SoftwareRenderer3D::setCamera(const Matrix4& view, const Matrix4& projection) {
+    m_viewProjection = projection * view;
+}
+
+// Color de fondo y profundidad máxima.
+void
+SoftwareRenderer3D::clear(const sf::Color& color) {
+    for (size_t i = 0; i < m_color.size(); i += 4) {
+        m_color[i + 0] = color.r;
+        m_color[i + 1] = color.g;
+        m_color[i + 2] = color.b;
+        m_color[i + 3] = color.a;
+    }
+    std::fill(m_depth.begin(), m_depth.end(), 1.0f);
+
+    m_vertices.clear();
+    m_triangleDraws.clear();
+    m_drawTransforms.clear();
+}
+
+// Solo se copian los vértices; la transformación se hace en paralelo en `render`.
+void
+SoftwareRenderer3D::submit(const Vertex3D* vertices, size_t vertexCount, const Matrix4& model) {
+    size_t triangleCount = vertexCount / 3;
+    if (triangleCount == 0) {
+        return;
+    }
+    uint32_t drawIndex = static_cast<uint32_t>(m_drawTransforms.size());
+    m_drawTransforms.push_back(m_viewProjection * model);
+    m_vertices.insert(m_vertices.end(), vertices, vertices + triangleCount * 3);
+    m_triangleDraws.insert(m_triangleDraws.end(), triangleCount, drawIndex);
+}
+
+// Etapa 1 por bloques y etapa 2 por mosaicos; los bloques se reutilizan entre fotogramas.
+void
+SoftwareRenderer3D::render() {
+    size_t tileCount = static_cast<size_t>(m_tilesX) * m_tilesY;
+    size_t triangleCount = m_triangleDraws.size();
+    m_chunkCount = (triangleCount + TRIANGLES_PER_CHUNK - 1) / TRIANGLES_PER_CHUNK;
+    if (m_chunks.size() < m_chunkCount) {
+        m_chunks.resize(m_chunkCount);
+        for (Chunk& chunk : m_chunks) {
+            chunk.tileBins.resize(tileCount);
+        }
+    }
+
+    parallelFor(m_chunkCount, [this](size_t chunk) { processChunk(chunk); });
+    parallelFor(tileCount, [this](size_t tile) { rasterizeTile(tile); });
+
+    m_stats = Stats();
+    for (size_t i = 0; i < m_chunkCount; ++i) {
+        const Stats& stats = m_chunks[i].stats;
+        m_stats.submitted += stats.submitted;
+        m_stats.culled += stats.culled;
+        m_stats.clipped += stats.clipped;
+        m_stats.rasterized += stats.rasterized;
+        m_stats.binEntries += stats.binEntries;
+    }
+
+    m_vertices.clear();
+    m_triangleDraws.clear();
+    m_drawTransforms.clear();
+}
+
+// Reordena los mosaicos en filas, un tramo contiguo por mosaico y fila.
+void
+SoftwareRenderer3D::copyPixels(uint8_t* out) const {
+    for (unsigned int y = 0; y < m_height; ++y) {
+        for (unsigned int tileX = 0; tileX < m_tilesX; ++tileX) {
+            size_t tile = static_cast<size_t>(y / TILE_SIZE) * m_tilesX + tileX;
+            size_t source = (tile * TILE_SIZE * TILE_SIZE + (y % TILE_SIZE) * TILE_SIZE) * 4;
+            unsigned int x = tileX * TILE_SIZE;
+            unsigned int span = std::min(TILE_SIZE, m_width - x);
+            std::memcpy(out + (static_cast<size_t>(y) * m_width + x) * 4, &m_color[source], span * 4);
+        }
+    }
+}
+
+// Imagen lineal lista para guardar o subir a una textura.
+sf::Image
+SoftwareRenderer3D::copyToImage() const {
+    std::vector<uint8_t> pixels(static_cast<size_t>(m_width) * m_height * 4);
+    copyPixels(pixels.data());
+    sf::Image image;
+    image.create(m_width, m_height, pixels.data());
+    return image;
+}
+
+// Cada cara en sentido antihorario vista desde fuera; el color depende de la esquina.
+void
+SoftwareRenderer3D::appendCube(std::vector<Vertex3D>& out, float halfSize) {
+    static const float faces[6][4][3] = {
+        { { -1, -1,  1 }, {  1, -1,  1 }, {  1,  1,  1 }, { -1,  1,  1 } },
+        { {  1, -1, -1 }, { -1, -1, -1 }, { -1,  1, -1 }, {  1,  1, -1 } },
+        { {  1, -1,  1 }, {  1, -1, -1 }, {  1,  1, -1 }, {  1,  1,  1 } },
+        { { -1, -1, -1 }, { -1, -1,  1 }, { -1,  1,  1 }, { -1,  1, -1 } },
+        { { -1,  1,  1 }, {  1,  1,  1 }, {  1,  1, -1 }, { -1,  1, -1 } },
+        { { -1, -1, -1 }, {  1, -1, -1 }, {  1, -1,  1 }, { -1, -1,  1 } },
+    };
+    static const int quadToTriangles[6] = { 0, 1, 2, 0, 2, 3 };
+
+    for (const auto& face : faces) {
+        for (int corner : quadToTriangles) {
+            const float* p = face[corner];
+            Vertex3D vertex;
+            vertex.position = Vector3(p[0] * halfSize, p[1] * halfSize, p[2] * halfSize);
+            vertex.color = sf::Color(p[0] > 0 ? 255 : 40, p[1] > 0 ? 255 : 40, p[2] > 0 ? 255 : 40);
+            out.push_back(vertex);
+        }
+    }
+}
+
+// Limita la concurrencia a `m_threadCount` tomando los índices de un contador compartido.
+void
+SoftwareRenderer3D::parallelFor(size_t count, const std::function<void(size_t)>& body) {
+    JobSystem& jobs = JobSystem::getInstance();
+    size_t threads = m_threadCount == 0 ? jobs.getWorkerCount() + 1 : m_threadCount;
+    threads = std::min(threads, count);
+    if (threads <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            body(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next{ 0 };
+    jobs.parallelFor(threads, [&](size_t) {
+        for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+            body(i);
+        }
+    });
+}
+
+// Transforma, descarta, recorta contra el plano cercano y clasifica los triángulos del bloque.
+void
+SoftwareRenderer3D::processChunk(size_t chunkIndex) {
+    Chunk& chunk = m_chunks[chunkIndex];
+    chunk.triangles.clear();
+    for (auto& bin : chunk.tileBins) {
+        bin.clear();
+    }
+    chunk.stats = Stats();
+
+    size_t first = chunkIndex * TRIANGLES_PER_CHUNK;
+    size_t last = std::min(first + TRIANGLES_PER_CHUNK, m_triangleDraws.size());
+    for (size_t triangle = first; triangle < last; ++triangle) {
+        ++chunk.stats.submitted;
+        const Matrix4& transform = m_drawTransforms[m_triangleDraws[triangle]];
+
+        ClipVertex clip[3];
+        for (int i = 0; i < 3; ++i) {
+            const Vertex3D& vertex = m_vertices[triangle * 3 + i];
+            clip[i].position = transform.transformPoint(vertex.position);
+            clip[i].color[0] = vertex.color.r / 255.0f;
+            clip[i].color[1] = vertex.color.g / 255.0f;
+            clip[i].color[2] = vertex.color.b / 255.0f;
+            clip[i].color[3] = vertex.color.a / 255.0f;
+        }
+
+        // Fuera del volumen visible si los tres vértices están del lado exterior del mismo plano.
+        auto allOutside = [&clip](auto isOutside) {
+            return isOutside(clip[0].position) && isOutside(clip[1].position) && isOutside(clip[2].position);
+        };
+        if (allOutside([](const Vector4& p) { return p.x > p.w; }) ||
+            allOutside([](const Vector4& p) { return p.x < -p.w; }) ||
+            allOutside([](const Vector4& p) { return p.y > p.w; }) ||
+            allOutside([](const Vector4& p) { return p.y < -p.w; }) ||
+            allOutside([](const Vector4& p) { return p.z > p.w; }) ||
+            allOutside([](const Vector4& p) { return p.z < -p.w; })) {
+            ++chunk.stats.culled;
+            continue;
+        }
+
+        // Solo el plano cercano se recorta (evita w <= 0); los demás se resuelven al rasterizar
+        // contra los límites de la imagen y con la prueba de profundidad.
+        float distance[3];
+        bool inside[3];
+        for (int i = 0; i < 3; ++i) {
+            distance[i] = clip[i].position.z + clip[i].position.w;
+            inside[i] = distance[i] >= 0.0f;
+        }
+        if (inside[0] && inside[1] && inside[2]) {
+            emitTriangle(chunk, clip[0], clip[1], clip[2]);
+            continue;
+        }
+
+        ++chunk.stats.clipped;
+        ClipVertex polygon[4];
+        int polygonCount = 0;
+        for (int i = 0; i < 3; ++i) {
+            int next = (i + 1) % 3;
+            if (inside[i]) {
+                polygon[polygonCount++] = clip[i];
+            }
+            if (inside[i] != inside[next]) {
+                float t = distance[i] / (distance[i] - distance[next]);
+                ClipVertex& crossing = polygon[polygonCount++];
+                crossing.position = clip[i].position + (clip[next].position - clip[i].position) * t;
+                for (int channel = 0; channel < 4; ++channel) {
+                    crossing.color[channel] = clip[i].color[channel] +
+                                              (clip[next].color[channel] - clip[i].color[channel]) * t;
+                }
+            }
+        }
+        for (int i = 1; i + 1 < polygonCount; ++i) {
+            emitTriangle(chunk, polygon[0], polygon[i], polygon[i + 1]);
+        }
+    }
+}
+
+// División de perspectiva, mapeo a píxeles y clasificación por caja envolvente.
+void
+SoftwareRenderer3D::emitTriangle(Chunk& chunk, const ClipVertex& a, const ClipVertex& b, const ClipVertex& c) {
+    const ClipVertex* source[3] = { &a, &b, &c };
+    ScreenTriangle triangle;
+    for (int i = 0; i < 3; ++i) {
+        const Vector4& position = source[i]->position;
+        ScreenVertex& vertex = triangle.vertex[i];
+        vertex.inverseW = 1.0f / position.w;
+        vertex.x = (position.x * vertex.inverseW + 1.0f) * 0.5f * m_width;
+        vertex.y = (1.0f - position.y * vertex.inverseW) * 0.5f * m_height;
+        vertex.depth = position.z * vertex.inverseW * 0.5f + 0.5f;
+        for (int channel = 0; channel < 4; ++channel) {
+            vertex.color[channel] = source[i]->color[channel] * vertex.inverseW;
+        }
+    }
+
+    // Con y hacia abajo, las caras frontales (antihorarias) quedan con área negativa.
+    const ScreenVertex* v = triangle.vertex;
+    float area = (v[1].x - v[0].x) * (v[2].y - v[0].y) - (v[1].y - v[0].y) * (v[2].x - v[0].x);
+    if (area == 0.0f || (area > 0.0f && m_backfaceCulling)) {
+        ++chunk.stats.culled;
+        return;
+    }
+    if (area < 0.0f) {
+        std::swap(triangle.vertex[1], triangle.vertex[2]);
+    }
+
+    float minX = std::min({ v[0].x, v[1].x, v[2].x });
+    float minY = std::min({ v[0].y, v[1].y, v[2].y });
+    float maxX = std::max({ v[0].x, v[1].x, v[2].x });
+    float maxY = std::max({ v[0].y, v[1].y, v[2].y });
+    if (maxX < 0.0f || maxY < 0.0f || minX >= m_width || minY >= m_height) {
+        ++chunk.stats.culled;
+        return;
+    }
+
+    unsigned int tileX0 = static_cast<unsigned int>(std::max(minX, 0.0f)) / TILE_SIZE;
+    unsigned int tileY0 = static_cast<unsigned int>(std::max(minY, 0.0f)) / TILE_SIZE;
+    unsigned int tileX1 = std::min(static_cast<unsigned int>(std::min(maxX, static_cast<float>(m_width))) / TILE_SIZE, m_tilesX - 1);
+    unsigned int tileY1 = std::min(static_cast<unsigned int>(std::min(maxY, static_cast<float>(m_height))) / TILE_SIZE, m_tilesY - 1);
+
+    uint32_t index = static_cast<uint32_t>(chunk.triangles.size());
+    chunk.triangles.push_back(triangle);
+    ++chunk.stats.rasterized;
+    for (unsigned int tileY = tileY0; tileY <= tileY1; ++tileY) {
+        for (unsigned int tileX = tileX0; tileX <= tileX1; ++tileX) {
+            chunk.tileBins[tileY * m_tilesX + tileX].push_back(index);
+            ++chunk.stats.binEntries;
+        }
+    }
+}
+
+// Recorre los bloques en orden de envío para que el resultado sea determinista.
+void
+SoftwareRenderer3D::rasterizeTile(size_t tileIndex) {
+    int minX = static_cast<int>((tileIndex % m_tilesX) * TILE_SIZE);
+    int minY = static_cast<int>((tileIndex / m_tilesX) * TILE_SIZE);
+    int maxX = std::min(minX + static_cast<int>(TILE_SIZE), static_cast<int>(m_width));
+    int maxY = std::min(minY + static_cast<int>(TILE_SIZE), static_cast<int>(m_height));
+    for (size_t i = 0; i < m_chunkCount; ++i) {
+        const Chunk& chunk = m_chunks[i];
+        for (uint32_t index : chunk.tileBins[tileIndex]) {
+            rasterizeTriangle(chunk.triangles[index], tileIndex, minX, minY, maxX, maxY);
+        }
+    }
+}
+
+// Funciones de arista como en SoftwareRasterizer; la profundidad (z / w) es afín en pantalla y
+// se interpola directamente, mientras que el color se interpola dividido entre w y se corrige
+// con la 1 / w interpolada.
+void
+SoftwareRenderer3D::rasterizeTriangle(const ScreenTriangle& triangle, size_t tileIndex,
+                                      int minX, int minY, int maxX, int maxY) {
+    const ScreenVertex* v = triangle.vertex;
+    int tileLeft = minX;
+    int tileTop = minY;
+    uint8_t* tileColor = &m_color[tileIndex * TILE_SIZE * TILE_SIZE * 4];
+    float* tileDepth = &m_depth[tileIndex * TILE_SIZE * TILE_SIZE];
+
+    float a[3], b[3], c[3];
+    bool topLeft[3];
+    for (int i = 0; i < 3; ++i) {
+        const ScreenVertex& from = v[(i + 1) % 3];
+        const ScreenVertex& to = v[(i + 2) % 3];
+        a[i] = from.y - to.y;
+        b[i] = to.x - from.x;
+        c[i] = from.x * to.y - from.y * to.x;
+        topLeft[i] = isTopLeft(a[i], b[i]);
+    }
+    float inverseArea = 1.0f / (a[0] * v[0].x + b[0] * v[0].y + c[0]);
+
+    minX = std::max(minX, static_cast<int>(std::floor(std::min({ v[0].x, v[1].x, v[2].x }))));
+    minY = std::max(minY, static_cast<int>(std::floor(std::min({ v[0].y, v[1].y, v[2].y }))));
+    maxX = std::min(maxX, static_cast<int>(std::ceil(std::max({ v[0].x, v[1].x, v[2].x }))));
+    maxY = std::min(maxY, static_cast<int>(std::ceil(std::max({ v[0].y, v[1].y, v[2].y }))));
+
+    // Escribe un píxel que pasó la prueba de profundidad.
+    auto shade = [&](int x, int y, const float weights[3], float depth) {
+        size_t local = static_cast<size_t>(y - tileTop) * TILE_SIZE + (x - tileLeft);
+        tileDepth[local] = depth;
+        float inverseW = weights[0] * v[0].inverseW + weights[1] * v[1].inverseW + weights[2] * v[2].inverseW;
+        float w = 1.0f / inverseW;
+        uint8_t* pixel = tileColor + local * 4;
+        for (int channel = 0; channel < 4; ++channel) {
+            float value = (weights[0] * v[0].color[channel] + weights[1] * v[1].color[channel] +
+                           weights[2] * v[2].color[channel]) * w;
+            pixel[channel] = static_cast<uint8_t>(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+        }
+    };
+
+#ifdef GOMI_RASTER_SSE2
+    // Se empieza en una columna múltiplo de 4 dentro del mosaico para leer la profundidad en grupos.
+    minX = tileLeft + ((minX - tileLeft) & ~3);
+    const __m128 laneOffsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 areaScale = _mm_set1_ps(inverseArea);
+    __m128 edgeA[3], topLeftMask[3], vertexDepth[3];
+    for (int i = 0; i < 3; ++i) {
+        edgeA[i] = _mm_set1_ps(a[i]);
+        topLeftMask[i] = _mm_castsi128_ps(_mm_set1_epi32(topLeft[i] ? -1 : 0));
+        vertexDepth[i] = _mm_set1_ps(v[i].depth);
+    }
+
+    for (int y = minY; y < maxY; ++y) {
+        float centerY = y + 0.5f;
+        __m128 rowTerm[3];
+        for (int i = 0; i < 3; ++i) {
+            rowTerm[i] = _mm_set1_ps(b[i] * centerY + c[i]);
+        }
+        float* depthRow = tileDepth + static_cast<size_t>(y - tileTop) * TILE_SIZE;
+
+        for (int x = minX; x < maxX; x += 4) {
+            __m128 centerX = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneOffsets);
+            __m128 weight[3];
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (int i = 0; i < 3; ++i) {
+                __m128 edge = _mm_add_ps(_mm_mul_ps(edgeA[i], centerX), rowTerm[i]);
+                __m128 onEdge = _mm_and_ps(_mm_cmpeq_ps(edge, zero), topLeftMask[i]);
+                inside = _mm_and_ps(inside, _mm_or_ps(_mm_cmpgt_ps(edge, zero), onEdge));
+                weight[i] = _mm_mul_ps(edge, areaScale);
+            }
+            __m128 depth = _mm_add_ps(_mm_add_ps(_mm_mul_ps(weight[0], vertexDepth[0]),
+                                                 _mm_mul_ps(weight[1], vertexDepth[1])),
+                                      _mm_mul_ps(weight[2], vertexDepth[2]));
+            __m128 closer = _mm_cmplt_ps(depth, _mm_loadu_ps(depthRow + (x - tileLeft)));
+
+            int mask = _mm_movemask_ps(_mm_and_ps(inside, closer));
+            if (x + 4 > maxX) {
+                mask &= (1 << (maxX - x)) - 1;
+            }
+            if (mask == 0) {
+                continue;
+            }
+
+            alignas(16) float weights[3][4];
+            alignas(16) float depths[4];
+            for (int i = 0; i < 3; ++i) {
+                _mm_store_ps(weights[i], weight[i]);
+            }
+            _mm_store_ps(depths, depth);
+            for (int lane = 0; lane < 4; ++lane) {
+                if (mask & (1 << lane)) {
+                    float laneWeights[3] = { weights[0][lane], weights[1][lane], weights[2][lane] };
+                    shade(x + lane, y, laneWeights, depths[lane]);
+                }
+            }
+        }
+    }
+#else
+    for (int y = minY; y < maxY; ++y) {
+        float centerY = y + 0.5f;
+        float rowTerm[3];
+        for (int i = 0; i < 3; ++i) {
+            rowTerm[i] = b[i] * centerY + c[i];
+        }
+
+        for (int x = minX; x < maxX; ++x) {
+            float centerX = static_cast<float>(x) + 0.5f;
+            float weights[3];
+            bool inside = true;
+            for (int i = 0; i < 3; ++i) {
+                float edge = a[i] * centerX + rowTerm[i];
+                inside = inside && (edge > 0.0f || (edge == 0.0f && topLeft[i]));
+                weights[i] = edge * inverseArea;
+            }
+            if (!inside) {
+                continue;
+            }
+            float depth = (weights[0] * v[0].depth + weights[1] * v[1].depth) + weights[2] * v[2].depth;
+            if (depth < tileDepth[static_cast<size_t>(y - tileTop) * TILE_SIZE + (x - tileLeft)]) {
+                shade(x, y, weights, depth);
+            }
+        }
+    }
+#endif
+}
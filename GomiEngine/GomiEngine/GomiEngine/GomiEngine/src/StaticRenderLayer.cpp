@@ -0,0 +1,115 @@
+#include "StaticRenderLayer.h"
+#include "BatchRenderer.h"
+#include "Hash.h"
+#include "Window.h"
+
+// Combina las firmas de los actores estáticos y hornea solo si el resultado cambió.
+bool
+StaticRenderLayer::update(const std::vector<EngineUtilities::TSharedPointer<Actor>>& actors) {
+    m_shapes.clear();
+    m_drawCallCount = 0;
+    unsigned long long signature = EngineUtilities::FNV_OFFSET_BASIS;
+    for (const auto& actor : actors) {
+        if (actor.isNull() || !actor->isStatic()) {
+            continue;
+        }
+        auto shape = actor->getComponent<ShapeFactory>();
+        if (shape.isNull() || shape->getGeometry() == nullptr) {
+            continue;
+        }
+        m_shapes.push_back(shape.get());
+        signature = computeSignature(*shape, signature);
+    }
+
+    if (signature == m_signature) {
+        return false;
+    }
+    bake(m_shapes);
+    m_signature = signature;
+    return true;
+}
+
+/**
+ * @brief Dibuja cada racha con su textura en cualquier destino con `draw(drawable, states)`.
+ * @return Llamadas de dibujo emitidas.
+ */
+template <typename Target>
+static size_t
+drawRanges(const std::vector<StaticRenderLayer::Range>& ranges, bool useVertexBuffer, Target& target) {
+    for (const StaticRenderLayer::Range& range : ranges) {
+        sf::RenderStates states(sf::BlendAlpha);
+        states.texture = range.texture;
+        if (useVertexBuffer) {
+            target.draw(range.buffer, states);
+        }
+        else {
+            target.draw(range.vertices, states);
+        }
+    }
+    return ranges.size();
+}
+
+// Dibuja cada racha con su textura.
+void
+StaticRenderLayer::draw(Window& window) {
+    m_drawCallCount += drawRanges(m_ranges, m_useVertexBuffer, window);
+}
+
+// Dibuja cada racha con su textura en un destino de SFML.
+void
+StaticRenderLayer::draw(sf::RenderTarget& target) {
+    m_drawCallCount += drawRanges(m_ranges, m_useVertexBuffer, target);
+}
+
+// Incluye la matriz completa, así que posición, rotación y escala invalidan por igual.
+unsigned long long
+StaticRenderLayer::computeSignature(const ShapeFactory& shape, unsigned long long hash) {
+    const ShapeGeometry* geometry = shape.getGeometry();
+    const sf::Texture* texture = shape.getTexture();
+    sf::IntRect textureRect = shape.getTextureRect();
+    sf::Color color = shape.getFillColor();
+
+    hash = EngineUtilities::hashFNV1a(&geometry, sizeof(geometry), hash);
+    hash = EngineUtilities::hashFNV1a(&texture, sizeof(texture), hash);
+    hash = EngineUtilities::hashFNV1a(shape.getTransform().getMatrix(), sizeof(float) * 16, hash);
+    hash = EngineUtilities::hashFNV1a(&textureRect, sizeof(textureRect), hash);
+    hash = EngineUtilities::hashFNV1a(&color, sizeof(color), hash);
+    return hash;
+}
+
+// Agrupa las formas consecutivas por textura y sube cada racha a su buffer.
+void
+StaticRenderLayer::bake(const std::vector<const ShapeFactory*>& shapes) {
+    m_ranges.clear();
+    m_vertexCount = 0;
+    ++m_bakeCount;
+
+    for (const ShapeFactory* shape : shapes) {
+        if (m_ranges.empty() || m_ranges.back().texture != shape->getTexture()) {
+            m_ranges.emplace_back();
+            m_ranges.back().texture = shape->getTexture();
+        }
+        const ShapeGeometry* geometry = shape->getGeometry();
+        BatchRenderer::appendPolygonVertices(geometry->points.data(), geometry->points.size(),
+                                             shape->getTransform(), shape->getFillColor(),
+                                             shape->getTextureRect(), m_ranges.back().vertices);
+    }
+
+    for (Range& range : m_ranges) {
+        size_t count = range.vertices.getVertexCount();
+        m_vertexCount += count;
+        if (m_useVertexBuffer && count > 0) {
+            // Si la subida falla se conserva la copia en CPU para todas las rachas.
+            if (!range.buffer.create(count) || !range.buffer.update(&range.vertices[0])) {
+                m_useVertexBuffer = false;
+            }
+        }
+    }
+
+    // Con VBO la copia en CPU ya no hace falta.
+    if (m_useVertexBuffer) {
+        for (Range& range : m_ranges) {
+            range.vertices.clear();
+        }
+    }
+}
@@ -0,0 +1,358 @@
+#include "StructuredLog.h"
+#include "Services/NotificationSystem.h"
+#include <cctype>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+/**
+ * @struct LogArg
+ * @brief Argumento leído de los datos de un mensaje estructurado.
+ */
+struct LogArg {
+    LogArgType type = LogArgType::INT;
+    uint64_t bits = 0;          ///< Valor de los tipos de 8 bytes.
+    const char* text = nullptr; ///< Caracteres de un STRING (sin terminador).
+    size_t length = 0;          ///< Longitud de un STRING.
+
+    long long asSigned() const {
+        double number;
+        switch (type) {
+        case LogArgType::DOUBLE:
+            std::memcpy(&number, &bits, sizeof(number));
+            return static_cast<long long>(number);
+        default:
+            return static_cast<long long>(bits);
+        }
+    }
+
+    double asDouble() const {
+        double number;
+        switch (type) {
+        case LogArgType::DOUBLE:
+            std::memcpy(&number, &bits, sizeof(number));
+            return number;
+        case LogArgType::INT:
+            return static_cast<double>(static_cast<int64_t>(bits));
+        default:
+            return static_cast<double>(bits);
+        }
+    }
+};
+
+bool
+readArg(const uint8_t* args, size_t size, size_t& offset, LogArg& arg) {
+    if (offset >= size) {
+        return false;
+    }
+    arg.type = static_cast<LogArgType>(args[offset]);
+    if (arg.type == LogArgType::STRING) {
+        uint16_t length = 0;
+        if (offset + 3 > size) {
+            return false;
+        }
+        std::memcpy(&length, args + offset + 1, sizeof(length));
+        if (offset + 3 + length > size) {
+            return false;
+        }
+        arg.text = reinterpret_cast<const char*>(args + offset + 3);
+        arg.length = length;
+        offset += 3 + length;
+        return true;
+    }
+    if (offset + 9 > size) {
+        return false;
+    }
+    std::memcpy(&arg.bits, args + offset + 1, sizeof(arg.bits));
+    offset += 9;
+    return true;
+}
+
+// Lector con comprobación de límites para el registro binario.
+class BinaryReader {
+public:
+    BinaryReader(const std::vector<uint8_t>& data) : m_data(data) {}
+
+    template<typename T>
+    bool read(T& value) {
+        if (m_position + sizeof(T) > m_data.size()) {
+            return false;
+        }
+        std::memcpy(&value, m_data.data() + m_position, sizeof(T));
+        m_position += sizeof(T);
+        return true;
+    }
+
+    bool readBytes(size_t count, const uint8_t*& bytes) {
+        if (m_position + count > m_data.size()) {
+            return false;
+        }
+        bytes = m_data.data() + m_position;
+        m_position += count;
+        return true;
+    }
+
+    bool readString(size_t count, std::string& text) {
+        const uint8_t* bytes = nullptr;
+        if (!readBytes(count, bytes)) {
+            return false;
+        }
+        text.assign(reinterpret_cast<const char*>(bytes), count);
+        return true;
+    }
+
+    bool atEnd() const { return m_position == m_data.size(); }
+
+private:
+    const std::vector<uint8_t>& m_data;
+    size_t m_position = 0;
+};
+
+/**
+ * @struct DecodedFormat
+ * @brief Entrada FORMAT leída del registro binario.
+ */
+struct DecodedFormat {
+    std::string source;
+    std::string file;
+    std::string format;
+};
+
+} // namespace
+
+void
+submitStructuredLog(LogFormat& format, const uint8_t* args, size_t size) {
+    NotificationService::getInstance().logStructured(format, args, size);
+}
+
+// Cada especificador se aplica con `snprintf` al argumento guardado, cambiando el modificador de
+// longitud por el tipo real (los enteros se guardaron en 64 bits). Un argumento que falta o no
+// coincide con la conversión se escribe como "<?>".
+size_t
+formatStructuredMessage(const char* format, const uint8_t* args, size_t size, char* out, size_t capacity) {
+    if (capacity == 0) {
+        return 0;
+    }
+    size_t used = 0;
+    size_t offset = 0;
+    const char* cursor = format;
+    while (*cursor != '\0' && used + 1 < capacity) {
+        if (*cursor != '%') {
+            out[used++] = *cursor++;
+            continue;
+        }
+        if (cursor[1] == '%') {
+            out[used++] = '%';
+            cursor += 2;
+            continue;
+        }
+
+        // %[banderas][ancho][.precisión][longitud]conversión
+        const char* start = cursor++;
+        while (*cursor != '\0' && std::strchr("-+ #0", *cursor) != nullptr) {
+            ++cursor;
+        }
+        while (std::isdigit(static_cast<unsigned char>(*cursor))) {
+            ++cursor;
+        }
+        if (*cursor == '.') {
+            ++cursor;
+            while (std::isdigit(static_cast<unsigned char>(*cursor))) {
+                ++cursor;
+            }
+        }
+        size_t prefixLength = std::min<size_t>(cursor - start, 24);
+        while (*cursor != '\0' && std::strchr("hlLqjzt", *cursor) != nullptr) {
+            ++cursor;
+        }
+        char conversion = *cursor;
+        if (conversion == '\0') {
+            break;
+        }
+        ++cursor;
+
+        char spec[32];
+        std::memcpy(spec, start, prefixLength);
+        char* specEnd = spec + prefixLength;
+        char* destination = out + used;
+        size_t room = capacity - used;
+        LogArg arg;
+        bool hasArg = readArg(args, size, offset, arg);
+        bool isString = hasArg && arg.type == LogArgType::STRING;
+        int written = -1;
+        switch (conversion) {
+        case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+            if (hasArg && !isString) {
+                std::memcpy(specEnd, "ll", 2);
+                specEnd[2] = conversion;
+                specEnd[3] = '\0';
+                written = conversion == 'd' || conversion == 'i'
+                        ? std::snprintf(destination, room, spec, arg.asSigned())
+                        : std::snprintf(destination, room, spec, static_cast<unsigned long long>(arg.asSigned()));
+            }
+            break;
+        case 'c':
+            if (hasArg && !isString) {
+                specEnd[0] = 'c';
+                specEnd[1] = '\0';
+                written = std::snprintf(destination, room, spec, static_cast<int>(arg.asSigned()));
+            }
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            if (hasArg && !isString) {
+                specEnd[0] = conversion;
+                specEnd[1] = '\0';
+                written = std::snprintf(destination, room, spec, arg.asDouble());
+            }
+            break;
+        case 's':
+            if (isString) {
+                char text[LOG_RECORD_TEXT_BYTES + 1];
+                size_t length = std::min(arg.length, LOG_RECORD_TEXT_BYTES);
+                std::memcpy(text, arg.text, length);
+                text[length] = '\0';
+                specEnd[0] = 's';
+                specEnd[1] = '\0';
+                written = std::snprintf(destination, room, spec, text);
+            }
+            break;
+        case 'p':
+            if (hasArg && !isString) {
+                specEnd[0] = 'p';
+                specEnd[1] = '\0';
+                written = std::snprintf(destination, room, spec,
+                                        reinterpret_cast<void*>(static_cast<uintptr_t>(arg.bits)));
+            }
+            break;
+        default:
+            break;
+        }
+        if (written < 0) {
+            written = std::snprintf(destination, room, "<?>");
+        }
+        used += std::min(static_cast<size_t>(written), room - 1);
+    }
+    out[used] = '\0';
+    return used;
+}
+
+size_t
+formatLogMessage(const LogRecord& record, char* out, size_t capacity) {
+    if (record.format != nullptr) {
+        return formatStructuredMessage(record.format->format, reinterpret_cast<const uint8_t*>(record.text),
+                                       record.length, out, capacity);
+    }
+    if (capacity == 0) {
+        return 0;
+    }
+    size_t length = std::min<size_t>(record.length, capacity - 1);
+    std::memcpy(out, record.text, length);
+    out[length] = '\0';
+    return length;
+}
+
+size_t
+formatLogLine(char* out, size_t capacity, uint64_t timestampNs, uint32_t threadId, const char* source,
+              ConsolErrorType severity, const char* message) {
+    int written = std::snprintf(out, capacity, "[%.3f ms] [T%u] [%s] Code: %d - Message: %s\n",
+                                timestampNs / 1e6, threadId, source, static_cast<int>(severity), message);
+    if (written < 0) {
+        return 0;
+    }
+    if (static_cast<size_t>(written) >= capacity) {
+        // Recortada: se conserva el salto de línea.
+        written = static_cast<int>(capacity - 1);
+        out[written - 1] = '\n';
+    }
+    return static_cast<size_t>(written);
+}
+
+bool
+decodeBinaryLog(const std::string& path, std::FILE* out, size_t& recordCount) {
+    recordCount = 0;
+    std::ifstream input(path, std::ios::binary);
+    if (!input) {
+        return false;
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    BinaryReader reader(data);
+
+    char magic[4];
+    uint32_t version = 0;
+    if (!reader.read(magic) || std::memcmp(magic, BinaryLog::MAGIC, sizeof(magic)) != 0 ||
+        !reader.read(version) || version != BinaryLog::VERSION) {
+        return false;
+    }
+
+    std::unordered_map<uint32_t, DecodedFormat> formats;
+    std::string source;
+    char message[LOG_MESSAGE_BYTES];
+    char line[LOG_MESSAGE_BYTES + 256];
+    while (!reader.atEnd()) {
+        uint8_t kind = 0;
+        reader.read(kind);
+        if (kind == BinaryLog::ENTRY_FORMAT) {
+            uint32_t id = 0;
+            uint32_t severity = 0;
+            int32_t lineNumber = 0;
+            uint16_t sourceLength = 0;
+            uint16_t fileLength = 0;
+            uint16_t formatLength = 0;
+            DecodedFormat format;
+            if (!reader.read(id) || !reader.read(severity) || !reader.read(lineNumber) ||
+                !reader.read(sourceLength) || !reader.read(fileLength) || !reader.read(formatLength) ||
+                !reader.readString(sourceLength, format.source) || !reader.readString(fileLength, format.file) ||
+                !reader.readString(formatLength, format.format)) {
+                return false;
+            }
+            formats[id] = std::move(format);
+        }
+        else if (kind == BinaryLog::ENTRY_RECORD) {
+            uint64_t timestampNs = 0;
+            uint32_t threadId = 0;
+            uint8_t severity = 0;
+            uint32_t formatId = 0;
+            uint16_t dataLength = 0;
+            const uint8_t* bytes = nullptr;
+            if (!reader.read(timestampNs) || !reader.read(threadId) || !reader.read(severity) ||
+                !reader.read(formatId) || !reader.read(dataLength)) {
+                return false;
+            }
+            if (formatId == 0) {
+                uint16_t sourceLength = 0;
+                if (!reader.read(sourceLength) || !reader.readString(sourceLength, source) ||
+                    !reader.readBytes(dataLength, bytes)) {
+                    return false;
+                }
+                size_t length = std::min<size_t>(dataLength, sizeof(message) - 1);
+                std::memcpy(message, bytes, length);
+                message[length] = '\0';
+            }
+            else {
+                if (!reader.readBytes(dataLength, bytes)) {
+                    return false;
+                }
+                auto format = formats.find(formatId);
+                if (format == formats.end()) {
+                    source = "?";
+                    std::snprintf(message, sizeof(message), "<unknown format %u>", formatId);
+                }
+                else {
+                    source = format->second.source;
+                    formatStructuredMessage(format->second.format.c_str(), bytes, dataLength, message, sizeof(message));
+                }
+            }
+            size_t length = formatLogLine(line, sizeof(line), timestampNs, threadId, source.c_str(),
+                                          static_cast<ConsolErrorType>(severity), message);
+            std::fwrite(line, 1, length, out);
+            ++recordCount;
+        }
+        else {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,258 @@
+#include "SweepAndPrune.h"
+
+// Registra una caja nueva: inserta sus extremos en orden y busca los traslapes existentes.
+unsigned int
+SweepAndPrune::createProxy(const sf::FloatRect& bounds, void* userData) {
+    unsigned int proxyId;
+    if (m_freeList != INVALID_PROXY) {
+        proxyId = m_freeList;
+        m_freeList = m_proxies[proxyId].nextFree;
+    }
+    else {
+        proxyId = static_cast<unsigned int>(m_proxies.size());
+        m_proxies.emplace_back();
+    }
+
+    Proxy& proxy = m_proxies[proxyId];
+    proxy.bounds = bounds;
+    proxy.userData = userData;
+    proxy.nextFree = INVALID_PROXY;
+    proxy.active = true;
+
+    for (int axis = 0; axis < 2; ++axis) {
+        std::vector<Endpoint>& endpoints = m_endpoints[axis];
+        unsigned int minIndex = static_cast<unsigned int>(endpoints.size());
+
+        endpoints.push_back({ minOf(bounds, axis), proxyId << 1 });
+        endpoints.push_back({ maxOf(bounds, axis), (proxyId << 1) | 1u });
+        proxy.minIndex[axis] = minIndex;
+        proxy.maxIndex[axis] = minIndex + 1;
+
+        // Se ordena sin actualizar pares: los traslapes iniciales se calculan abajo.
+        sortMinDown(axis, proxy.minIndex[axis], false);
+        sortMaxDown(axis, proxy.maxIndex[axis], false);
+    }
+
+    for (unsigned int other = 0; other < m_proxies.size(); ++other) {
+        if (other != proxyId && m_proxies[other].active && testOverlap(proxyId, other)) {
+            addPair(proxyId, other);
+        }
+    }
+
+    return proxyId;
+}
+
+// Quita los extremos del proxy, reporta el fin de sus pares y libera el identificador.
+void
+SweepAndPrune::destroyProxy(unsigned int proxyId) {
+    if (proxyId >= m_proxies.size() || !m_proxies[proxyId].active) {
+        return;
+    }
+
+    Proxy& proxy = m_proxies[proxyId];
+    for (int axis = 0; axis < 2; ++axis) {
+        std::vector<Endpoint>& endpoints = m_endpoints[axis];
+        unsigned int first = std::min(proxy.minIndex[axis], proxy.maxIndex[axis]);
+        unsigned int second = std::max(proxy.minIndex[axis], proxy.maxIndex[axis]);
+        endpoints.erase(endpoints.begin() + second);
+        endpoints.erase(endpoints.begin() + first);
+        for (unsigned int i = first; i < endpoints.size(); ++i) {
+            setIndex(axis, i);
+        }
+    }
+
+    for (auto it = m_pairs.begin(); it != m_pairs.end();) {
+        unsigned int a = static_cast<unsigned int>(*it >> 32);
+        unsigned int b = static_cast<unsigned int>(*it & 0xFFFFFFFFu);
+        if (a == proxyId || b == proxyId) {
+            m_events.push_back({ a, b, false });
+            it = m_pairs.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    proxy.active = false;
+    proxy.userData = nullptr;
+    proxy.nextFree = m_freeList;
+    m_freeList = proxyId;
+}
+
+// Actualiza los extremos del proxy y los desplaza con insertion sort en ambos ejes.
+void
+SweepAndPrune::moveProxy(unsigned int proxyId, const sf::FloatRect& bounds) {
+    if (proxyId >= m_proxies.size() || !m_proxies[proxyId].active) {
+        return;
+    }
+
+    Proxy& proxy = m_proxies[proxyId];
+    sf::FloatRect oldBounds = proxy.bounds;
+    proxy.bounds = bounds;
+
+    for (int axis = 0; axis < 2; ++axis) {
+        std::vector<Endpoint>& endpoints = m_endpoints[axis];
+        float newMin = minOf(bounds, axis);
+        float newMax = maxOf(bounds, axis);
+        float deltaMin = newMin - minOf(oldBounds, axis);
+        float deltaMax = newMax - maxOf(oldBounds, axis);
+
+        endpoints[proxy.minIndex[axis]].value = newMin;
+        endpoints[proxy.maxIndex[axis]].value = newMax;
+
+        // Al crecer se mueve primero el extremo que se aleja, al encoger el que se acerca,
+        // para que min y max del mismo proxy no se crucen durante el reordenamiento.
+        if (deltaMin < 0.0f) {
+            sortMinDown(axis, proxy.minIndex[axis], true);
+        }
+        if (deltaMax > 0.0f) {
+            sortMaxUp(axis, proxy.maxIndex[axis], true);
+        }
+        if (deltaMin > 0.0f) {
+            sortMinUp(axis, proxy.minIndex[axis], true);
+        }
+        if (deltaMax < 0.0f) {
+            sortMaxDown(axis, proxy.maxIndex[axis], true);
+        }
+    }
+}
+
+// Devuelve el dato de usuario del proxy o nullptr si no existe.
+void*
+SweepAndPrune::getUserData(unsigned int proxyId) const {
+    if (proxyId >= m_proxies.size()) {
+        return nullptr;
+    }
+    return m_proxies[proxyId].userData;
+}
+
+// Devuelve la caja registrada del proxy.
+const sf::FloatRect&
+SweepAndPrune::getBounds(unsigned int proxyId) const {
+    return m_proxies[proxyId].bounds;
+}
+
+// Consulta la caché de pares.
+bool
+SweepAndPrune::isOverlapping(unsigned int proxyA, unsigned int proxyB) const {
+    return m_pairs.find(pairKey(proxyA, proxyB)) != m_pairs.end();
+}
+
+// Prueba de traslape estricta en ambos ejes (cajas que solo se tocan no cuentan).
+bool
+SweepAndPrune::testOverlap(unsigned int proxyA, unsigned int proxyB) const {
+    const sf::FloatRect& a = m_proxies[proxyA].bounds;
+    const sf::FloatRect& b = m_proxies[proxyB].bounds;
+    for (int axis = 0; axis < 2; ++axis) {
+        if (maxOf(a, axis) <= minOf(b, axis) || maxOf(b, axis) <= minOf(a, axis)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Inserta el par en la caché y genera el evento de inicio si es nuevo.
+void
+SweepAndPrune::addPair(unsigned int proxyA, unsigned int proxyB) {
+    unsigned long long key = pairKey(proxyA, proxyB);
+    if (m_pairs.insert(key).second) {
+        m_events.push_back({ std::min(proxyA, proxyB), std::max(proxyA, proxyB), true });
+    }
+}
+
+// Quita el par de la caché y genera el evento de fin si existía.
+void
+SweepAndPrune::removePair(unsigned int proxyA, unsigned int proxyB) {
+    if (m_pairs.erase(pairKey(proxyA, proxyB)) > 0) {
+        m_events.push_back({ std::min(proxyA, proxyB), std::max(proxyA, proxyB), false });
+    }
+}
+
+// Sincroniza el índice guardado en el proxy con la posición real del extremo.
+void
+SweepAndPrune::setIndex(int axis, unsigned int index) {
+    const Endpoint& endpoint = m_endpoints[axis][index];
+    Proxy& proxy = m_proxies[endpoint.proxyId()];
+    if (endpoint.isMax()) {
+        proxy.maxIndex[axis] = index;
+    }
+    else {
+        proxy.minIndex[axis] = index;
+    }
+}
+
+// Un min que pasa a la izquierda de un max: los intervalos empiezan a traslaparse en este eje.
+void
+SweepAndPrune::sortMinDown(int axis, unsigned int index, bool updatePairs) {
+    std::vector<Endpoint>& endpoints = m_endpoints[axis];
+    unsigned int proxyId = endpoints[index].proxyId();
+
+    while (index > 0 && endpointLess(endpoints[index], endpoints[index - 1])) {
+        const Endpoint& prev = endpoints[index - 1];
+        if (updatePairs && prev.isMax() && prev.proxyId() != proxyId && testOverlap(proxyId, prev.proxyId())) {
+            addPair(proxyId, prev.proxyId());
+        }
+        std::swap(endpoints[index], endpoints[index - 1]);
+        setIndex(axis, index);
+        setIndex(axis, index - 1);
+        ++m_swapCount;
+        --index;
+    }
+}
+
+// Un min que pasa a la derecha de un max: los intervalos dejan de traslaparse.
+void
+SweepAndPrune::sortMinUp(int axis, unsigned int index, bool updatePairs) {
+    std::vector<Endpoint>& endpoints = m_endpoints[axis];
+    unsigned int proxyId = endpoints[index].proxyId();
+
+    while (index + 1 < endpoints.size() && endpointLess(endpoints[index + 1], endpoints[index])) {
+        const Endpoint& next = endpoints[index + 1];
+        if (updatePairs && next.isMax() && next.proxyId() != proxyId) {
+            removePair(proxyId, next.proxyId());
+        }
+        std::swap(endpoints[index], endpoints[index + 1]);
+        setIndex(axis, index);
+        setIndex(axis, index + 1);
+        ++m_swapCount;
+        ++index;
+    }
+}
+
+// Un max que pasa a la izquierda de un min: los intervalos dejan de traslaparse.
+void
+SweepAndPrune::sortMaxDown(int axis, unsigned int index, bool updatePairs) {
+    std::vector<Endpoint>& endpoints = m_endpoints[axis];
+    unsigned int proxyId = endpoints[index].proxyId();
+
+    while (index > 0 && endpointLess(endpoints[index], endpoints[index - 1])) {
+        const Endpoint& prev = endpoints[index - 1];
+        if (updatePairs && !prev.isMax() && prev.proxyId() != proxyId) {
+            removePair(proxyId, prev.proxyId());
+        }
+        std::swap(endpoints[index], endpoints[index - 1]);
+        setIndex(axis, index);
+        setIndex(axis, index - 1);
+        ++m_swapCount;
+        --index;
+    }
+}
+
+// Un max que pasa a la derecha de un min: los intervalos empiezan a traslaparse en este eje.
+void
+SweepAndPrune::sortMaxUp(int axis, unsigned int index, bool updatePairs) {
+    std::vector<Endpoint>& endpoints = m_endpoints[axis];
+    unsigned int proxyId = endpoints[index].proxyId();
+
+    while (index + 1 < endpoints.size() && endpointLess(endpoints[index + 1], endpoints[index])) {
+        const Endpoint& next = endpoints[index + 1];
+        if (updatePairs && !next.isMax() && next.proxyId() != proxyId && testOverlap(proxyId, next.proxyId())) {
+            addPair(proxyId, next.proxyId());
+        }
+        std::swap(endpoints[index], endpoints[index + 1]);
+        setIndex(axis, index);
+        setIndex(axis, index + 1);
+        ++m_swapCount;
+        ++index;
+    }
+}
@@ -0,0 +1,223 @@
+#include "TextureAtlas.h"
+#include "Hash.h"
+#include "Services/JobSystem.h"
+#include "Services/NotificationSystem.h"
+#include <algorithm>
+#include <filesystem>
+
+// Implementación propia de imstb_rectpack (imgui_draw.cpp compila la suya como estática).
+#define STBRP_STATIC
+#include <imstb_rectpack.h>
+
+/**
+ * @brief Reemplazo estable de qsort para stb: con qsort, los rectángulos de igual tamaño
+ * pueden quedar en distinto orden según la plataforma y el atlas dejaría de ser reproducible.
+ */
+static void
+stableRectSort(void* base, size_t count, size_t, int (*compare)(const void*, const void*)) {
+    stbrp_rect* rects = static_cast<stbrp_rect*>(base);
+    std::stable_sort(rects, rects + count, [compare](const stbrp_rect& a, const stbrp_rect& b) {
+        return compare(&a, &b) < 0;
+    });
+}
+
+#define STBRP_SORT stableRectSort
+#define STB_RECT_PACK_IMPLEMENTATION
+#include <imstb_rectpack.h>
+
+// Registra la imagen manteniendo las fuentes ordenadas por nombre.
+void
+TextureAtlas::addImage(const std::string& spriteName, const std::string& filePath) {
+    auto it = std::lower_bound(m_sources.begin(), m_sources.end(), spriteName,
+        [](const Source& source, const std::string& name) { return source.name < name; });
+    if (it != m_sources.end() && it->name == spriteName) {
+        it->path = filePath;
+        return;
+    }
+    Source source;
+    source.name = spriteName;
+    source.path = filePath;
+    m_sources.insert(it, source);
+}
+
+// Decodifica en paralelo, empaqueta con stb y copia los píxeles de cada región en paralelo.
+bool
+TextureAtlas::build(unsigned int maxSize, unsigned int padding) {
+    NotificationService& notifier = NotificationService::getInstance();
+    JobSystem& jobs = JobSystem::getInstance();
+
+    std::vector<char> loaded(m_sources.size(), 0);
+    jobs.parallelFor(m_sources.size(), [&](size_t i) {
+        loaded[i] = m_sources[i].image.loadFromFile(m_sources[i].path) ? 1 : 0;
+    });
+    for (size_t i = 0; i < m_sources.size(); ++i) {
+        if (!loaded[i]) {
+            notifier.addMessage(ConsolErrorType::ERROR, "Atlas: failed to load " + m_sources[i].path);
+            return false;
+        }
+    }
+
+    std::vector<stbrp_rect> rects(m_sources.size());
+    for (size_t i = 0; i < m_sources.size(); ++i) {
+        sf::Vector2u size = m_sources[i].image.getSize();
+        rects[i].id = static_cast<int>(i);
+        rects[i].w = static_cast<stbrp_coord>(size.x + padding);
+        rects[i].h = static_cast<stbrp_coord>(size.y + padding);
+    }
+
+    // Se prueba el lado potencia de dos más pequeño en el que caben todas las imágenes.
+    unsigned int atlasSize = 0;
+    for (unsigned int side = 256; side <= maxSize; side *= 2) {
+        std::vector<stbrp_node> nodes(side);
+        stbrp_context context;
+        stbrp_init_target(&context, static_cast<int>(side), static_cast<int>(side),
+                          nodes.data(), static_cast<int>(nodes.size()));
+        if (stbrp_pack_rects(&context, rects.data(), static_cast<int>(rects.size()))) {
+            atlasSize = side;
+            break;
+        }
+    }
+    if (atlasSize == 0) {
+        notifier.addMessage(ConsolErrorType::ERROR, "Atlas: images do not fit in " + std::to_string(maxSize) + "px");
+        return false;
+    }
+
+    std::vector<sf::Uint8> pixels(static_cast<size_t>(atlasSize) * atlasSize * 4, 0);
+    jobs.parallelFor(rects.size(), [&](size_t i) {
+        const stbrp_rect& rect = rects[i];
+        const sf::Image& image = m_sources[rect.id].image;
+        sf::Vector2u size = image.getSize();
+        const sf::Uint8* source = image.getPixelsPtr();
+        for (unsigned int row = 0; row < size.y; ++row) {
+            size_t destination = (static_cast<size_t>(rect.y + row) * atlasSize + rect.x) * 4;
+            std::copy(source + static_cast<size_t>(row) * size.x * 4,
+                      source + static_cast<size_t>(row + 1) * size.x * 4,
+                      pixels.begin() + destination);
+        }
+    });
+    m_image.create(atlasSize, atlasSize, pixels.data());
+
+    m_regions.clear();
+    for (const stbrp_rect& rect : rects) {
+        Source& source = m_sources[rect.id];
+        sf::Vector2u size = source.image.getSize();
+        m_regions[source.name] = sf::IntRect(rect.x, rect.y, static_cast<int>(size.x), static_cast<int>(size.y));
+        source.image = sf::Image(); // Las imágenes de origen ya no se necesitan.
+    }
+    return true;
+}
+
+// Escribe `<base>.png` y la tabla `<base>.atlas` en el orden de las fuentes (determinista).
+bool
+TextureAtlas::saveToFiles(const std::string& basePath) const {
+    if (!m_image.saveToFile(basePath + ".png")) {
+        return false;
+    }
+
+    std::ofstream table(basePath + ".atlas");
+    if (!table.is_open()) {
+        return false;
+    }
+    table << "hash " << computeSourceHash() << "\n";
+    table << "size " << m_image.getSize().x << " " << m_image.getSize().y << "\n";
+    for (const Source& source : m_sources) {
+        auto it = m_regions.find(source.name);
+        if (it != m_regions.end()) {
+            const sf::IntRect& rect = it->second;
+            table << "sprite " << rect.left << " " << rect.top << " "
+                  << rect.width << " " << rect.height << " " << source.name << "\n";
+        }
+    }
+    return table.good();
+}
+
+// Lee la tabla, valida el hash de las fuentes y carga la imagen del atlas.
+bool
+TextureAtlas::loadFromFiles(const std::string& basePath) {
+    std::ifstream table(basePath + ".atlas");
+    if (!table.is_open()) {
+        return false;
+    }
+
+    std::string keyword;
+    unsigned long long storedHash = 0;
+    if (!(table >> keyword >> storedHash) || keyword != "hash" || storedHash != computeSourceHash()) {
+        return false;
+    }
+
+    std::unordered_map<std::string, sf::IntRect> regions;
+    std::string line;
+    while (std::getline(table, line)) {
+        std::istringstream stream(line);
+        if (!(stream >> keyword) || keyword != "sprite") {
+            continue;
+        }
+        sf::IntRect rect;
+        std::string name;
+        stream >> rect.left >> rect.top >> rect.width >> rect.height;
+        std::getline(stream >> std::ws, name);
+        regions[name] = rect;
+    }
+
+    for (const Source& source : m_sources) {
+        if (regions.find(source.name) == regions.end()) {
+            return false;
+        }
+    }
+
+    if (!m_image.loadFromFile(basePath + ".png")) {
+        return false;
+    }
+    m_regions.swap(regions);
+    return true;
+}
+
+// Usa el atlas en caché si sigue vigente; si no, lo reconstruye y lo guarda para la próxima vez.
+bool
+TextureAtlas::loadOrBuild(const std::string& basePath) {
+    if (loadFromFiles(basePath)) {
+        return true;
+    }
+    if (!build()) {
+        return false;
+    }
+    if (!saveToFiles(basePath)) {
+        NotificationService::getInstance().addMessage(ConsolErrorType::WARNING,
+            "Atlas: could not write cache " + basePath);
+    }
+    return true;
+}
+
+// Busca la región de un sprite.
+bool
+TextureAtlas::findRegion(const std::string& spriteName, sf::IntRect& rect) const {
+    auto it = m_regions.find(spriteName);
+    if (it == m_regions.end()) {
+        return false;
+    }
+    rect = it->second;
+    return true;
+}
+
+// Combina nombre, tamaño y fecha de cada fuente; no requiere decodificar las imágenes.
+unsigned long long
+TextureAtlas::computeSourceHash() const {
+    unsigned long long hash = EngineUtilities::FNV_OFFSET_BASIS;
+    for (const Source& source : m_sources) {
+        std::error_code error;
+        unsigned long long fileSize = std::filesystem::file_size(source.path, error);
+        if (error) {
+            fileSize = 0;
+        }
+        long long writeTime = 0;
+        auto lastWrite = std::filesystem::last_write_time(source.path, error);
+        if (!error) {
+            writeTime = static_cast<long long>(lastWrite.time_since_epoch().count());
+        }
+
+        hash = EngineUtilities::hashFNV1a(source.name.data(), source.name.size(), hash);
+        hash = EngineUtilities::hashFNV1a(&fileSize, sizeof(fileSize), hash);
+        hash = EngineUtilities::hashFNV1a(&writeTime, sizeof(writeTime), hash);
+    }
+    return hash;
+}
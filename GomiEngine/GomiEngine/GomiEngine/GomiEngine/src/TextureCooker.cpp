@@ -0,0 +1,266 @@
+#include "TextureCooker.h"
+#include "Hash.h"
+#include "MappedFile.h"
+#include "Services/JobSystem.h"
+#include "Services/NotificationSystem.h"
+#include <SFML/Graphics/Image.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Encabezado de `.gtex` tal como está en el archivo.
+ */
+struct CookedHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t width;
+    uint32_t height;
+    uint32_t levelCount;
+    uint32_t flags;
+    uint64_t sourceHash;
+    uint64_t dataSize;
+    uint32_t reserved[6];
+};
+
+static_assert(sizeof(CookedHeader) == TextureCooker::HEADER_SIZE, "Unexpected cooked texture header size");
+
+/**
+ * @brief Multiplica el color de cada píxel por su alfa.
+ */
+void
+premultiply(std::vector<uint8_t>& pixels) {
+    for (size_t i = 0; i < pixels.size(); i += 4) {
+        unsigned int alpha = pixels[i + 3];
+        for (int channel = 0; channel < 3; ++channel) {
+            pixels[i + channel] = static_cast<uint8_t>((pixels[i + channel] * alpha + 127) / 255);
+        }
+    }
+}
+
+/**
+ * @brief Deshace `premultiply` (los píxeles transparentes quedan negros).
+ */
+void
+unpremultiply(std::vector<uint8_t>& pixels) {
+    for (size_t i = 0; i < pixels.size(); i += 4) {
+        unsigned int alpha = pixels[i + 3];
+        for (int channel = 0; channel < 3; ++channel) {
+            pixels[i + channel] = alpha == 0 ? 0 : static_cast<uint8_t>(
+                std::min(255u, (pixels[i + channel] * 255u + alpha / 2) / alpha));
+        }
+    }
+}
+
+/**
+ * @brief Reduce a la mitad un nivel premultiplicado con un filtro de caja 2x2.
+ */
+std::vector<uint8_t>
+downsample(const std::vector<uint8_t>& source, uint32_t width, uint32_t height,
+           uint32_t targetWidth, uint32_t targetHeight) {
+    std::vector<uint8_t> target(static_cast<size_t>(targetWidth) * targetHeight * 4);
+    for (uint32_t y = 0; y < targetHeight; ++y) {
+        uint32_t y0 = std::min(y * 2, height - 1);
+        uint32_t y1 = std::min(y * 2 + 1, height - 1);
+        for (uint32_t x = 0; x < targetWidth; ++x) {
+            uint32_t x0 = std::min(x * 2, width - 1);
+            uint32_t x1 = std::min(x * 2 + 1, width - 1);
+            const uint8_t* samples[4] = {
+                &source[(static_cast<size_t>(y0) * width + x0) * 4], &source[(static_cast<size_t>(y0) * width + x1) * 4],
+                &source[(static_cast<size_t>(y1) * width + x0) * 4], &source[(static_cast<size_t>(y1) * width + x1) * 4]
+            };
+            uint8_t* out = &target[(static_cast<size_t>(y) * targetWidth + x) * 4];
+            for (int channel = 0; channel < 4; ++channel) {
+                unsigned int sum = samples[0][channel] + samples[1][channel] + samples[2][channel] + samples[3][channel];
+                out[channel] = static_cast<uint8_t>((sum + 2) / 4);
+            }
+        }
+    }
+    return target;
+}
+
+bool
+isImageFile(const std::filesystem::path& path) {
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".png" || extension == ".jpg" || extension == ".jpeg" ||
+           extension == ".bmp" || extension == ".tga";
+}
+
+} // namespace
+
+// Valida el encabezado y ubica cada nivel detrás del anterior.
+bool
+CookedImage::parse(const void* data, size_t size) {
+    if (data == nullptr || size < TextureCooker::HEADER_SIZE) {
+        return false;
+    }
+    CookedHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic != TextureCooker::MAGIC || header.version != TextureCooker::VERSION ||
+        header.width == 0 || header.height == 0 || header.levelCount == 0 || header.levelCount > MAX_LEVELS ||
+        header.dataSize > size - TextureCooker::HEADER_SIZE) {
+        return false;
+    }
+
+    const uint8_t* cursor = static_cast<const uint8_t*>(data) + TextureCooker::HEADER_SIZE;
+    uint64_t remaining = header.dataSize;
+    uint32_t levelWidth = header.width;
+    uint32_t levelHeight = header.height;
+    for (uint32_t level = 0; level < header.levelCount; ++level) {
+        uint64_t levelSize = static_cast<uint64_t>(levelWidth) * levelHeight * 4;
+        if (levelSize > remaining) {
+            return false;
+        }
+        levels[level] = cursor;
+        cursor += levelSize;
+        remaining -= levelSize;
+        levelWidth = std::max(1u, levelWidth / 2);
+        levelHeight = std::max(1u, levelHeight / 2);
+    }
+
+    width = header.width;
+    height = header.height;
+    levelCount = header.levelCount;
+    premultiplied = (header.flags & TextureCooker::FLAG_PREMULTIPLIED) != 0;
+    sourceHash = header.sourceHash;
+    return true;
+}
+
+// Las opciones forman parte del hash: cambiarlas vuelve a cocinar todo.
+uint64_t
+TextureCooker::computeHash(const void* data, size_t size) const {
+    unsigned long long hash = EngineUtilities::hashFNV1a(data, size);
+    uint32_t options = (m_premultiply ? 1u : 0u) | (m_generateMips ? 2u : 0u) | (VERSION << 8);
+    return EngineUtilities::hashFNV1a(&options, sizeof(options), hash);
+}
+
+// Compara el hash del contenido con el de la salida; si difiere, decodifica y escribe los niveles.
+bool
+TextureCooker::cookFile(const std::string& sourcePath, const std::string& outputPath, bool& cooked) const {
+    cooked = false;
+    MappedFile source;
+    if (!source.open(sourcePath)) {
+        return false;
+    }
+    const uint64_t hash = computeHash(source.data(), source.size());
+
+    {
+        MappedFile existing;
+        CookedImage previous;
+        if (existing.open(outputPath) && previous.parse(existing.data(), existing.size()) &&
+            previous.sourceHash == hash) {
+            return true;
+        }
+    }
+
+    sf::Image image;
+    if (!image.loadFromMemory(source.data(), source.size())) {
+        return false;
+    }
+    const sf::Vector2u size = image.getSize();
+    const uint8_t* pixels = image.getPixelsPtr();
+
+    std::vector<std::vector<uint8_t>> levels;
+    levels.emplace_back(pixels, pixels + static_cast<size_t>(size.x) * size.y * 4);
+    if (m_premultiply) {
+        premultiply(levels[0]);
+    }
+    if (m_generateMips) {
+        // Los mips se promedian con el color premultiplicado para que los píxeles transparentes
+        // no tiñan los bordes.
+        std::vector<uint8_t> current = levels[0];
+        if (!m_premultiply) {
+            premultiply(current);
+        }
+        uint32_t width = size.x;
+        uint32_t height = size.y;
+        while ((width > 1 || height > 1) && levels.size() < CookedImage::MAX_LEVELS) {
+            uint32_t nextWidth = std::max(1u, width / 2);
+            uint32_t nextHeight = std::max(1u, height / 2);
+            current = downsample(current, width, height, nextWidth, nextHeight);
+            levels.push_back(current);
+            if (!m_premultiply) {
+                unpremultiply(levels.back());
+            }
+            width = nextWidth;
+            height = nextHeight;
+        }
+    }
+
+    CookedHeader header = {};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.width = size.x;
+    header.height = size.y;
+    header.levelCount = static_cast<uint32_t>(levels.size());
+    header.flags = m_premultiply ? FLAG_PREMULTIPLIED : 0u;
+    header.sourceHash = hash;
+    for (const auto& level : levels) {
+        header.dataSize += level.size();
+    }
+
+    std::error_code error;
+    std::filesystem::path parent = std::filesystem::path(outputPath).parent_path();
+    if (!parent.empty()) {
+        std::filesystem::create_directories(parent, error);
+    }
+    std::ofstream output(outputPath, std::ios::binary | std::ios::trunc);
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& level : levels) {
+        output.write(reinterpret_cast<const char*>(level.data()), static_cast<std::streamsize>(level.size()));
+    }
+    if (!output) {
+        return false;
+    }
+    cooked = true;
+    return true;
+}
+
+// Reúne las imágenes y las cocina en paralelo; los errores se avisan al terminar desde el hilo que llama.
+bool
+TextureCooker::cookDirectory(const std::string& sourceDirectory, const std::string& outputDirectory) {
+    std::vector<std::filesystem::path> sources;
+    std::error_code error;
+    for (std::filesystem::recursive_directory_iterator it(sourceDirectory, error), end; it != end && !error;
+         it.increment(error)) {
+        if (it->is_regular_file() && isImageFile(it->path())) {
+            sources.push_back(it->path());
+        }
+    }
+
+    std::atomic<size_t> cookedCount(0);
+    std::atomic<size_t> skippedCount(0);
+    std::vector<char> failed(sources.size(), 0);
+    JobSystem::getInstance().parallelFor(sources.size(), [&](size_t i) {
+        std::error_code pathError;
+        std::filesystem::path relative = std::filesystem::relative(sources[i], sourceDirectory, pathError);
+        std::filesystem::path output = std::filesystem::path(outputDirectory) / relative;
+        output.replace_extension(".gtex");
+        bool cooked = false;
+        if (pathError || !cookFile(sources[i].string(), output.string(), cooked)) {
+            failed[i] = 1;
+            return;
+        }
+        ++(cooked ? cookedCount : skippedCount);
+    });
+
+    m_cookedCount = cookedCount;
+    m_skippedCount = skippedCount;
+    m_failedFiles.clear();
+    for (size_t i = 0; i < sources.size(); ++i) {
+        if (failed[i]) {
+            m_failedFiles.push_back(sources[i].string());
+            NotificationService::getInstance().addMessage(ConsolErrorType::ERROR,
+                "Cooker: failed to cook " + sources[i].string());
+        }
+    }
+    return !error && m_failedFiles.empty();
+}
@@ -0,0 +1,178 @@
+#include "TriggerSystem.h"
+#include "Services/NotificationSystem.h"
+
+// Registra un actor con volumen de disparo.
+void
+TriggerSystem::addTrigger(EngineUtilities::TSharedPointer<Actor> actor) {
+    if (actor.isNull()) {
+        return;
+    }
+    auto trigger = actor->getComponent<TriggerVolume>();
+    if (trigger.isNull()) {
+        NotificationService::getInstance().addMessage(ConsolErrorType::WARNING,
+            "Actor '" + actor->getName() + "' has no TriggerVolume component");
+        return;
+    }
+    addEntry(actor, trigger);
+}
+
+// Registra un actor que puede entrar a los volúmenes.
+void
+TriggerSystem::addBody(EngineUtilities::TSharedPointer<Actor> actor) {
+    if (actor.isNull()) {
+        return;
+    }
+    addEntry(actor, EngineUtilities::TSharedPointer<TriggerVolume>());
+}
+
+// Quita el proxy del actor; las salidas pendientes se encolan antes de liberar la entrada.
+void
+TriggerSystem::removeActor(const Actor* actor) {
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        Entry& entry = m_entries[i];
+        if (entry.actor.get() != actor || entry.proxyId == SweepAndPrune::INVALID_PROXY) {
+            continue;
+        }
+        m_broadphase.destroyProxy(entry.proxyId);
+        collectBroadphaseEvents();
+
+        m_proxyEntries[entry.proxyId] = INVALID_ENTRY;
+        entry.actor.reset();
+        entry.trigger.reset();
+        entry.proxyId = SweepAndPrune::INVALID_PROXY;
+        m_freeEntries.push_back(i);
+        return;
+    }
+}
+
+// Mueve en el broadphase solo los proxies cuya caja cambió y encola los eventos.
+void
+TriggerSystem::update() {
+    for (Entry& entry : m_entries) {
+        if (entry.proxyId == SweepAndPrune::INVALID_PROXY) {
+            continue;
+        }
+        sf::FloatRect bounds = computeBounds(entry);
+        if (bounds != entry.bounds) {
+            entry.bounds = bounds;
+            m_broadphase.moveProxy(entry.proxyId, bounds);
+        }
+    }
+
+    collectBroadphaseEvents();
+
+    // La permanencia solo cuesta para los traslapes activos cuyos volúmenes la solicitan.
+    for (const ActiveOverlap& overlap : m_activeOverlaps) {
+        if (m_entries[overlap.triggerEntry].trigger->wantsStayEvents()) {
+            enqueue(TRIGGER_STAY, overlap.triggerEntry, overlap.bodyEntry);
+        }
+    }
+}
+
+// Despacha el lote del fotograma. Los callbacks pueden agregar o quitar actores sin invalidar el lote.
+void
+TriggerSystem::dispatchEvents() {
+    m_dispatchBuffer.swap(m_eventQueue);
+    for (const QueuedEvent& queued : m_dispatchBuffer) {
+        queued.trigger->dispatch(queued.event);
+    }
+    m_dispatchedCount = m_dispatchBuffer.size();
+    m_dispatchBuffer.clear();
+}
+
+// Crea la entrada y el proxy del actor.
+void
+TriggerSystem::addEntry(EngineUtilities::TSharedPointer<Actor> actor,
+                        EngineUtilities::TSharedPointer<TriggerVolume> trigger) {
+    size_t index;
+    if (!m_freeEntries.empty()) {
+        index = m_freeEntries.back();
+        m_freeEntries.pop_back();
+    }
+    else {
+        index = m_entries.size();
+        m_entries.emplace_back();
+    }
+
+    Entry& entry = m_entries[index];
+    entry.actor = actor;
+    entry.trigger = trigger;
+    entry.bounds = computeBounds(entry);
+    entry.proxyId = m_broadphase.createProxy(entry.bounds, actor.get());
+
+    if (entry.proxyId >= m_proxyEntries.size()) {
+        m_proxyEntries.resize(entry.proxyId + 1, INVALID_ENTRY);
+    }
+    m_proxyEntries[entry.proxyId] = index;
+
+    collectBroadphaseEvents();
+}
+
+// Los volúmenes usan su tamaño centrado en el Transform; los cuerpos, la caja de su forma.
+sf::FloatRect
+TriggerSystem::computeBounds(const Entry& entry) const {
+    if (!entry.trigger.isNull()) {
+        auto transform = entry.actor->getComponent<Transform>();
+        Vector2 position = transform.isNull() ? Vector2() : transform->getPosition();
+        return entry.trigger->computeBounds(position);
+    }
+
+    auto shape = entry.actor->getComponent<ShapeFactory>();
+    return shape.isNull() ? sf::FloatRect() : shape->getBounds();
+}
+
+// Traduce los eventos del broadphase a entradas/salidas de volumen y mantiene los traslapes activos.
+void
+TriggerSystem::collectBroadphaseEvents() {
+    for (const SweepAndPrune::OverlapEvent& event : m_broadphase.getEvents()) {
+        size_t entryA = m_proxyEntries[event.proxyA];
+        size_t entryB = m_proxyEntries[event.proxyB];
+        if (entryA == INVALID_ENTRY || entryB == INVALID_ENTRY) {
+            continue;
+        }
+
+        bool triggerA = !m_entries[entryA].trigger.isNull();
+        bool triggerB = !m_entries[entryB].trigger.isNull();
+        if (triggerA == triggerB) {
+            continue; // Solo interesan los pares volumen/cuerpo.
+        }
+
+        size_t triggerEntry = triggerA ? entryA : entryB;
+        size_t bodyEntry = triggerA ? entryB : entryA;
+        unsigned long long key = (static_cast<unsigned long long>(triggerEntry) << 32) | bodyEntry;
+
+        if (event.begin) {
+            m_overlapIndex[key] = m_activeOverlaps.size();
+            m_activeOverlaps.push_back({ triggerEntry, bodyEntry });
+            enqueue(TRIGGER_ENTER, triggerEntry, bodyEntry);
+        }
+        else {
+            auto it = m_overlapIndex.find(key);
+            if (it != m_overlapIndex.end()) {
+                // Borrado por intercambio con el último para mantener el arreglo compacto.
+                size_t slot = it->second;
+                const ActiveOverlap& last = m_activeOverlaps.back();
+                m_overlapIndex[(static_cast<unsigned long long>(last.triggerEntry) << 32) | last.bodyEntry] = slot;
+                m_activeOverlaps[slot] = last;
+                m_activeOverlaps.pop_back();
+                m_overlapIndex.erase(key);
+            }
+            enqueue(TRIGGER_EXIT, triggerEntry, bodyEntry);
+        }
+    }
+    m_broadphase.clearEvents();
+}
+
+// Agrega un evento a la cola del fotograma.
+void
+TriggerSystem::enqueue(TriggerEventType type, size_t triggerEntry, size_t bodyEntry) {
+    const Entry& trigger = m_entries[triggerEntry];
+    const Entry& body = m_entries[bodyEntry];
+
+    QueuedEvent queued;
+    queued.event = { type, trigger.actor.get(), body.actor.get() };
+    queued.trigger = trigger.trigger;
+    queued.triggerActor = trigger.actor;
+    queued.otherActor = body.actor;
+    m_eventQueue.push_back(queued);
+}
@@ -0,0 +1,114 @@
+#include "UniformGrid.h"
+#include <algorithm>
+#include <cmath>
+
+// Registra una caja nueva reutilizando un identificador libre si lo hay.
+unsigned int
+UniformGrid::createProxy(const sf::FloatRect& bounds, void* userData) {
+    unsigned int proxyId;
+    if (m_freeList != INVALID_PROXY) {
+        proxyId = m_freeList;
+        m_freeList = m_proxies[proxyId].nextFree;
+    }
+    else {
+        proxyId = static_cast<unsigned int>(m_proxies.size());
+        m_proxies.emplace_back();
+    }
+
+    Proxy& proxy = m_proxies[proxyId];
+    proxy.bounds = bounds;
+    proxy.userData = userData;
+    proxy.nextFree = INVALID_PROXY;
+    proxy.active = true;
+    ++m_proxyCount;
+    return proxyId;
+}
+
+// Libera el identificador; la rejilla se reconstruye en cada consulta.
+void
+UniformGrid::destroyProxy(unsigned int proxyId) {
+    if (proxyId >= m_proxies.size() || !m_proxies[proxyId].active) {
+        return;
+    }
+    Proxy& proxy = m_proxies[proxyId];
+    proxy.active = false;
+    proxy.userData = nullptr;
+    proxy.nextFree = m_freeList;
+    m_freeList = proxyId;
+    --m_proxyCount;
+}
+
+// Solo guarda la caja: las celdas se calculan en findPairs.
+void
+UniformGrid::moveProxy(unsigned int proxyId, const sf::FloatRect& bounds) {
+    if (proxyId >= m_proxies.size() || !m_proxies[proxyId].active) {
+        return;
+    }
+    m_proxies[proxyId].bounds = bounds;
+}
+
+// Reparte los proxies en celdas, ordena por celda y prueba los pares de cada celda.
+void
+UniformGrid::findPairs(std::vector<ProxyPair>& pairs) {
+    pairs.clear();
+    m_entries.clear();
+    for (unsigned int proxyId = 0; proxyId < m_proxies.size(); ++proxyId) {
+        const Proxy& proxy = m_proxies[proxyId];
+        if (!proxy.active) {
+            continue;
+        }
+        int minX = cellCoordinate(proxy.bounds.left);
+        int minY = cellCoordinate(proxy.bounds.top);
+        int maxX = cellCoordinate(proxy.bounds.left + proxy.bounds.width);
+        int maxY = cellCoordinate(proxy.bounds.top + proxy.bounds.height);
+        for (int y = minY; y <= maxY; ++y) {
+            for (int x = minX; x <= maxX; ++x) {
+                m_entries.push_back({ cellKey(x, y), proxyId });
+            }
+        }
+    }
+
+    // A igual celda se conserva el orden por identificador, así cada par sale con el menor primero.
+    std::sort(m_entries.begin(), m_entries.end(), [](const CellEntry& a, const CellEntry& b) {
+        return a.cell < b.cell || (a.cell == b.cell && a.proxyId < b.proxyId);
+    });
+
+    for (size_t first = 0; first < m_entries.size();) {
+        size_t end = first + 1;
+        while (end < m_entries.size() && m_entries[end].cell == m_entries[first].cell) {
+            ++end;
+        }
+
+        for (size_t i = first; i < end; ++i) {
+            const sf::FloatRect& a = m_proxies[m_entries[i].proxyId].bounds;
+            for (size_t j = i + 1; j < end; ++j) {
+                const sf::FloatRect& b = m_proxies[m_entries[j].proxyId].bounds;
+                float left = std::max(a.left, b.left);
+                float top = std::max(a.top, b.top);
+                if (std::min(a.left + a.width, b.left + b.width) <= left ||
+                    std::min(a.top + a.height, b.top + b.height) <= top) {
+                    continue;
+                }
+                // Solo la celda de la esquina mínima de la intersección reporta el par.
+                if (cellKey(cellCoordinate(left), cellCoordinate(top)) == m_entries[first].cell) {
+                    pairs.push_back({ m_entries[i].proxyId, m_entries[j].proxyId });
+                }
+            }
+        }
+        first = end;
+    }
+}
+
+// Devuelve el dato de usuario del proxy o nullptr si no existe.
+void*
+UniformGrid::getUserData(unsigned int proxyId) const {
+    if (proxyId >= m_proxies.size()) {
+        return nullptr;
+    }
+    return m_proxies[proxyId].userData;
+}
+
+int
+UniformGrid::cellCoordinate(float value) const {
+    return static_cast<int>(std::floor(value / m_cellSize));
+}
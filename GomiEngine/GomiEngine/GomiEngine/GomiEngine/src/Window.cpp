@@ -1,124 +1,146 @@
-﻿#include "GraphicsWindow.h"
+﻿#include "Window.h"
 
-GraphicsWindow::GraphicsWindow(int width, int height, const std::string& title) {
-    m_graphicsWindow = new sf::RenderWindow(sf::VideoMode(width, height), title);
+Window::Window(int width, int height, const std::string& title) {
+    init(width, height, title);
+}
+
+// Destructor que libera recursos de ImGui y de la ventana.
+Window::~Window() {
+    delete m_window;
+    m_window = nullptr;
+}
 
-    if (!m_graphicsWindow) {
-        ERROR("GraphicsWindow", "GraphicsWindow", "CHECK CONSTRUCTOR");
+// Crea la ventana, inicializa ImGui y reserva la textura de la escena.
+void
+Window::init(int width, int height, const std::string& title) {
+    m_window = new sf::RenderWindow(sf::VideoMode(width, height), title);
+
+    if (!m_window) {
+        ERROR("Window", "Window", "CHECK CONSTRUCTOR");
     }
     else {
-        MESSAGE("GraphicsWindow", "GraphicsWindow", "OK");
+        MESSAGE("Window", "Window", "OK");
     }
 
     // Inicialización del recurso de ImGui
-    ImGui::SFML::Init(*m_graphicsWindow);
+    ImGui::SFML::Init(*m_window);
 
-    // Crear RenderTexture con las mismas dimensiones que la ventana
-    if (!m_renderTexture.create(width, height)) {
-        ERROR("GraphicsWindow", "RenderTexture", "CHECK CREATION");
+    // Reservar la textura de la escena con las mismas dimensiones que la ventana
+    if (!m_sceneViewport.resize(sf::Vector2u(width, height))) {
+        ERROR("Window", "RenderTexture", "CHECK CREATION");
     }
 }
 
-// Destructor que libera recursos de ImGui y de la ventana.
-GraphicsWindow::~GraphicsWindow() {
-    delete m_graphicsWindow;
-    m_graphicsWindow = nullptr;
-}
-
 // Maneja los eventos de la ventana, como cierre y redimensionamiento.
+// Los cambios de tamaño se acumulan y solo se aplica el último del fotograma.
 void
-GraphicsWindow::handleEvents() {
+Window::handleEvents() {
     sf::Event event;
-    while (m_graphicsWindow->pollEvent(event)) {
+    while (m_window->pollEvent(event)) {
+        ++m_eventCount;
         // Procesa los eventos de ImGui
         ImGui::SFML::ProcessEvent(event);
         switch (event.type) {
         case sf::Event::Closed:
-            m_graphicsWindow->close();
+            m_window->close();
             break;
         case sf::Event::Resized:
-            unsigned int width = event.size.width;
-            unsigned int height = event.size.height;
-
-            m_view = m_graphicsWindow->getView();
-            m_view.setSize(static_cast<float>(width), static_cast<float>(height));
-            m_graphicsWindow->setView(m_view);
-
-            // Actualizar RenderTexture si la ventana cambia de tamaño
-            m_renderTexture.create(width, height);
+            m_pendingSize = sf::Vector2u(event.size.width, event.size.height);
+            m_resizePending = true;
+            ++m_resizeEventCount;
+            break;
+        default:
             break;
         }
     }
+
+    if (m_resizePending) {
+        m_resizePending = false;
+        ++m_appliedResizeCount;
+
+        m_view = m_window->getView();
+        m_view.setSize(static_cast<float>(m_pendingSize.x), static_cast<float>(m_pendingSize.y));
+        m_window->setView(m_view);
+
+        // La textura de la escena solo se reemplaza si cambia su clase de tamaño
+        m_sceneViewport.resize(m_pendingSize);
+    }
 }
 
 // Limpia la ventana y la RenderTexture.
 void
-GraphicsWindow::clear() {
-    if (m_graphicsWindow != nullptr) {
-        m_graphicsWindow->clear();
+Window::clear() {
+    if (m_window != nullptr) {
+        m_window->clear();
     }
     else {
-        ERROR("GraphicsWindow", "clear", "CHECK FOR GRAPHICS WINDOW POINTER DATA");
-    }
-    if (m_renderTexture.getSize().x > 0 && m_renderTexture.getSize().y > 0) {
-        m_renderTexture.clear();
+        ERROR("Window", "clear", "CHECK FOR GRAPHICS WINDOW POINTER DATA");
     }
+    m_sceneViewport.clear();
 }
 
 // Muestra el contenido de la ventana.
 void
-GraphicsWindow::display() {
-    if (m_graphicsWindow != nullptr) {
-        m_graphicsWindow->display();
+Window::display() {
+    if (m_window != nullptr) {
+        m_window->display();
     }
     else {
-        ERROR("GraphicsWindow", "display", "CHECK FOR GRAPHICS WINDOW POINTER DATA");
+        ERROR("Window", "display", "CHECK FOR GRAPHICS WINDOW POINTER DATA");
     }
 }
 
 // Verifica si la ventana está abierta.
 bool
-GraphicsWindow::isOpen() const {
-    if (m_graphicsWindow != nullptr) {
-        return m_graphicsWindow->isOpen();
+Window::isOpen() const {
+    if (m_window != nullptr) {
+        return m_window->isOpen();
     }
     else {
-        ERROR("GraphicsWindow", "isOpen", "CHECK FOR GRAPHICS WINDOW POINTER DATA");
+        ERROR("Window", "isOpen", "CHECK FOR GRAPHICS WINDOW POINTER DATA");
         return false;
     }
 }
 
 // Dibuja un objeto en la RenderTexture.
 void
-GraphicsWindow::draw(const sf::Drawable& drawable) {
-    if (m_renderTexture.getSize().x > 0 && m_renderTexture.getSize().y > 0) {
-        m_renderTexture.draw(drawable);
-    }
+Window::draw(const sf::Drawable& drawable) {
+    m_sceneViewport.draw(drawable);
+}
+
+// Dibuja un objeto en la RenderTexture con estados de render explícitos.
+void
+Window::draw(const sf::Drawable& drawable, const sf::RenderStates& states) {
+    m_sceneViewport.draw(drawable, states);
 }
 
 // Obtiene el puntero a la ventana.
 sf::RenderWindow*
-GraphicsWindow::getWindow() {
-    if (m_graphicsWindow != nullptr) {
-        return m_graphicsWindow;
+Window::getWindow() {
+    if (m_window != nullptr) {
+        return m_window;
     }
     else {
-        ERROR("GraphicsWindow", "getWindow", "CHECK FOR GRAPHICS WINDOW POINTER DATA");
+        ERROR("Window", "getWindow", "CHECK FOR GRAPHICS WINDOW POINTER DATA");
         return nullptr;
     }
 }
 
 // Finaliza el proceso de renderizado en la RenderTexture.
 void
-GraphicsWindow::renderToTexture() {
-    m_renderTexture.display();
+Window::renderToTexture() {
+    m_sceneViewport.display();
 }
 
 // Muestra la RenderTexture en una ventana de ImGui.
 void
-GraphicsWindow::showInImGui() {
-    const sf::Texture& texture = m_renderTexture.getTexture();
+Window::showInImGui() {
+    m_sceneViewport.showInImGui();
+}
 
+// Muestra una textura dibujada fuera de la ventana (p. ej. por el hilo de render) en ImGui.
+void
+Window::showInImGui(const sf::Texture& texture) {
     // Obtener el tamaño de la textura
     ImVec2 size(texture.getSize().x, texture.getSize().y);
 
@@ -130,23 +152,36 @@ GraphicsWindow::showInImGui() {
 
 // Actualiza ImGui con el deltaTime de la ventana.
 void
-GraphicsWindow::update() {
+Window::update() {
     // Almacena el deltaTime una sola vez
     deltaTime = clock.restart();
 
     // Usa el deltaTime para actualizar ImGui
-    ImGui::SFML::Update(*m_graphicsWindow, deltaTime);
+    ImGui::SFML::Update(*m_window, deltaTime);
 }
 
 // Renderiza ImGui en la ventana.
 void
-GraphicsWindow::render() {
-    ImGui::SFML::Render(*m_graphicsWindow);
+Window::render() {
+    ImGui::SFML::Render(*m_window);
 }
 
 // Libera recursos de ImGui y elimina el puntero de la ventana.
 void
-GraphicsWindow::destroy() {
+Window::destroy() {
     ImGui::SFML::Shutdown();
-    SAFE_PTR_RELEASE(m_graphicsWindow);
+    SAFE_PTR_RELEASE(m_window);
+}
+
+// Ajusta la vista de la ventana.
+void
+Window::setView(const sf::View& view) {
+    m_view = view;
+    m_window->setView(m_view);
+}
+
+// Devuelve el tiempo transcurrido entre frames.
+sf::Time
+Window::getDeltaTime() const {
+    return deltaTime;
 }